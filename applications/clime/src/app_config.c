@@ -23,6 +23,7 @@
 #include <string.h>
 
 /* ### Preserved code "includes" (begin) */
+#include "app_work.h"
 /* ^^^ Preserved code "includes" (end) */
 
 LOG_MODULE_REGISTER(app_config, LOG_LEVEL_DBG);
@@ -76,6 +77,41 @@ const struct ctr_config_item items[] = {
 /* clang-format on */
 
 /* ### Preserved code "function" (begin) */
+
+/* Intervals of the scheduler tasks, applied from the cloud without reboot */
+static const char *const m_hot_items[] = {
+	"interval-sample",
+	"interval-aggreg",
+	"interval-report",
+	NULL,
+};
+
+static int commit_hot(void)
+{
+	bool is_sample = g_app_config.interval_sample != m_config_interim.interval_sample;
+	bool is_aggreg = g_app_config.interval_aggreg != m_config_interim.interval_aggreg;
+	bool is_report = g_app_config.interval_report != m_config_interim.interval_report;
+
+	g_app_config.interval_sample = m_config_interim.interval_sample;
+	g_app_config.interval_aggreg = m_config_interim.interval_aggreg;
+	g_app_config.interval_report = m_config_interim.interval_report;
+
+	if (is_sample) {
+		app_work_sample();
+	}
+
+	if (is_aggreg) {
+		app_work_aggreg();
+	}
+
+	/* The send task rearms itself with the new interval */
+	if (is_report) {
+		app_work_send();
+	}
+
+	return 0;
+}
+
 /* ^^^ Preserved code "function" (end) */
 
 int app_config_cmd_config_show(const struct shell *shell, size_t argc, char **argv)
@@ -160,6 +196,15 @@ static int init(void)
 	/* ^^^ Preserved code "init" (end) */
 
 	ctr_config_append_show(SETTINGS_PFX, app_config_cmd_config_show);
+	ctr_config_append_items(items, ARRAY_SIZE(items));
+
+	/* ### Preserved code "init end" (begin) */
+	ret = ctr_config_set_hot_items(items, m_hot_items, commit_hot);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_set_hot_items` failed: %d", ret);
+		return ret;
+	}
+	/* ^^^ Preserved code "init end" (end) */
 
 	return 0;
 }
@@ -11,6 +11,7 @@
 
 /* CHESTER includes */
 #include <chester/ctr_accel.h>
+#include <chester/ctr_aggreg.h>
 #include <chester/ctr_ble_tag.h>
 #include <chester/ctr_ds18b20.h>
 #include <chester/ctr_hygro.h>
@@ -42,49 +43,9 @@ LOG_MODULE_REGISTER(app_sensor, LOG_LEVEL_DBG);
 
 #define BATT_TEST_INTERVAL_MSEC (12 * 60 * 60 * 1000)
 
-static int compare(const void *a, const void *b)
-{
-	float fa = *(const float *)a;
-	float fb = *(const float *)b;
-
-	return (fa > fb) - (fa < fb);
-}
-
-static void aggreg(float *samples, size_t count, float *min, float *max, float *avg, float *mdn)
-{
-	*min = NAN;
-	*max = NAN;
-	*avg = NAN;
-	*mdn = NAN;
-
-	if (!count) {
-		return;
-	}
-
-	for (size_t i = 0; i < count; i++) {
-		if (isnan(samples[i])) {
-			return;
-		}
-	}
-
-	qsort(samples, count, sizeof(float), compare);
-
-	*min = samples[0];
-	*max = samples[count - 1];
-
-	double avg_ = 0;
-	for (size_t i = 0; i < count; i++) {
-		avg_ += (double)samples[i];
-	}
-	avg_ /= count;
-
-	*avg = avg_;
-	*mdn = samples[count / 2];
-}
-
 __unused static void aggreg_sample(float *samples, size_t count, struct ctr_data_aggreg *sample)
 {
-	aggreg(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
+	ctr_aggreg_array(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
 }
 
 int app_sensor_sample(void)
@@ -131,64 +92,32 @@ int app_sensor_iaq_sample(void)
 	int ret;
 	static const struct device *dev = DEVICE_DT_GET(DT_NODELABEL(ctr_s1));
 
-	float temperature;
-	float humidity;
-	float illuminance;
-	float altitude;
-	float pressure;
-	float co2_conc;
+	struct ctr_s1_measurement m;
 
 	struct app_data_iaq_sensors *sensors = &g_app_data.iaq.sensors;
 
 	if (sensors->sample_count < APP_DATA_MAX_SAMPLES) {
 		int i = sensors->sample_count;
-		ret = ctr_s1_read_temperature(dev, &temperature);
-		if (ret) {
-			temperature = NAN;
-			LOG_ERR("Call `ctr_s1_read_temperature` failed: %d", ret);
-		} else {
-			LOG_INF("Temperature: %.1f C", (double)temperature);
-		}
-
-		ret = ctr_s1_read_humidity(dev, &humidity);
-		if (ret) {
-			humidity = NAN;
-			LOG_ERR("Call `ctr_s1_read_humidity` failed: %d", ret);
-		} else {
-			LOG_INF("Humidity: %.1f %%", (double)humidity);
-		}
-
-		ret = ctr_s1_read_illuminance(dev, &illuminance);
-		if (ret) {
-			illuminance = NAN;
-			LOG_ERR("Call `ctr_s1_read_illuminance` failed: %d", ret);
-		} else {
-			LOG_INF("Illuminance: %.0f lux", (double)illuminance);
-		}
 
-		ret = ctr_s1_read_altitude(dev, &altitude);
+		/* Failed quantities are NAN, the others are valid */
+		ret = ctr_s1_measure(dev, CTR_S1_QUANTITY_ALL, &m);
 		if (ret) {
-			altitude = NAN;
-			LOG_ERR("Call `ctr_s1_read_altitude` failed: %d", ret);
-		} else {
-			LOG_INF("Altitude: %.0f m", (double)altitude);
+			LOG_ERR("Call `ctr_s1_measure` failed: %d", ret);
 		}
 
-		ret = ctr_s1_read_pressure(dev, &pressure);
-		if (ret) {
-			pressure = NAN;
-			LOG_ERR("Call `ctr_s1_read_pressure` failed: %d", ret);
-		} else {
-			LOG_INF("Pressure: %.0f Pa", (double)pressure);
-		}
+		float temperature = m.temperature;
+		float humidity = m.humidity;
+		float illuminance = m.illuminance;
+		float altitude = m.altitude;
+		float pressure = m.pressure;
+		float co2_conc = m.co2_conc;
 
-		ret = ctr_s1_read_co2_conc(dev, &co2_conc);
-		if (ret) {
-			co2_conc = NAN;
-			LOG_ERR("Call `ctr_s1_read_co2_conc` failed: %d", ret);
-		} else {
-			LOG_INF("CO2 conc.: %.0f ppm", (double)co2_conc);
-		}
+		LOG_INF("Temperature: %.1f C", (double)temperature);
+		LOG_INF("Humidity: %.1f %%", (double)humidity);
+		LOG_INF("Illuminance: %.0f lux", (double)illuminance);
+		LOG_INF("Altitude: %.0f m", (double)altitude);
+		LOG_INF("Pressure: %.0f Pa", (double)pressure);
+		LOG_INF("CO2 conc.: %.0f ppm", (double)co2_conc);
 
 		app_data_lock();
 		sensors->samples_temperature[i] = temperature;
@@ -495,20 +424,29 @@ int app_sensor_hygro_clear(void)
 int app_sensor_w1_therm_sample(void)
 {
 	int ret;
-	uint64_t serial_number;
 
-	for (int i = 0; i < MIN(APP_DATA_W1_THERM_COUNT, ctr_ds18b20_get_count()); i++) {
+	struct ctr_ds18b20_sample samples[APP_DATA_W1_THERM_COUNT];
+
+	ret = ctr_ds18b20_read_all(samples, ARRAY_SIZE(samples));
+	if (ret < 0) {
+		LOG_ERR("Call `ctr_ds18b20_read_all` failed: %d", ret);
+		return ret;
+	}
+
+	int count = ret;
+
+	for (int i = 0; i < MIN(APP_DATA_W1_THERM_COUNT, count); i++) {
 		if (g_app_data.w1_therm.sensor[i].sample_count < APP_DATA_MAX_SAMPLES) {
-			float temperature = NAN;
-			ret = ctr_ds18b20_read(i, &serial_number, &temperature);
+			float temperature = samples[i].temperature;
+			uint64_t serial_number = samples[i].serial_number;
 
-			if (ret) {
-				LOG_ERR("Call `ctr_ds18b20_read` failed: %d", ret);
+			if (isnan(temperature)) {
+				LOG_ERR("Sensor %d not read", i);
 				continue;
-			} else {
-				LOG_INF("Temperature: %.1f C", (double)temperature);
 			}
 
+			LOG_INF("Temperature: %.1f C", (double)temperature);
+
 			app_data_lock();
 			struct app_data_w1_therm_sensor *sensor = &g_app_data.w1_therm.sensor[i];
 			sensor->last_sample_temperature = temperature;
@@ -901,81 +839,112 @@ int app_sensor_soil_sensor_clear(void)
 
 #if defined(FEATURE_HARDWARE_CHESTER_SPS30)
 
-int app_sensor_sps30_sample(void)
-{
-	int ret;
+/* Readings averaged into one sample, taken 1 s apart once the fan has warmed up */
+#define SPS30_READINGS 5
 
-	float pm_1_0;
-	float pm_2_5;
-	float pm_4_0;
-	float pm_10_0;
+/* Shorter sample intervals keep the sensor running instead of repeating the warm-up */
+#define SPS30_CONTINUOUS_INTERVAL 60
 
-	float num_0_5;
-	float num_1_0;
-	float num_2_5;
-	float num_4_0;
-	float num_10_0;
+static void sps30_read_cb(int result, const struct ctr_sps30_data *data, void *user_data)
+{
+	struct ctr_sps30_data sample = {
+		.mass_conc_pm_1_0 = NAN,
+		.mass_conc_pm_2_5 = NAN,
+		.mass_conc_pm_4_0 = NAN,
+		.mass_conc_pm_10_0 = NAN,
+		.num_conc_pm_0_5 = NAN,
+		.num_conc_pm_1_0 = NAN,
+		.num_conc_pm_2_5 = NAN,
+		.num_conc_pm_4_0 = NAN,
+		.num_conc_pm_10_0 = NAN,
+	};
 
-	if (g_app_data.sps30.sample_count < APP_DATA_MAX_SAMPLES) {
-		ret = ctr_sps30_read(&pm_1_0, &pm_2_5, &pm_4_0, &pm_10_0, &num_0_5, &num_1_0,
-				     &num_2_5, &num_4_0, &num_10_0);
-		if (ret) {
-			LOG_ERR("Call `ctr_sps30_read` failed: %d", ret);
-			pm_1_0 = NAN;
-			pm_2_5 = NAN;
-			pm_4_0 = NAN;
-			pm_10_0 = NAN;
-
-			num_0_5 = NAN;
-			num_1_0 = NAN;
-			num_2_5 = NAN;
-			num_4_0 = NAN;
-			num_10_0 = NAN;
-		} else {
-			LOG_INF("SPS30: Mass Concentration PM1.0: %.2f ug/m3", (double)pm_1_0);
-			LOG_INF("SPS30: Mass Concentration PM2.5: %.2f ug/m3", (double)pm_2_5);
-			LOG_INF("SPS30: Mass Concentration PM4.0: %.2f ug/m3", (double)pm_4_0);
-			LOG_INF("SPS30: Mass Concentration PM10.0: %.2f ug/m3", (double)pm_10_0);
-
-			LOG_INF("SPS30: Number Concentration PM0.5: %.2f", (double)num_0_5);
-			LOG_INF("SPS30: Number Concentration PM1.0: %.2f", (double)num_1_0);
-			LOG_INF("SPS30: Number Concentration PM2.5: %.2f", (double)num_2_5);
-			LOG_INF("SPS30: Number Concentration PM4.0: %.2f", (double)num_4_0);
-			LOG_INF("SPS30: Number Concentration PM10.0: %.2f", (double)num_10_0);
-		}
+	if (result) {
+		LOG_ERR("Call `ctr_sps30_read_async` failed: %d", result);
+	} else {
+		sample = *data;
+
+		LOG_INF("SPS30: Mass Concentration PM1.0: %.2f ug/m3",
+			(double)sample.mass_conc_pm_1_0);
+		LOG_INF("SPS30: Mass Concentration PM2.5: %.2f ug/m3",
+			(double)sample.mass_conc_pm_2_5);
+		LOG_INF("SPS30: Mass Concentration PM4.0: %.2f ug/m3",
+			(double)sample.mass_conc_pm_4_0);
+		LOG_INF("SPS30: Mass Concentration PM10.0: %.2f ug/m3",
+			(double)sample.mass_conc_pm_10_0);
+
+		LOG_INF("SPS30: Number Concentration PM0.5: %.2f", (double)sample.num_conc_pm_0_5);
+		LOG_INF("SPS30: Number Concentration PM1.0: %.2f", (double)sample.num_conc_pm_1_0);
+		LOG_INF("SPS30: Number Concentration PM2.5: %.2f", (double)sample.num_conc_pm_2_5);
+		LOG_INF("SPS30: Number Concentration PM4.0: %.2f", (double)sample.num_conc_pm_4_0);
+		LOG_INF("SPS30: Number Concentration PM10.0: %.2f",
+			(double)sample.num_conc_pm_10_0);
+	}
 
-		app_data_lock();
-		g_app_data.sps30.last_sample_mass_conc_pm_1_0 = pm_1_0;
-		g_app_data.sps30.last_sample_mass_conc_pm_2_5 = pm_2_5;
-		g_app_data.sps30.last_sample_mass_conc_pm_4_0 = pm_4_0;
-		g_app_data.sps30.last_sample_mass_conc_pm_10_0 = pm_10_0;
-
-		g_app_data.sps30.last_sample_num_conc_pm_0_5 = num_0_5;
-		g_app_data.sps30.last_sample_num_conc_pm_1_0 = num_1_0;
-		g_app_data.sps30.last_sample_num_conc_pm_2_5 = num_2_5;
-		g_app_data.sps30.last_sample_num_conc_pm_4_0 = num_4_0;
-		g_app_data.sps30.last_sample_num_conc_pm_10_0 = num_10_0;
-
-		g_app_data.sps30.samples_mass_conc_pm_1_0[g_app_data.sps30.sample_count] = pm_1_0;
-		g_app_data.sps30.samples_mass_conc_pm_2_5[g_app_data.sps30.sample_count] = pm_2_5;
-		g_app_data.sps30.samples_mass_conc_pm_4_0[g_app_data.sps30.sample_count] = pm_4_0;
-		g_app_data.sps30.samples_mass_conc_pm_10_0[g_app_data.sps30.sample_count] = pm_10_0;
-
-		g_app_data.sps30.samples_num_conc_pm_0_5[g_app_data.sps30.sample_count] = num_0_5;
-		g_app_data.sps30.samples_num_conc_pm_1_0[g_app_data.sps30.sample_count] = num_1_0;
-		g_app_data.sps30.samples_num_conc_pm_2_5[g_app_data.sps30.sample_count] = num_2_5;
-		g_app_data.sps30.samples_num_conc_pm_4_0[g_app_data.sps30.sample_count] = num_4_0;
-		g_app_data.sps30.samples_num_conc_pm_10_0[g_app_data.sps30.sample_count] = num_10_0;
-
-		g_app_data.sps30.sample_count++;
+	app_data_lock();
+
+	/* The buffer may have been aggregated and cleared during the measurement */
+	if (g_app_data.sps30.sample_count >= APP_DATA_MAX_SAMPLES) {
 		app_data_unlock();
+		LOG_WRN("Sample buffer full");
+		return;
+	}
 
-		LOG_INF("Sample count: %d", g_app_data.sps30.sample_count);
-	} else {
+	g_app_data.sps30.last_sample_mass_conc_pm_1_0 = sample.mass_conc_pm_1_0;
+	g_app_data.sps30.last_sample_mass_conc_pm_2_5 = sample.mass_conc_pm_2_5;
+	g_app_data.sps30.last_sample_mass_conc_pm_4_0 = sample.mass_conc_pm_4_0;
+	g_app_data.sps30.last_sample_mass_conc_pm_10_0 = sample.mass_conc_pm_10_0;
+
+	g_app_data.sps30.last_sample_num_conc_pm_0_5 = sample.num_conc_pm_0_5;
+	g_app_data.sps30.last_sample_num_conc_pm_1_0 = sample.num_conc_pm_1_0;
+	g_app_data.sps30.last_sample_num_conc_pm_2_5 = sample.num_conc_pm_2_5;
+	g_app_data.sps30.last_sample_num_conc_pm_4_0 = sample.num_conc_pm_4_0;
+	g_app_data.sps30.last_sample_num_conc_pm_10_0 = sample.num_conc_pm_10_0;
+
+	int i = g_app_data.sps30.sample_count;
+
+	g_app_data.sps30.samples_mass_conc_pm_1_0[i] = sample.mass_conc_pm_1_0;
+	g_app_data.sps30.samples_mass_conc_pm_2_5[i] = sample.mass_conc_pm_2_5;
+	g_app_data.sps30.samples_mass_conc_pm_4_0[i] = sample.mass_conc_pm_4_0;
+	g_app_data.sps30.samples_mass_conc_pm_10_0[i] = sample.mass_conc_pm_10_0;
+
+	g_app_data.sps30.samples_num_conc_pm_0_5[i] = sample.num_conc_pm_0_5;
+	g_app_data.sps30.samples_num_conc_pm_1_0[i] = sample.num_conc_pm_1_0;
+	g_app_data.sps30.samples_num_conc_pm_2_5[i] = sample.num_conc_pm_2_5;
+	g_app_data.sps30.samples_num_conc_pm_4_0[i] = sample.num_conc_pm_4_0;
+	g_app_data.sps30.samples_num_conc_pm_10_0[i] = sample.num_conc_pm_10_0;
+
+	g_app_data.sps30.sample_count++;
+	app_data_unlock();
+
+	LOG_INF("Sample count: %d", i + 1);
+}
+
+int app_sensor_sps30_sample(void)
+{
+	int ret;
+
+	if (g_app_data.sps30.sample_count >= APP_DATA_MAX_SAMPLES) {
 		LOG_WRN("Sample buffer full");
 		return -ENOSPC;
 	}
 
+	ret = ctr_sps30_set_continuous(g_app_config.interval_sample <= SPS30_CONTINUOUS_INTERVAL);
+	if (ret) {
+		LOG_WRN("Call `ctr_sps30_set_continuous` failed: %d", ret);
+	}
+
+	/* The result is stored by the callback, the task returns without waiting for the warm-up */
+	ret = ctr_sps30_read_async(SPS30_READINGS, sps30_read_cb, NULL);
+	if (ret == -EBUSY) {
+		LOG_WRN("Previous measurement still in progress");
+		return 0;
+	} else if (ret) {
+		/* Store the failed sample as the blocking read did */
+		sps30_read_cb(ret, NULL, NULL);
+		return ret;
+	}
+
 	return 0;
 }
 
@@ -18,6 +18,7 @@
 /* CHESTER includes */
 #include <chester/ctr_buf.h>
 #include <chester/ctr_cloud.h>
+#include <chester/ctr_sched.h>
 
 /* Zephyr includes */
 #include <zephyr/device.h>
@@ -37,12 +38,26 @@ LOG_MODULE_REGISTER(app_work, LOG_LEVEL_DBG);
 #define WORK_Q_STACK_SIZE 4096
 #define WORK_Q_PRIORITY   K_LOWEST_APPLICATION_THREAD_PRIO
 
+/* Share of its interval a task may be postponed by to run in one batch with the others */
+#define TOLERANCE_DIVIDER 10
+
+#define SEND_DELAY_MS     (10 * 1000)
+#define POWER_DELAY_MS    (60 * 1000)
+#define POWER_INTERVAL_MS (12 * 60 * 60 * 1000LL)
+
+/* Tasks on a shared bus run back to back within a batch */
+enum {
+	GROUP_NONE = CTR_SCHED_GROUP_NONE,
+	GROUP_I2C,
+	GROUP_W1,
+};
+
 static struct k_work_q m_work_q;
 static K_THREAD_STACK_DEFINE(m_work_q_stack, WORK_Q_STACK_SIZE);
 
-static struct k_timer m_send_timer;
+static struct ctr_sched m_sched;
 
-static void send_work_handler(struct k_work *work)
+static void send_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -56,7 +71,8 @@ static void send_work_handler(struct k_work *work)
 
 	LOG_INF("Scheduling next timeout in %lld second(s)", duration / 1000);
 
-	k_timer_start(&m_send_timer, K_MSEC(duration), K_FOREVER);
+	ctr_sched_set_period(&m_sched, task, 0, duration / TOLERANCE_DIVIDER);
+	ctr_sched_start(&m_sched, task, duration);
 
 #if defined(FEATURE_SUBSYSTEM_LTE_V2)
 
@@ -148,21 +164,12 @@ static void send_work_handler(struct k_work *work)
 #endif /* defined(FEATURE_SUBSYSTEM_RADON) */
 }
 
-static K_WORK_DEFINE(m_send_work, send_work_handler);
+static struct ctr_sched_task m_send_task = {
+	.cb = send_task_cb,
+	.group = GROUP_NONE,
+};
 
-static void send_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_send_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_send_timer, send_timer_handler, NULL);
-
-static void sample_work_handler(struct k_work *work)
+static void sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -179,21 +186,12 @@ static void sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_sample_work, sample_work_handler);
+static struct ctr_sched_task m_sample_task = {
+	.cb = sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_sample_timer, sample_timer_handler, NULL);
-
-static void power_work_handler(struct k_work *work)
+static void power_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -203,23 +201,14 @@ static void power_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_power_work, power_work_handler);
-
-static void power_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_power_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_power_timer, power_timer_handler, NULL);
+static struct ctr_sched_task m_power_task = {
+	.cb = power_task_cb,
+	.group = GROUP_NONE,
+};
 
 #if defined(FEATURE_HARDWARE_CHESTER_S1)
 
-static void iaq_sample_work_handler(struct k_work *work)
+static void iaq_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -229,21 +218,12 @@ static void iaq_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_iaq_sample_work, iaq_sample_work_handler);
-
-static void iaq_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_iaq_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_iaq_sample_timer, iaq_sample_timer_handler, NULL);
+static struct ctr_sched_task m_iaq_sample_task = {
+	.cb = iaq_sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void iaq_aggreg_work_handler(struct k_work *work)
+static void iaq_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -253,25 +233,16 @@ static void iaq_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_iaq_aggreg_work, iaq_aggreg_work_handler);
-
-static void iaq_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_iaq_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_iaq_aggreg_timer, iaq_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_iaq_aggreg_task = {
+	.cb = iaq_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S1) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_S2)
 
-static void hygro_sample_work_handler(struct k_work *work)
+static void hygro_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -281,21 +252,12 @@ static void hygro_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_hygro_sample_work, hygro_sample_work_handler);
-
-static void hygro_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_hygro_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_hygro_sample_timer, hygro_sample_timer_handler, NULL);
+static struct ctr_sched_task m_hygro_sample_task = {
+	.cb = hygro_sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void hygro_aggreg_work_handler(struct k_work *work)
+static void hygro_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -305,25 +267,16 @@ static void hygro_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_hygro_aggreg_work, hygro_aggreg_work_handler);
-
-static void hygro_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_hygro_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_hygro_aggreg_timer, hygro_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_hygro_aggreg_task = {
+	.cb = hygro_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S2) */
 
 #if defined(FEATURE_SUBSYSTEM_DS18B20)
 
-static void w1_therm_sample_work_handler(struct k_work *work)
+static void w1_therm_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -333,21 +286,12 @@ static void w1_therm_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_w1_therm_sample_work, w1_therm_sample_work_handler);
-
-static void w1_therm_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_w1_therm_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_w1_therm_sample_timer, w1_therm_sample_timer_handler, NULL);
+static struct ctr_sched_task m_w1_therm_sample_task = {
+	.cb = w1_therm_sample_task_cb,
+	.group = GROUP_W1,
+};
 
-static void w1_therm_aggreg_work_handler(struct k_work *work)
+static void w1_therm_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -357,25 +301,16 @@ static void w1_therm_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_w1_therm_aggreg_work, w1_therm_aggreg_work_handler);
-
-static void w1_therm_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_w1_therm_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_w1_therm_aggreg_timer, w1_therm_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_w1_therm_aggreg_task = {
+	.cb = w1_therm_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_SUBSYSTEM_DS18B20) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B)
 
-static void rtd_therm_sample_work_handler(struct k_work *work)
+static void rtd_therm_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -385,21 +320,12 @@ static void rtd_therm_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_rtd_therm_sample_work, rtd_therm_sample_work_handler);
-
-static void rtd_therm_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_rtd_therm_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_rtd_therm_sample_timer, rtd_therm_sample_timer_handler, NULL);
+static struct ctr_sched_task m_rtd_therm_sample_task = {
+	.cb = rtd_therm_sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void rtd_therm_aggreg_work_handler(struct k_work *work)
+static void rtd_therm_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -409,25 +335,16 @@ static void rtd_therm_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_rtd_therm_aggreg_work, rtd_therm_aggreg_work_handler);
-
-static void rtd_therm_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_rtd_therm_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_rtd_therm_aggreg_timer, rtd_therm_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_rtd_therm_aggreg_task = {
+	.cb = rtd_therm_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B)
 
-static void tc_therm_sample_work_handler(struct k_work *work)
+static void tc_therm_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -437,21 +354,12 @@ static void tc_therm_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_tc_therm_sample_work, tc_therm_sample_work_handler);
-
-static void tc_therm_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_tc_therm_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_tc_therm_sample_timer, tc_therm_sample_timer_handler, NULL);
+static struct ctr_sched_task m_tc_therm_sample_task = {
+	.cb = tc_therm_sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void tc_therm_aggreg_work_handler(struct k_work *work)
+static void tc_therm_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -461,25 +369,16 @@ static void tc_therm_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_tc_therm_aggreg_work, tc_therm_aggreg_work_handler);
-
-static void tc_therm_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_tc_therm_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_tc_therm_aggreg_timer, tc_therm_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_tc_therm_aggreg_task = {
+	.cb = tc_therm_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B) */
 
 #if defined(FEATURE_SUBSYSTEM_SOIL_SENSOR)
 
-static void soil_sensor_sample_work_handler(struct k_work *work)
+static void soil_sensor_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -489,21 +388,12 @@ static void soil_sensor_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_soil_sensor_sample_work, soil_sensor_sample_work_handler);
-
-static void soil_sensor_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_soil_sensor_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_soil_sensor_sample_timer, soil_sensor_sample_timer_handler, NULL);
+static struct ctr_sched_task m_soil_sensor_sample_task = {
+	.cb = soil_sensor_sample_task_cb,
+	.group = GROUP_W1,
+};
 
-static void soil_sensor_aggreg_work_handler(struct k_work *work)
+static void soil_sensor_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -513,25 +403,16 @@ static void soil_sensor_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_soil_sensor_aggreg_work, soil_sensor_aggreg_work_handler);
-
-static void soil_sensor_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_soil_sensor_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_soil_sensor_aggreg_timer, soil_sensor_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_soil_sensor_aggreg_task = {
+	.cb = soil_sensor_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_SUBSYSTEM_SOIL_SENSOR) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_SPS30)
 
-static void sps30_sample_work_handler(struct k_work *work)
+static void sps30_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -541,21 +422,12 @@ static void sps30_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_sps30_sample_work, sps30_sample_work_handler);
-
-static void sps30_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_sps30_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_sps30_sample_timer, sps30_sample_timer_handler, NULL);
+static struct ctr_sched_task m_sps30_sample_task = {
+	.cb = sps30_sample_task_cb,
+	.group = GROUP_I2C,
+};
 
-static void sps30_aggreg_work_handler(struct k_work *work)
+static void sps30_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -565,19 +437,10 @@ static void sps30_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_sps30_aggreg_work, sps30_aggreg_work_handler);
-
-static void sps30_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_sps30_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_sps30_aggreg_timer, sps30_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_sps30_aggreg_task = {
+	.cb = sps30_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_SPS30) */
 
@@ -609,7 +472,7 @@ void app_work_backup_update(void)
 
 #if defined(FEATURE_SUBSYSTEM_BLE_TAG)
 
-static void ble_tag_sample_work_handler(struct k_work *work)
+static void ble_tag_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -619,21 +482,12 @@ static void ble_tag_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_ble_tag_sample_work, ble_tag_sample_work_handler);
-
-static void ble_tag_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_ble_tag_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_ble_tag_sample_timer, ble_tag_sample_timer_handler, NULL);
+static struct ctr_sched_task m_ble_tag_sample_task = {
+	.cb = ble_tag_sample_task_cb,
+	.group = GROUP_NONE,
+};
 
-static void ble_tag_aggreg_work_handler(struct k_work *work)
+static void ble_tag_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -643,25 +497,16 @@ static void ble_tag_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_ble_tag_aggreg_work, ble_tag_aggreg_work_handler);
-
-static void ble_tag_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_ble_tag_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_ble_tag_aggreg_timer, ble_tag_aggreg_timer_handler, NULL);
+static struct ctr_sched_task m_ble_tag_aggreg_task = {
+	.cb = ble_tag_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
 #endif /* defined(FEATURE_SUBSYSTEM_BLE_TAG) */
 
 #if defined(FEATURE_SUBSYSTEM_RADON)
 
-static void radon_sample_work_handler(struct k_work *work)
+static void radon_sample_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -671,21 +516,12 @@ static void radon_sample_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_radon_sample_work, radon_sample_work_handler);
-
-static void radon_sample_timer_handler(struct k_timer *timer)
-{
-	int ret;
-
-	ret = k_work_submit_to_queue(&m_work_q, &m_radon_sample_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
-}
-
-static K_TIMER_DEFINE(m_radon_sample_timer, radon_sample_timer_handler, NULL);
+static struct ctr_sched_task m_radon_sample_task = {
+	.cb = radon_sample_task_cb,
+	.group = GROUP_NONE,
+};
 
-static void radon_aggreg_work_handler(struct k_work *work)
+static void radon_aggreg_task_cb(struct ctr_sched_task *task)
 {
 	int ret;
 
@@ -695,21 +531,24 @@ static void radon_aggreg_work_handler(struct k_work *work)
 	}
 }
 
-static K_WORK_DEFINE(m_radon_aggreg_work, radon_aggreg_work_handler);
+static struct ctr_sched_task m_radon_aggreg_task = {
+	.cb = radon_aggreg_task_cb,
+	.group = GROUP_NONE,
+};
 
-static void radon_aggreg_timer_handler(struct k_timer *timer)
-{
-	int ret;
+#endif /* defined(FEATURE_SUBSYTEM_RADON) */
 
-	ret = k_work_submit_to_queue(&m_work_q, &m_radon_aggreg_work);
-	if (ret < 0) {
-		LOG_ERR("Call `k_work_submit_to_queue` failed: %d", ret);
-	}
+static void start_task(struct ctr_sched_task *task, int64_t delay, int64_t interval)
+{
+	ctr_sched_set_period(&m_sched, task, interval, interval / TOLERANCE_DIVIDER);
+	ctr_sched_start(&m_sched, task, delay);
 }
 
-static K_TIMER_DEFINE(m_radon_aggreg_timer, radon_aggreg_timer_handler, NULL);
-
-#endif /* defined(FEATURE_SUBSYTEM_RADON) */
+static void add_task(struct ctr_sched_task *task, int64_t delay, int64_t interval)
+{
+	ctr_sched_add(&m_sched, task);
+	start_task(task, delay, interval);
+}
 
 int app_work_init(void)
 {
@@ -718,160 +557,175 @@ int app_work_init(void)
 
 	k_thread_name_set(&m_work_q.thread, "app_work");
 
-	k_timer_start(&m_send_timer, K_SECONDS(10), K_FOREVER);
-	k_timer_start(&m_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_power_timer, K_SECONDS(60), K_HOURS(12));
+	ctr_sched_init(&m_sched, &m_work_q, NULL, NULL);
+
+	int64_t sample = g_app_config.interval_sample * 1000LL;
+	int64_t aggreg = g_app_config.interval_aggreg * 1000LL;
+
+	/* Batches run the tasks in this order - samples first, then aggregation and reporting */
+	add_task(&m_sample_task, 0, sample);
+
+#if defined(FEATURE_HARDWARE_CHESTER_S1)
+	add_task(&m_iaq_sample_task, sample, sample);
+#endif /* defined(FEATURE_HARDWARE_CHESTER_S1) */
+
+#if defined(FEATURE_HARDWARE_CHESTER_S2)
+	add_task(&m_hygro_sample_task, sample, sample);
+#endif /* defined(FEATURE_HARDWARE_CHESTER_S2) */
+
+#if defined(FEATURE_SUBSYSTEM_DS18B20)
+	add_task(&m_w1_therm_sample_task, sample, sample);
+#endif /* defined(FEATURE_SUBSYSTEM_DS18B20) */
+
+#if defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B)
+	add_task(&m_rtd_therm_sample_task, sample, sample);
+#endif /* defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B) */
+
+#if defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B)
+	add_task(&m_tc_therm_sample_task, sample, sample);
+#endif /* defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B) */
+
+#if defined(FEATURE_SUBSYSTEM_SOIL_SENSOR)
+	add_task(&m_soil_sensor_sample_task, sample, sample);
+#endif /* defined(FEATURE_SUBSYSTEM_SOIL_SENSOR) */
+
+#if defined(FEATURE_HARDWARE_CHESTER_SPS30)
+	add_task(&m_sps30_sample_task, sample, sample);
+#endif /* defined(FEATURE_HARDWARE_CHESTER_SPS30) */
+
+#if defined(FEATURE_SUBSYSTEM_BLE_TAG)
+	add_task(&m_ble_tag_sample_task, sample, sample);
+#endif /* defined(FEATURE_SUBSYSTEM_BLE_TAG) */
+
+#if defined(FEATURE_SUBSYSTEM_RADON)
+	add_task(&m_radon_sample_task, sample, sample);
+#endif /* defined(FEATURE_SUBSYSTEM_RADON) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_S1)
-	k_timer_start(&m_iaq_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_iaq_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_iaq_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S1) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_S2)
-	k_timer_start(&m_hygro_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_hygro_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_hygro_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S2) */
 
 #if defined(FEATURE_SUBSYSTEM_DS18B20)
-	k_timer_start(&m_w1_therm_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_w1_therm_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_w1_therm_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_SUBSYSTEM_DS18B20) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B)
-	k_timer_start(&m_rtd_therm_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_rtd_therm_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_rtd_therm_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B)
-	k_timer_start(&m_tc_therm_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_tc_therm_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_tc_therm_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B) */
 
 #if defined(FEATURE_SUBSYSTEM_SOIL_SENSOR)
-	k_timer_start(&m_soil_sensor_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_soil_sensor_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_soil_sensor_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_SUBSYSTEM_SOIL_SENSOR) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_SPS30)
-	k_timer_start(&m_sps30_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_sps30_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_sps30_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_SPS30) */
 
 #if defined(FEATURE_SUBSYSTEM_BLE_TAG)
-	k_timer_start(&m_ble_tag_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_ble_tag_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_ble_tag_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_SUBSYSTEM_BLE_TAG) */
 
 #if defined(FEATURE_SUBSYSTEM_RADON)
-	k_timer_start(&m_radon_sample_timer, K_SECONDS(g_app_config.interval_sample),
-		      K_SECONDS(g_app_config.interval_sample));
-	k_timer_start(&m_radon_aggreg_timer, K_SECONDS(g_app_config.interval_aggreg),
-		      K_SECONDS(g_app_config.interval_aggreg));
+	add_task(&m_radon_aggreg_task, aggreg, aggreg);
 #endif /* defined(FEATURE_SUBSYSTEM_RADON) */
 
+	add_task(&m_power_task, POWER_DELAY_MS, POWER_INTERVAL_MS);
+	add_task(&m_send_task, SEND_DELAY_MS, 0);
+
 	return 0;
 }
 
 void app_work_sample(void)
 {
-	k_timer_start(&m_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	int64_t interval = g_app_config.interval_sample * 1000LL;
+
+	start_task(&m_sample_task, 0, interval);
 
 #if defined(FEATURE_HARDWARE_CHESTER_S1)
-	k_timer_start(&m_iaq_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_iaq_sample_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S1) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_S2)
-	k_timer_start(&m_hygro_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_hygro_sample_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S2) */
 
 #if defined(FEATURE_SUBSYSTEM_DS18B20)
-	k_timer_start(&m_w1_therm_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_w1_therm_sample_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_DS18B20) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B)
-	k_timer_start(&m_rtd_therm_sample_timer, K_NO_WAIT,
-		      K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_rtd_therm_sample_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B)
-	k_timer_start(&m_tc_therm_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_tc_therm_sample_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B) */
 
 #if defined(FEATURE_SUBSYSTEM_SOIL_SENSOR)
-	k_timer_start(&m_soil_sensor_sample_timer, K_NO_WAIT,
-		      K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_soil_sensor_sample_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_SOIL_SENSOR) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_SPS30)
-	k_timer_start(&m_sps30_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_sps30_sample_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_SPS30) */
 
 #if defined(FEATURE_SUBSYSTEM_BLE_TAG)
-	k_timer_start(&m_ble_tag_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_ble_tag_sample_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_BLE_TAG) */
 
 #if defined(FEATURE_SUBSYSTEM_RADON)
-	k_timer_start(&m_radon_sample_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_sample));
+	start_task(&m_radon_sample_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_RADON) */
 }
 
 void app_work_aggreg(void)
 {
+	int64_t interval = g_app_config.interval_aggreg * 1000LL;
 
 #if defined(FEATURE_HARDWARE_CHESTER_S1)
-	k_timer_start(&m_iaq_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_iaq_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S1) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_S2)
-	k_timer_start(&m_hygro_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_hygro_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_S2) */
 
 #if defined(FEATURE_SUBSYSTEM_DS18B20)
-	k_timer_start(&m_w1_therm_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_w1_therm_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_DS18B20) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B)
-	k_timer_start(&m_rtd_therm_aggreg_timer, K_NO_WAIT,
-		      K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_rtd_therm_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_RTD_A) || defined(FEATURE_HARDWARE_CHESTER_RTD_B) */
 
 #if defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B)
-	k_timer_start(&m_tc_therm_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_tc_therm_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_HARDWARE_CHESTER_TC_A) || defined(FEATURE_HARDWARE_CHESTER_TC_B) */
 
 #if defined(FEATURE_SUBSYSTEM_SOIL_SENSOR)
-	k_timer_start(&m_soil_sensor_aggreg_timer, K_NO_WAIT,
-		      K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_soil_sensor_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_SOIL_SENSOR) */
 
 #if defined(FEATURE_SUBSYSTEM_BLE_TAG)
-	k_timer_start(&m_ble_tag_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_ble_tag_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_BLE_TAG) */
 
 #if defined(FEATURE_SUBSYSTEM_RADON)
-	k_timer_start(&m_radon_aggreg_timer, K_NO_WAIT, K_SECONDS(g_app_config.interval_aggreg));
+	start_task(&m_radon_aggreg_task, 0, interval);
 #endif /* defined(FEATURE_SUBSYSTEM_RADON) */
 }
 
 void app_work_send(void)
 {
-	k_timer_start(&m_send_timer, K_NO_WAIT, K_FOREVER);
+	ctr_sched_start(&m_sched, &m_send_task, 0);
 }
 
 #if defined(FEATURE_HARDWARE_CHESTER_S2) || defined(FEATURE_HARDWARE_CHESTER_Z) ||                 \
@@ -880,14 +734,15 @@ static atomic_t m_report_rate_hourly_counter = 0;
 static atomic_t m_report_rate_timer_is_active = false;
 static atomic_t m_report_delay_timer_is_active = false;
 
-static void report_delay_timer_handler(struct k_timer *timer)
+/* Runs on the work queue as starting the send task must not happen from an ISR */
+static void report_delay_work_handler(struct k_work *work)
 {
 	app_work_send();
 	atomic_inc(&m_report_rate_hourly_counter);
 	atomic_set(&m_report_delay_timer_is_active, false);
 }
 
-static K_TIMER_DEFINE(m_report_delay_timer, report_delay_timer_handler, NULL);
+static K_WORK_DELAYABLE_DEFINE(m_report_delay_work, report_delay_work_handler);
 
 static void report_rate_timer_handler(struct k_timer *timer)
 {
@@ -910,8 +765,8 @@ void app_work_send_with_rate_limit(void)
 	if (atomic_get(&m_report_rate_hourly_counter) <= g_app_config.event_report_rate) {
 		if (!atomic_set(&m_report_delay_timer_is_active, true)) {
 			LOG_INF("Starting delay timer");
-			k_timer_start(&m_report_delay_timer,
-				      K_SECONDS(g_app_config.event_report_delay), K_NO_WAIT);
+			k_work_schedule_for_queue(&m_work_q, &m_report_delay_work,
+						  K_SECONDS(g_app_config.event_report_delay));
 		} else {
 			LOG_INF("Delay timer already running");
 		}
@@ -8,6 +8,7 @@
 #include "app_codec.h"
 #include "app_config.h"
 #include "app_data.h"
+#include "app_sensor.h"
 
 /* CHESTER includes */
 #include <chester/ctr_cloud.h>
@@ -435,6 +436,8 @@ static int encode(zcbor_state_t *zs)
 			for (int ch_index = 0; ch_index < APP_DATA_NUM_CHANNELS; ch_index++) {
 				struct app_data_counter *counter = g_app_data.counter[ch_index];
 				if (counter) {
+					app_sensor_counter_sync(counter);
+
 					zcbor_map_start_encode(zs,
 							       ZCBOR_VALUE_IS_INDEFINITE_LENGTH);
 
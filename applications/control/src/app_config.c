@@ -69,6 +69,9 @@ const struct ctr_config_item items[] = {
 	CTR_CONFIG_ITEM_INT("counter-duration-active", m_config_interim.counter_duration_active, 0, 60000, "Get/Set event active duration in milliseconds.", 2),
 	CTR_CONFIG_ITEM_INT("counter-duration-inactive", m_config_interim.counter_duration_inactive, 0, 60000, "Get/Set event inactive duration in milliseconds.", 2),
 	CTR_CONFIG_ITEM_INT("counter-cooldown-time", m_config_interim.counter_cooldown_time, 0, 60000, "Get/Set counter cooldown time in milliseconds.", 10),
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+	CTR_CONFIG_ITEM_BOOL("counter-hw", m_config_interim.counter_hw, "Get/Set hardware pulse counting (cooldown time is the hold-off, durations are ignored).", false),
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
 	CTR_CONFIG_ITEM_INT("analog-interval-sample", m_config_interim.analog_interval_sample, 1, 86400, "Get/Set analog sample interval in seconds.", 60),
 	CTR_CONFIG_ITEM_INT("analog-interval-aggreg", m_config_interim.analog_interval_aggreg, 1, 86400, "Get/Set analog aggregation interval in seconds.", 300),
 #endif /* defined(FEATURE_HARDWARE_CHESTER_X0_A) */
@@ -176,6 +179,7 @@ static int init(void)
 	/* ^^^ Preserved code "init" (end) */
 
 	ctr_config_append_show(SETTINGS_PFX, app_config_cmd_config_show);
+	ctr_config_append_items(items, ARRAY_SIZE(items));
 
 	return 0;
 }
@@ -83,6 +83,9 @@ struct app_config {
 	int counter_duration_active;
 	int counter_duration_inactive;
 	int counter_cooldown_time;
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+	bool counter_hw;
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
 	int analog_interval_sample;
 	int analog_interval_aggreg;
 #endif /* defined(FEATURE_HARDWARE_CHESTER_X0_A) */
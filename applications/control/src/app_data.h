@@ -10,6 +10,7 @@
 /* CHESTER includes */
 #include <chester/ctr_edge.h>
 #include <chester/ctr_ble_tag.h>
+#include <chester/ctr_pulse.h>
 #include <chester/application/ctr_data.h>
 
 /* Standard includes */
@@ -94,6 +95,12 @@ struct app_data_counter_measurement {
 
 struct app_data_counter {
 	struct ctr_edge edge;
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+	/* Hardware counting - value and delta are updated by app_sensor_counter_sync() */
+	struct ctr_pulse pulse;
+	bool is_pulse;
+	uint64_t pulse_last;
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
 	int64_t timestamp;
 	uint64_t value;
 	uint64_t last_value;
@@ -22,6 +22,7 @@
 #include <chester/ctr_led.h>
 #include <chester/ctr_lrw.h>
 #include <chester/ctr_lte.h>
+#include <chester/ctr_pulse.h>
 #include <chester/ctr_wdog.h>
 #include <chester/drivers/ctr_x0.h>
 #include <chester/drivers/ctr_z.h>
@@ -131,9 +132,8 @@ static int init_chester_z(void)
 
 #if defined(FEATURE_HARDWARE_CHESTER_X0_A)
 
-static int init_edge(struct ctr_edge *edge, ctr_edge_cb_t cb, const struct device *dev,
-		     enum ctr_x0_channel channel, enum ctr_x0_mode mode, int active_duration,
-		     int inactive_duration, int cooldown_time, void *user_data)
+static int init_input(const struct device *dev, enum ctr_x0_channel channel,
+		      enum ctr_x0_mode mode, const struct gpio_dt_spec **spec_out)
 {
 	int ret;
 
@@ -170,6 +170,24 @@ static int init_edge(struct ctr_edge *edge, ctr_edge_cb_t cb, const struct devic
 		}
 	}
 
+	*spec_out = spec;
+
+	return 0;
+}
+
+static int init_edge(struct ctr_edge *edge, ctr_edge_cb_t cb, const struct device *dev,
+		     enum ctr_x0_channel channel, enum ctr_x0_mode mode, int active_duration,
+		     int inactive_duration, int cooldown_time, void *user_data)
+{
+	int ret;
+
+	const struct gpio_dt_spec *spec;
+	ret = init_input(dev, channel, mode, &spec);
+	if (ret) {
+		LOG_ERR("Call `init_input` failed: %d", ret);
+		return ret;
+	}
+
 	ret = ctr_edge_init(edge, spec, false);
 	if (ret) {
 		LOG_ERR("Call `ctr_edge_init` failed: %d", ret);
@@ -209,6 +227,41 @@ static int init_edge(struct ctr_edge *edge, ctr_edge_cb_t cb, const struct devic
 	return 0;
 }
 
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+
+static int init_pulse(struct ctr_pulse *pulse, const struct device *dev,
+		      enum ctr_x0_channel channel, enum ctr_x0_mode mode, int cooldown_time)
+{
+	int ret;
+
+	const struct gpio_dt_spec *spec;
+	ret = init_input(dev, channel, mode, &spec);
+	if (ret) {
+		LOG_ERR("Call `init_input` failed: %d", ret);
+		return ret;
+	}
+
+	/* Count transitions to the active level */
+	enum ctr_pulse_edge edge =
+		mode == CTR_X0_MODE_NPN_INPUT ? CTR_PULSE_EDGE_FALLING : CTR_PULSE_EDGE_RISING;
+
+	ret = ctr_pulse_init(pulse, spec, edge, cooldown_time * 1000);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_init` failed: %d", ret);
+		return ret;
+	}
+
+	ret = ctr_pulse_start(pulse);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_start` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
+
 static enum ctr_x0_channel x0_channel_lookup[] = {
 	CTR_X0_CHANNEL_1, CTR_X0_CHANNEL_2, CTR_X0_CHANNEL_3, CTR_X0_CHANNEL_4,
 #if defined(FEATURE_HARDWARE_CHESTER_X0_B)
@@ -302,6 +355,21 @@ static int init_chester_x0_counters(const struct device *dev, int ch_start, int
 			}
 			memset(g_app_data.counter[ch_idx], 0, sizeof(struct app_data_counter));
 
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+			if (g_app_config.counter_hw) {
+				ret = init_pulse(&g_app_data.counter[ch_idx]->pulse, dev,
+						 x0_channel_lookup[ch_idx], counter_mode,
+						 g_app_config.counter_cooldown_time);
+				if (!ret) {
+					g_app_data.counter[ch_idx]->is_pulse = true;
+					continue;
+				}
+
+				/* Out of TIMER instances - count this channel in software */
+				LOG_WRN("Channel %d falls back to edge counting: %d", ch_idx, ret);
+			}
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
+
 			/* Initialize channel */
 			ret = init_edge(&g_app_data.counter[ch_idx]->edge,
 					app_handler_edge_counter_callback, dev,
@@ -12,9 +12,11 @@
 /* CHESTER includes */
 #include <chester/ctr_accel.h>
 #include <chester/ctr_adc.h>
+#include <chester/ctr_aggreg.h>
 #include <chester/ctr_ble_tag.h>
 #include <chester/ctr_ds18b20.h>
 #include <chester/ctr_hygro.h>
+#include <chester/ctr_pulse.h>
 #include <chester/ctr_rtc.h>
 #include <chester/ctr_soil_sensor.h>
 #include <chester/ctr_therm.h>
@@ -39,46 +41,11 @@ LOG_MODULE_REGISTER(app_sensor, LOG_LEVEL_DBG);
 
 #define BATT_TEST_INTERVAL_MSEC (12 * 60 * 60 * 1000)
 
-static int compare(const void *a, const void *b)
-{
-	float fa = *(const float *)a;
-	float fb = *(const float *)b;
-
-	return (fa > fb) - (fa < fb);
-}
-
-__unused static void aggreg(float *samples, size_t count, float *minimum, float *maximum,
-			    float *average, float *median)
-{
-	if (count < 1) {
-		*minimum = NAN;
-		*maximum = NAN;
-		*average = NAN;
-		*median = NAN;
-
-		return;
-	}
-
-	qsort(samples, count, sizeof(float), compare);
-
-	*minimum = samples[0];
-	*maximum = samples[count - 1];
-
-	double average_ = 0;
-	for (size_t i = 0; i < count; i++) {
-		average_ += (double)samples[i];
-	}
-	average_ /= count;
-
-	*average = average_;
-	*median = samples[count / 2];
-}
-
 #if defined(FEATURE_HARDWARE_CHESTER_X0_A) || defined(FEATURE_SUBSYSTEM_DS18B20)
 
 __unused static void aggreg_sample(float *samples, size_t count, struct ctr_data_aggreg *sample)
 {
-	aggreg(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
+	ctr_aggreg_array(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
 }
 
 #endif /* defined(FEATURE_HARDWARE_CHESTER_X0_A) || defined(FEATURE_SUBSYSTEM_DS18B20) */
@@ -135,6 +102,29 @@ void app_sensor_trigger_clear(void)
 	app_data_unlock();
 }
 
+/* Has to be called with app data locked */
+void app_sensor_counter_sync(struct app_data_counter *counter)
+{
+#if defined(FEATURE_SUBSYSTEM_PULSE)
+	int ret;
+
+	if (!counter->is_pulse) {
+		return;
+	}
+
+	uint64_t count;
+	ret = ctr_pulse_read(&counter->pulse, &count);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_read` failed: %d", ret);
+		return;
+	}
+
+	counter->value += count - counter->pulse_last;
+	counter->delta += count - counter->pulse_last;
+	counter->pulse_last = count;
+#endif /* defined(FEATURE_SUBSYSTEM_PULSE) */
+}
+
 int app_sensor_counter_aggreg(void)
 {
 	int ret;
@@ -144,6 +134,8 @@ int app_sensor_counter_aggreg(void)
 	for (int i = 0; i < APP_DATA_NUM_CHANNELS; i++) {
 		struct app_data_counter *counter = g_app_data.counter[i];
 		if (counter) {
+			app_sensor_counter_sync(counter);
+
 			if (!counter->measurement_count) {
 				ret = ctr_rtc_get_ts(&counter->timestamp);
 				if (ret) {
@@ -476,20 +468,29 @@ void app_sensor_hygro_clear(void)
 int app_sensor_w1_therm_sample(void)
 {
 	int ret;
-	uint64_t serial_number;
 
-	for (int i = 0; i < g_app_data.w1_therm.sensor_count; i++) {
+	struct ctr_ds18b20_sample samples[APP_DATA_W1_THERM_MAX_COUNT];
+
+	ret = ctr_ds18b20_read_all(samples, ARRAY_SIZE(samples));
+	if (ret < 0) {
+		LOG_ERR("Call `ctr_ds18b20_read_all` failed: %d", ret);
+		return ret;
+	}
+
+	int count = ret;
+
+	for (int i = 0; i < MIN(g_app_data.w1_therm.sensor_count, count); i++) {
 		if (g_app_data.w1_therm.sensor[i].sample_count < APP_DATA_W1_THERM_MAX_SAMPLES) {
-			float temperature = NAN;
-			ret = ctr_ds18b20_read(i, &serial_number, &temperature);
+			float temperature = samples[i].temperature;
+			uint64_t serial_number = samples[i].serial_number;
 
-			if (ret) {
-				LOG_ERR("Call `ctr_ds18b20_read` failed: %d", ret);
+			if (isnan(temperature)) {
+				LOG_ERR("Sensor %d not read", i);
 				continue;
-			} else {
-				LOG_INF("Temperature: %.1f C", (double)temperature);
 			}
 
+			LOG_INF("Temperature: %.1f C", (double)temperature);
+
 			app_data_lock();
 			struct app_data_w1_therm_sensor *sensor = &g_app_data.w1_therm.sensor[i];
 			sensor->last_sample_temperature = temperature;
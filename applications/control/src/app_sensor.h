@@ -7,6 +7,8 @@
 #ifndef APP_SENSOR_H_
 #define APP_SENSOR_H_
 
+#include "app_data.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,6 +17,7 @@ int app_sensor_sample(void);
 
 void app_sensor_trigger_clear(void);
 int app_sensor_counter_aggreg(void);
+void app_sensor_counter_sync(struct app_data_counter *counter);
 void app_sensor_counter_clear(void);
 int app_sensor_voltage_sample(void);
 int app_sensor_voltage_aggreg(void);
@@ -161,6 +161,8 @@ static void channel_print(const struct shell *shell, int ch_idx)
 	} else if (g_app_data.counter[ch_idx]) {
 		struct app_data_counter *c = g_app_data.counter[ch_idx];
 
+		app_sensor_counter_sync(c);
+
 		shell_print(shell, "channel %d: counter, value: %llu, delta: %llu", ch_num,
 			    c->value, c->delta);
 	} else if (g_app_data.voltage[ch_idx]) {
@@ -30,6 +30,7 @@
 #define FEATURE_SUBSYSTEM_LOG                   1
 #define FEATURE_SUBSYSTEM_LRW                   1
 #define FEATURE_SUBSYSTEM_LTE_V2                1
+#define FEATURE_SUBSYSTEM_PULSE                 1
 #define FEATURE_SUBSYSTEM_RTC                   1
 #define FEATURE_SUBSYSTEM_SHELL                 1
 #define FEATURE_SUBSYSTEM_SOIL_SENSOR           1
@@ -271,6 +271,7 @@ static int init(void)
 	/* ^^^ Preserved code "init" (end) */
 
 	ctr_config_append_show(SETTINGS_PFX, app_config_cmd_config_show);
+	ctr_config_append_items(items, ARRAY_SIZE(items));
 
 	return 0;
 }
@@ -10,6 +10,7 @@
 
 /* CHESTER includes */
 #include <chester/ctr_accel.h>
+#include <chester/ctr_aggreg.h>
 #include <chester/ctr_ds18b20.h>
 #include <chester/ctr_rtc.h>
 #include <chester/ctr_therm.h>
@@ -30,49 +31,9 @@
 
 LOG_MODULE_REGISTER(app_measure, LOG_LEVEL_DBG);
 
-static int compare(const void *a, const void *b)
-{
-	float fa = *(const float *)a;
-	float fb = *(const float *)b;
-
-	return (fa > fb) - (fa < fb);
-}
-
-static void aggreg(float *samples, size_t count, float *min, float *max, float *avg, float *mdn)
-{
-	*min = NAN;
-	*max = NAN;
-	*avg = NAN;
-	*mdn = NAN;
-
-	if (!count) {
-		return;
-	}
-
-	for (size_t i = 0; i < count; i++) {
-		if (isnan(samples[i])) {
-			return;
-		}
-	}
-
-	qsort(samples, count, sizeof(float), compare);
-
-	*min = samples[0];
-	*max = samples[count - 1];
-
-	double avg_ = 0;
-	for (size_t i = 0; i < count; i++) {
-		avg_ += (double)samples[i];
-	}
-	avg_ /= count;
-
-	*avg = avg_;
-	*mdn = samples[count / 2];
-}
-
 __unused static void aggreg_sample(float *samples, size_t count, struct ctr_data_aggreg *sample)
 {
-	aggreg(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
+	ctr_aggreg_array(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
 }
 
 #if defined(FEATURE_HARDWARE_CHESTER_K1)
@@ -16,6 +16,7 @@
 /* CHESTER includes */
 #include <chester/ctr_accel.h>
 #include <chester/ctr_adc.h>
+#include <chester/ctr_aggreg.h>
 #include <chester/ctr_ble_tag.h>
 #include <chester/ctr_ds18b20.h>
 #include <chester/ctr_gpio.h>
@@ -45,49 +46,9 @@
 
 LOG_MODULE_REGISTER(app_sensor, LOG_LEVEL_DBG);
 
-static int compare(const void *a, const void *b)
-{
-	float fa = *(const float *)a;
-	float fb = *(const float *)b;
-
-	return (fa > fb) - (fa < fb);
-}
-
-static void aggreg(float *samples, size_t count, float *min, float *max, float *avg, float *mdn)
-{
-	*min = NAN;
-	*max = NAN;
-	*avg = NAN;
-	*mdn = NAN;
-
-	if (!count) {
-		return;
-	}
-
-	for (size_t i = 0; i < count; i++) {
-		if (isnan(samples[i])) {
-			return;
-		}
-	}
-
-	qsort(samples, count, sizeof(float), compare);
-
-	*min = samples[0];
-	*max = samples[count - 1];
-
-	double avg_ = 0;
-	for (size_t i = 0; i < count; i++) {
-		avg_ += (double)samples[i];
-	}
-	avg_ /= count;
-
-	*avg = avg_;
-	*mdn = samples[count / 2];
-}
-
 __unused static void aggreg_sample(float *samples, size_t count, struct ctr_data_aggreg *sample)
 {
-	aggreg(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
+	ctr_aggreg_array(samples, count, &sample->min, &sample->max, &sample->avg, &sample->mdn);
 }
 
 int app_sensor_sample(void)
@@ -754,14 +715,23 @@ int app_sensor_w1_therm_sample(void)
 {
 	int ret;
 
-	uint64_t serial_number;
+	struct ctr_ds18b20_sample samples[APP_DATA_W1_THERM_COUNT];
 
-	for (int i = 0; i < MIN(APP_DATA_W1_THERM_COUNT, ctr_ds18b20_get_count()); i++) {
+	ret = ctr_ds18b20_read_all(samples, ARRAY_SIZE(samples));
+	if (ret < 0) {
+		LOG_ERR("Call `ctr_ds18b20_read_all` failed: %d", ret);
+		return ret;
+	}
+
+	int count = ret;
+
+	for (int i = 0; i < MIN(APP_DATA_W1_THERM_COUNT, count); i++) {
 		if (g_app_data.w1_therm.sensor[i].sample_count < APP_DATA_MAX_SAMPLES) {
-			float temperature;
-			ret = ctr_ds18b20_read(i, &serial_number, &temperature);
-			if (ret) {
-				LOG_ERR("Call `ctr_ds18b20_read` failed: %d", ret);
+			float temperature = samples[i].temperature;
+			uint64_t serial_number = samples[i].serial_number;
+
+			if (isnan(temperature)) {
+				LOG_ERR("Sensor %d not read", i);
 				continue;
 			}
 
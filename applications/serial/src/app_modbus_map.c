@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "app_modbus_map.h"
+#include "app_modbus.h"
+
+/* Zephyr includes */
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(app_modbus_map, LOG_LEVEL_DBG);
+
+static uint16_t type_regs(enum app_modbus_map_type type)
+{
+	switch (type) {
+	case APP_MODBUS_MAP_U16:
+	case APP_MODBUS_MAP_S16:
+		return 1;
+	case APP_MODBUS_MAP_S64:
+		return 4;
+	default:
+		return 2;
+	}
+}
+
+static float decode(const uint16_t *regs, enum app_modbus_map_type type)
+{
+	uint32_t u32;
+
+	switch (type) {
+	case APP_MODBUS_MAP_U16:
+		return regs[0];
+	case APP_MODBUS_MAP_S16:
+		return (int16_t)regs[0];
+	case APP_MODBUS_MAP_U32:
+		return ((uint32_t)regs[0] << 16) | regs[1];
+	case APP_MODBUS_MAP_S32:
+		return (int32_t)(((uint32_t)regs[0] << 16) | regs[1]);
+	case APP_MODBUS_MAP_U32_LSW:
+		return ((uint32_t)regs[1] << 16) | regs[0];
+	case APP_MODBUS_MAP_S32_LSW:
+		return (int32_t)(((uint32_t)regs[1] << 16) | regs[0]);
+	case APP_MODBUS_MAP_FLOAT32:
+	case APP_MODBUS_MAP_FLOAT32_LSW: {
+		float f;
+		u32 = type == APP_MODBUS_MAP_FLOAT32 ? ((uint32_t)regs[0] << 16) | regs[1]
+						     : ((uint32_t)regs[1] << 16) | regs[0];
+		memcpy(&f, &u32, sizeof(f));
+		return f;
+	}
+	case APP_MODBUS_MAP_S64:
+		return (int64_t)(((uint64_t)regs[0] << 48) | ((uint64_t)regs[1] << 32) |
+				 ((uint64_t)regs[2] << 16) | regs[3]);
+	default:
+		return NAN;
+	}
+}
+
+static int read_regs(uint8_t slave_addr, enum app_modbus_map_func func, uint16_t reg,
+		     uint16_t count, uint16_t *data)
+{
+	if (func == APP_MODBUS_MAP_INPUT) {
+		return app_modbus_read_input_regs(slave_addr, reg, count, data);
+	}
+
+	return app_modbus_read_holding_regs(slave_addr, reg, count, data);
+}
+
+static void store(const struct app_modbus_map_entry *entry, const uint16_t *regs)
+{
+	float scale = entry->scale ? entry->scale : 1.f;
+
+	*entry->dest = regs ? decode(regs, entry->type) * scale : NAN;
+}
+
+int app_modbus_map_read(uint8_t slave_addr, enum app_modbus_map_func func,
+			const struct app_modbus_map_entry *map, size_t count, uint16_t max_gap)
+{
+	int ret;
+	int res = 0;
+	int reads = 0;
+
+	for (size_t i = 1; i < count; i++) {
+		if (map[i].reg < map[i - 1].reg) {
+			LOG_ERR("Map not sorted at entry: %zu", i);
+			return -EINVAL;
+		}
+	}
+
+	uint16_t regs[APP_MODBUS_MAP_MAX_REGS];
+
+	for (size_t i = 0; i < count;) {
+		uint32_t start = map[i].reg;
+		uint32_t end = start + type_regs(map[i].type);
+
+		/* Extend the read while the next entry is close enough and the request fits */
+		size_t j;
+		for (j = i + 1; j < count; j++) {
+			uint32_t reg_end = map[j].reg + type_regs(map[j].type);
+
+			if (map[j].reg > end + max_gap ||
+			    MAX(end, reg_end) - start > ARRAY_SIZE(regs)) {
+				break;
+			}
+
+			end = MAX(end, reg_end);
+		}
+
+		reads++;
+
+		ret = read_regs(slave_addr, func, start, end - start, regs);
+		if (!ret) {
+			for (size_t k = i; k < j; k++) {
+				store(&map[k], &regs[map[k].reg - start]);
+			}
+		} else if (ret != -ETIMEDOUT && j - i > 1) {
+			LOG_WRN("Joined read 0x%04x/%u failed: %d - reading entries one by one",
+				start, end - start, ret);
+
+			for (size_t k = i; k < j; k++) {
+				reads++;
+
+				ret = read_regs(slave_addr, func, map[k].reg,
+						type_regs(map[k].type), regs);
+				store(&map[k], ret ? NULL : regs);
+				res = ret ? -EIO : res;
+			}
+		} else {
+			for (size_t k = i; k < j; k++) {
+				store(&map[k], NULL);
+			}
+
+			res = -EIO;
+		}
+
+		i = j;
+	}
+
+	LOG_DBG("Read %zu entries in %d request(s)", count, reads);
+
+	return res;
+}
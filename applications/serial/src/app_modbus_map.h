@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef APP_MODBUS_MAP_H_
+#define APP_MODBUS_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Modbus limit for a single function 03/04 request */
+#define APP_MODBUS_MAP_MAX_REGS 125
+
+/* Default number of unmapped registers read over to join two reads */
+#define APP_MODBUS_MAP_DEFAULT_GAP 8
+
+enum app_modbus_map_func {
+	APP_MODBUS_MAP_HOLDING = 0,
+	APP_MODBUS_MAP_INPUT = 1,
+};
+
+enum app_modbus_map_type {
+	APP_MODBUS_MAP_U16 = 0,
+	APP_MODBUS_MAP_S16 = 1,
+	/* 32-bit types with high word first */
+	APP_MODBUS_MAP_U32 = 2,
+	APP_MODBUS_MAP_S32 = 3,
+	APP_MODBUS_MAP_FLOAT32 = 4,
+	/* 32-bit types with low word first */
+	APP_MODBUS_MAP_U32_LSW = 5,
+	APP_MODBUS_MAP_S32_LSW = 6,
+	APP_MODBUS_MAP_FLOAT32_LSW = 7,
+	/* 64-bit signed with high word first */
+	APP_MODBUS_MAP_S64 = 8,
+};
+
+/**
+ * @brief Register map entry
+ *
+ * The decoded value is multiplied by @p scale (0 is treated as 1) and stored to @p dest.
+ */
+struct app_modbus_map_entry {
+	uint16_t reg;
+	enum app_modbus_map_type type;
+	float scale;
+	float *dest;
+};
+
+/**
+ * @brief Read a register map with the fewest Modbus transactions
+ *
+ * Entries must be sorted by register address. Registers closer than @p max_gap are read in one
+ * request of at most APP_MODBUS_MAP_MAX_REGS registers. If a joined request is rejected by the
+ * device (other than by timeout), its entries are read one by one.
+ *
+ * @param slave_addr Modbus slave address (1-247)
+ * @param func Holding (03) or input (04) registers
+ * @param map Register map
+ * @param count Number of entries in @p map
+ * @param max_gap Maximum number of unmapped registers read over
+ * @return 0 on success, -EIO if some entries failed (their destination is set to NAN),
+ *         other negative error code on failure
+ */
+int app_modbus_map_read(uint8_t slave_addr, enum app_modbus_map_func func,
+			const struct app_modbus_map_entry *map, size_t count, uint16_t max_gap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_MODBUS_MAP_H_ */
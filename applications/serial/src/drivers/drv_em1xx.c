@@ -7,6 +7,7 @@
 #include "drv_em1xx.h"
 #include "drv_interface.h"
 #include "../app_modbus.h"
+#include "../app_modbus_map.h"
 
 #include <chester/ctr_rtc.h>
 
@@ -23,13 +24,6 @@ LOG_MODULE_REGISTER(drv_em1xx, LOG_LEVEL_DBG);
 
 #define MAX_SAMPLES 32
 
-/* Decode INT32 Low Word First (Carlo Gavazzi format) */
-static int32_t decode_int32_lsw(const uint16_t *regs)
-{
-	uint32_t value = ((uint32_t)regs[1] << 16) | regs[0];
-	return (int32_t)value;
-}
-
 /* Parse parity string (e.g., "8E1", "8N1") */
 static int parse_parity(const char *str, char *parity, int *stop_bits)
 {
@@ -95,8 +89,6 @@ static int init(void)
 static int sample(void)
 {
 	int ret;
-	uint16_t regs[2];
-	int32_t val;
 	uint8_t addr;
 
 	k_mutex_lock(&m_data_mutex, K_FOREVER);
@@ -118,122 +110,29 @@ static int sample(void)
 	float current, voltage, power, frequency, energy_in, energy_out;
 	float power_apparent, power_reactive, power_factor;
 
-	/* Read Current (0x0100) */
-	ret = app_modbus_read_holding_regs(addr, REG_CURRENT, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read current: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	current = (float)val / 1000.0f;
-
-	/* Read Voltage (0x0102) */
-	ret = app_modbus_read_holding_regs(addr, REG_VOLTAGE, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read voltage: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	voltage = (float)val / 10.0f;
-
-	/* Read Power (0x0106) */
-	ret = app_modbus_read_holding_regs(addr, REG_POWER, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read power: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	power = (float)val / 10000.0f;
-
-	/* Read Apparent power (0x0108) */
-	ret = app_modbus_read_holding_regs(addr, REG_APPARENT, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read apparent power: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	power_apparent = (float)val / 10000.0f;
-
-	/* Read Reactive power (0x010A) */
-	ret = app_modbus_read_holding_regs(addr, REG_REACTIVE, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read reactive power: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	power_reactive = (float)val / 10000.0f;
-
-	/* Read Power factor (0x010C) */
-	ret = app_modbus_read_holding_regs(addr, REG_PF, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read power factor: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	power_factor = (float)val / 1000.0f;
-
-	/* Read Frequency (0x0110) */
-	ret = app_modbus_read_holding_regs(addr, REG_FREQUENCY, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read frequency: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	frequency = (float)val / 10.0f;
-
-	/* Read Energy IN (0x0112) */
-	ret = app_modbus_read_holding_regs(addr, REG_ENERGY_IN, 2, regs);
-	if (ret) {
-		LOG_ERR("Failed to read energy_in: %d", ret);
-		k_mutex_lock(&m_data_mutex, K_FOREVER);
-		m_data.error_count++;
-		m_data.valid = false;
-		k_mutex_unlock(&m_data_mutex);
-		goto out;
-	}
-	val = decode_int32_lsw(regs);
-	energy_in = (float)val / 10.0f;
-
-	/* Read Energy OUT (0x0116) */
-	ret = app_modbus_read_holding_regs(addr, REG_ENERGY_OUT, 2, regs);
+	/* INT32 low word first (Carlo Gavazzi format) - read as a single request (0x0100-0x0117) */
+	const struct app_modbus_map_entry map[] = {
+		{REG_CURRENT, APP_MODBUS_MAP_S32_LSW, 0.001f, &current},
+		{REG_VOLTAGE, APP_MODBUS_MAP_S32_LSW, 0.1f, &voltage},
+		{REG_POWER, APP_MODBUS_MAP_S32_LSW, 0.0001f, &power},
+		{REG_APPARENT, APP_MODBUS_MAP_S32_LSW, 0.0001f, &power_apparent},
+		{REG_REACTIVE, APP_MODBUS_MAP_S32_LSW, 0.0001f, &power_reactive},
+		{REG_PF, APP_MODBUS_MAP_S32_LSW, 0.001f, &power_factor},
+		{REG_FREQUENCY, APP_MODBUS_MAP_S32_LSW, 0.1f, &frequency},
+		{REG_ENERGY_IN, APP_MODBUS_MAP_S32_LSW, 0.1f, &energy_in},
+		{REG_ENERGY_OUT, APP_MODBUS_MAP_S32_LSW, 0.1f, &energy_out},
+	};
+
+	ret = app_modbus_map_read(addr, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
 	if (ret) {
-		LOG_ERR("Failed to read energy_out: %d", ret);
+		LOG_ERR("Call `app_modbus_map_read` failed: %d", ret);
 		k_mutex_lock(&m_data_mutex, K_FOREVER);
 		m_data.error_count++;
 		m_data.valid = false;
 		k_mutex_unlock(&m_data_mutex);
 		goto out;
 	}
-	val = decode_int32_lsw(regs);
-	energy_out = (float)val / 10.0f;
 
 	/* Update m_data atomically */
 	k_mutex_lock(&m_data_mutex, K_FOREVER);
@@ -7,6 +7,7 @@
 #include "drv_or_we_516.h"
 #include "drv_interface.h"
 #include "../app_modbus.h"
+#include "../app_modbus_map.h"
 
 #include <chester/ctr_rtc.h>
 
@@ -23,17 +24,6 @@ LOG_MODULE_REGISTER(drv_or_we_516, LOG_LEVEL_DBG);
 
 #define MAX_SAMPLES 32
 
-/* Decode Float32 Big Endian (standard Modbus format) */
-static float decode_float32_be(const uint16_t *regs)
-{
-	union {
-		uint32_t u;
-		float f;
-	} conv;
-	conv.u = ((uint32_t)regs[0] << 16) | regs[1];
-	return conv.f;
-}
-
 /* OR-WE-516 Register addresses (Float32 BE) */
 #define REG_VOLTAGE_L1        0x000E
 #define REG_VOLTAGE_L2        0x0010
@@ -76,17 +66,6 @@ static struct or_we_516_sample m_samples[MAX_SAMPLES];
 static int m_sample_count = 0;
 static K_MUTEX_DEFINE(m_samples_mutex);
 
-static int read_float32(uint8_t addr, uint16_t reg, float *out)
-{
-	uint16_t regs[2];
-	int ret = app_modbus_read_holding_regs(addr, reg, 2, regs);
-	if (ret) {
-		return ret;
-	}
-	*out = decode_float32_be(regs);
-	return 0;
-}
-
 /* Forward declaration */
 static void print_data(const struct shell *shell, int idx, int addr);
 
@@ -101,7 +80,6 @@ static int init(void)
 static int sample(void)
 {
 	int ret;
-	int errors = 0;
 	uint8_t addr;
 
 	/* Local variables for values */
@@ -128,49 +106,44 @@ static int sample(void)
 		return ret;
 	}
 
-	/* Per-phase voltages */
-	if (read_float32(addr, REG_VOLTAGE_L1, &voltage_l1)) errors++;
-	if (read_float32(addr, REG_VOLTAGE_L2, &voltage_l2)) errors++;
-	if (read_float32(addr, REG_VOLTAGE_L3, &voltage_l3)) errors++;
-
-	/* Frequency */
-	if (read_float32(addr, REG_FREQUENCY, &frequency)) errors++;
-
-	/* Per-phase currents */
-	if (read_float32(addr, REG_CURRENT_L1, &current_l1)) errors++;
-	if (read_float32(addr, REG_CURRENT_L2, &current_l2)) errors++;
-	if (read_float32(addr, REG_CURRENT_L3, &current_l3)) errors++;
-
-	/* Power */
-	if (read_float32(addr, REG_POWER, &power)) errors++;
-	if (read_float32(addr, REG_POWER_L1, &power_l1)) errors++;
-	if (read_float32(addr, REG_POWER_L2, &power_l2)) errors++;
-	if (read_float32(addr, REG_POWER_L3, &power_l3)) errors++;
-	if (read_float32(addr, REG_POWER_REACTIVE, &power_reactive)) errors++;
-	if (read_float32(addr, REG_POWER_APPARENT, &power_apparent)) errors++;
-	if (read_float32(addr, REG_POWER_FACTOR, &power_factor)) errors++;
-
-	/* Per-phase power factor */
-	if (read_float32(addr, REG_PF_L1, &power_factor_l1)) errors++;
-	if (read_float32(addr, REG_PF_L2, &power_factor_l2)) errors++;
-	if (read_float32(addr, REG_PF_L3, &power_factor_l3)) errors++;
-
-	/* Energy */
-	if (read_float32(addr, REG_ENERGY, &energy)) errors++;
-	if (read_float32(addr, REG_ENERGY_L1, &energy_l1)) errors++;
-	if (read_float32(addr, REG_ENERGY_L2, &energy_l2)) errors++;
-	if (read_float32(addr, REG_ENERGY_L3, &energy_l3)) errors++;
-	if (read_float32(addr, REG_ENERGY_IN, &energy_in)) errors++;
-	if (read_float32(addr, REG_ENERGY_OUT, &energy_out)) errors++;
-	if (read_float32(addr, REG_ENERGY_REACTIVE, &energy_reactive)) errors++;
-	if (read_float32(addr, REG_ENERGY_REACTIVE_IN, &energy_reactive_in)) errors++;
-	if (read_float32(addr, REG_ENERGY_REACTIVE_OUT, &energy_reactive_out)) errors++;
+	/* Sorted by register - read as two requests (0x000E-0x003B and 0x0100-0x0129) */
+	const struct app_modbus_map_entry map[] = {
+		{REG_VOLTAGE_L1, APP_MODBUS_MAP_FLOAT32, 1.f, &voltage_l1},
+		{REG_VOLTAGE_L2, APP_MODBUS_MAP_FLOAT32, 1.f, &voltage_l2},
+		{REG_VOLTAGE_L3, APP_MODBUS_MAP_FLOAT32, 1.f, &voltage_l3},
+		{REG_FREQUENCY, APP_MODBUS_MAP_FLOAT32, 1.f, &frequency},
+		{REG_CURRENT_L1, APP_MODBUS_MAP_FLOAT32, 1.f, &current_l1},
+		{REG_CURRENT_L2, APP_MODBUS_MAP_FLOAT32, 1.f, &current_l2},
+		{REG_CURRENT_L3, APP_MODBUS_MAP_FLOAT32, 1.f, &current_l3},
+		{REG_POWER, APP_MODBUS_MAP_FLOAT32, 1.f, &power},
+		{REG_POWER_L1, APP_MODBUS_MAP_FLOAT32, 1.f, &power_l1},
+		{REG_POWER_L2, APP_MODBUS_MAP_FLOAT32, 1.f, &power_l2},
+		{REG_POWER_L3, APP_MODBUS_MAP_FLOAT32, 1.f, &power_l3},
+		{REG_POWER_REACTIVE, APP_MODBUS_MAP_FLOAT32, 1.f, &power_reactive},
+		{REG_POWER_APPARENT, APP_MODBUS_MAP_FLOAT32, 1.f, &power_apparent},
+		{REG_POWER_FACTOR, APP_MODBUS_MAP_FLOAT32, 1.f, &power_factor},
+		{REG_PF_L1, APP_MODBUS_MAP_FLOAT32, 1.f, &power_factor_l1},
+		{REG_PF_L2, APP_MODBUS_MAP_FLOAT32, 1.f, &power_factor_l2},
+		{REG_PF_L3, APP_MODBUS_MAP_FLOAT32, 1.f, &power_factor_l3},
+		{REG_ENERGY, APP_MODBUS_MAP_FLOAT32, 1.f, &energy},
+		{REG_ENERGY_L1, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_l1},
+		{REG_ENERGY_L2, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_l2},
+		{REG_ENERGY_L3, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_l3},
+		{REG_ENERGY_IN, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_in},
+		{REG_ENERGY_OUT, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_out},
+		{REG_ENERGY_REACTIVE, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_reactive},
+		{REG_ENERGY_REACTIVE_IN, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_reactive_in},
+		{REG_ENERGY_REACTIVE_OUT, APP_MODBUS_MAP_FLOAT32, 1.f, &energy_reactive_out},
+	};
+
+	ret = app_modbus_map_read(addr, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
 
 	app_modbus_disable();
 
 	/* Update m_data atomically */
 	k_mutex_lock(&m_data_mutex, K_FOREVER);
-	if (errors == 0) {
+	if (!ret) {
 		m_data.voltage_l1 = voltage_l1;
 		m_data.voltage_l2 = voltage_l2;
 		m_data.voltage_l3 = voltage_l3;
@@ -242,8 +215,8 @@ static int sample(void)
 		m_data.valid = false;
 		m_data.error_count++;
 		k_mutex_unlock(&m_data_mutex);
-		LOG_WRN("OR-WE-516: %d read errors", errors);
-		return -EIO;
+		LOG_WRN("OR-WE-516: read failed: %d", ret);
+		return ret;
 	}
 
 	return 0;
@@ -25,6 +25,7 @@
 /* ### Preserved code "includes" (begin) */
 #include <ctype.h>
 #include "app_data.h"
+#include "wmbus.h"
 /* ^^^ Preserved code "includes" (end) */
 
 LOG_MODULE_REGISTER(app_config, LOG_LEVEL_DBG);
@@ -215,6 +216,9 @@ int app_config_clear_address(void)
 		g_app_config.address[i] = 0;
 	}
 
+	/* The receive path looks addresses up through the index, drop the cleared ones now */
+	wmbus_rebuild_address_index();
+
 	return 0;
 }
 
@@ -349,6 +353,14 @@ static int init(void)
 	/* ^^^ Preserved code "init" (end) */
 
 	ctr_config_append_show(SETTINGS_PFX, app_config_cmd_config_show);
+	ctr_config_append_items(items, ARRAY_SIZE(items));
+
+	/* The address list is stored outside the item table */
+	ret = ctr_config_set_items_partial(items);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_set_items_partial` failed: %d", ret);
+		return ret;
+	}
 
 	return 0;
 }
@@ -222,6 +222,17 @@ int cmd_packet_poll_ts(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+int cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	struct wmbus_stats stats;
+	wmbus_get_stats(&stats);
+
+	shell_print(shell, "received %u, dropped %u, matched %u", stats.received, stats.dropped,
+		    stats.matched);
+
+	return 0;
+}
+
 extern struct sys_heap _system_heap;
 
 int cmd_heap(const struct shell *shell, size_t argc, char **argv)
@@ -275,6 +286,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(poll_ts, NULL, "Get timestamp of last downlink.", cmd_packet_poll_ts, 0, 0),
 
 	SHELL_CMD_ARG(heap, NULL, "Show heap usage.", cmd_heap, 0, 0),
+	SHELL_CMD_ARG(stats, NULL, "Show received frame counters.", cmd_stats, 0, 0),
 
 	SHELL_SUBCMD_SET_END
 );
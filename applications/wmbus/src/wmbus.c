@@ -19,6 +19,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/pm/device.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/byteorder.h>
 
 /* Standard includes */
@@ -35,8 +36,42 @@ LOG_MODULE_REGISTER(wmbus, LOG_LEVEL_DBG);
 #define MBUS_OFFSET_ADDRESS_DEVICE_VERSION 8
 #define MBUS_OFFSET_ADDRESS_DEVICE_TYPE    9
 
+/* Wurth frame: header, command, length, payload (with RSSI) and checksum */
+#define RX_FRAME_MAX_SIZE (3 + UINT8_MAX + 1)
+#define RX_FRAME_COUNT    8
+
+#define RX_THREAD_STACK_SIZE 2048
+#define RX_THREAD_PRIORITY   (K_LOWEST_APPLICATION_THREAD_PRIO - 1)
+
+/* Open addressing hash table of configured addresses, at most half full */
+#define INDEX_BITS 9
+#define INDEX_SIZE BIT(INDEX_BITS)
+
+BUILD_ASSERT(INDEX_SIZE >= 2 * DEVICE_MAX_COUNT);
+
 bool flags[DEVICE_MAX_COUNT];
 
+struct rx_frame {
+	uint16_t len;
+	uint8_t data[RX_FRAME_MAX_SIZE];
+};
+
+/* Single producer (UART ISR) / single consumer (RX thread) frame ring */
+static struct rx_frame m_rx_frames[RX_FRAME_COUNT];
+static atomic_t m_rx_head;
+static atomic_t m_rx_tail;
+static K_SEM_DEFINE(m_rx_sem, 0, 1);
+
+static atomic_t m_stats_received;
+static atomic_t m_stats_dropped;
+static atomic_t m_stats_matched;
+
+/* Slot numbers into g_app_config.address, -1 for an empty slot */
+static int16_t m_index[INDEX_SIZE];
+static size_t m_index_count;
+static size_t m_flags_count;
+static K_MUTEX_DEFINE(m_index_lock);
+
 static const struct device *uart_dev = DEVICE_DT_GET(DT_NODELABEL(uart1));
 
 struct onoff_client m_onoff_cli;
@@ -46,11 +81,56 @@ struct k_poll_signal tx_done_sig;
 
 RING_BUF_DECLARE(m_tx_ring_buf, 64);
 
-static int address_to_index(uint32_t address)
+static uint32_t index_hash(uint32_t address)
+{
+	/* Fibonacci hashing - consecutive meter addresses spread over the table */
+	return (address * 2654435761u) >> (32 - INDEX_BITS);
+}
+
+static void index_insert(int slot)
 {
+	uint32_t h = index_hash(g_app_config.address[slot]);
+
+	for (int n = 0; n < INDEX_SIZE; n++, h = (h + 1) & (INDEX_SIZE - 1)) {
+		if (m_index[h] < 0) {
+			m_index[h] = slot;
+			m_index_count++;
+			return;
+		}
+	}
+}
+
+static void index_rebuild(void)
+{
+	for (int i = 0; i < INDEX_SIZE; i++) {
+		m_index[i] = -1;
+	}
+
+	m_index_count = 0;
+
 	for (int i = 0; i < DEVICE_MAX_COUNT; i++) {
-		if (g_app_config.address[i] == address) {
-			return i;
+		if (g_app_config.address[i] != 0) {
+			index_insert(i);
+		}
+	}
+}
+
+static int address_to_index(uint32_t address)
+{
+	if (address == 0) {
+		return -ENOENT;
+	}
+
+	uint32_t h = index_hash(address);
+
+	/* Stale slots (address cleared since the last rebuild) never compare equal */
+	for (int n = 0; n < INDEX_SIZE; n++, h = (h + 1) & (INDEX_SIZE - 1)) {
+		if (m_index[h] < 0) {
+			break;
+		}
+
+		if (g_app_config.address[m_index[h]] == address) {
+			return m_index[h];
 		}
 	}
 
@@ -74,24 +154,53 @@ void wmbus_parse_packet(uint8_t *packet, size_t len, wmbus_packet_meta *meta)
 
 bool wmbus_set_and_check_address_flag(uint32_t address)
 {
+	k_mutex_lock(&m_index_lock, K_FOREVER);
+
 	int index = address_to_index(address);
 
 	if (index < 0) {
+		k_mutex_unlock(&m_index_lock);
 		return 0;
 	}
 
+	atomic_inc(&m_stats_matched);
+
 	/* Return true only once */
 	bool retval = flags[index] == false;
 	flags[index] = true;
 
+	if (retval) {
+		m_flags_count++;
+	}
+
+	k_mutex_unlock(&m_index_lock);
+
 	return retval;
 }
 
+void wmbus_rebuild_address_index(void)
+{
+	k_mutex_lock(&m_index_lock, K_FOREVER);
+
+	index_rebuild();
+
+	k_mutex_unlock(&m_index_lock);
+}
+
 void wmbus_clear_address_flags(void)
 {
+	k_mutex_lock(&m_index_lock, K_FOREVER);
+
 	for (int i = 0; i < DEVICE_MAX_COUNT; i++) {
 		flags[i] = false;
 	}
+
+	m_flags_count = 0;
+
+	/* Called at the start of every scan - pick up the current address list */
+	index_rebuild();
+
+	k_mutex_unlock(&m_index_lock);
 }
 
 void wmbus_get_config_device_count(size_t *count)
@@ -107,23 +216,21 @@ void wmbus_get_config_device_count(size_t *count)
 
 bool wmbus_check_all_received_flags(void)
 {
-	bool no_devices_configured = true;
-
-	for (int i = 0; i < DEVICE_MAX_COUNT; i++) {
-		if (g_app_config.address[i] != 0) {
-			no_devices_configured = false;
-			if (flags[i] == false) {
-				return false;
-			}
-		}
-	}
+	k_mutex_lock(&m_index_lock, K_FOREVER);
 
 	/* If no devices configured, never return true */
-	if (no_devices_configured) {
-		return false;
-	}
+	bool retval = m_index_count && m_flags_count >= m_index_count;
+
+	k_mutex_unlock(&m_index_lock);
+
+	return retval;
+}
 
-	return true;
+void wmbus_get_stats(struct wmbus_stats *stats)
+{
+	stats->received = atomic_get(&m_stats_received);
+	stats->dropped = atomic_get(&m_stats_dropped);
+	stats->matched = atomic_get(&m_stats_matched);
 }
 
 /* Zephyr doesn't have uint32 variant */
@@ -149,9 +256,7 @@ int wmbus_convert_rssi_to_dbm(uint8_t rssi_raw)
 	}
 }
 
-#define RX_BUF_SIZE 512
-uint8_t rx_buf[RX_BUF_SIZE];
-uint8_t rx_buf_length = 0;
+uint16_t rx_buf_length = 0;
 uint8_t checksum;
 uint8_t packet_len;
 
@@ -162,8 +267,11 @@ static void uart_rx_timeout(struct k_timer *timer_id)
 
 static K_TIMER_DEFINE(m_uart_rx_timeout, uart_rx_timeout, NULL);
 
-size_t wmbus_rx_byte(uint8_t b)
+/* Delimits frames directly into the head slot of the frame ring */
+static size_t wmbus_rx_byte(uint8_t b)
 {
+	uint8_t *rx_buf = m_rx_frames[atomic_get(&m_rx_head)].data;
+
 	k_timer_start(&m_uart_rx_timeout, K_MSEC(50), K_FOREVER);
 
 	if (rx_buf_length == 0) {
@@ -206,9 +314,23 @@ size_t wmbus_rx_byte(uint8_t b)
 	return 0;
 }
 
-uint8_t *wmbus_get_buffer(void)
+static void rx_frame_commit(size_t len)
 {
-	return rx_buf;
+	atomic_val_t head = atomic_get(&m_rx_head);
+	atomic_val_t next = (head + 1) % RX_FRAME_COUNT;
+
+	atomic_inc(&m_stats_received);
+
+	/* Keep the slot for the next frame when the thread is behind */
+	if (next == atomic_get(&m_rx_tail)) {
+		atomic_inc(&m_stats_dropped);
+		return;
+	}
+
+	m_rx_frames[head].len = len;
+	atomic_set(&m_rx_head, next);
+
+	k_sem_give(&m_rx_sem);
 }
 
 static int hfclk_request(void)
@@ -349,12 +471,13 @@ int wmbus_antenna_set(int ant)
 
 static int scan_all_check_and_add(uint32_t address)
 {
+	k_mutex_lock(&m_index_lock, K_FOREVER);
+
 	/* Check if address already exists */
-	for (int i = 0; i < DEVICE_MAX_COUNT; i++) {
-		if (g_app_config.address[i] == address) {
-			LOG_WRN("Address %d already exists", address);
-			return -EEXIST;
-		}
+	if (address_to_index(address) >= 0) {
+		k_mutex_unlock(&m_index_lock);
+		LOG_WRN("Address %d already exists", address);
+		return -EEXIST;
 	}
 
 	/* Find next empty */
@@ -367,11 +490,15 @@ static int scan_all_check_and_add(uint32_t address)
 	}
 
 	if (next_empty == -1) {
+		k_mutex_unlock(&m_index_lock);
 		LOG_WRN("No empty position");
 		return -ENOSPC;
 	}
 
 	g_app_config.address[next_empty] = address;
+	index_insert(next_empty);
+
+	k_mutex_unlock(&m_index_lock);
 
 	return 0;
 }
@@ -445,6 +572,31 @@ static int mbus_packet_handle(uint8_t *data, size_t len)
 	return 0;
 }
 
+static void rx_thread(void)
+{
+	int ret;
+
+	for (;;) {
+		k_sem_take(&m_rx_sem, K_FOREVER);
+
+		atomic_val_t tail;
+		while ((tail = atomic_get(&m_rx_tail)) != atomic_get(&m_rx_head)) {
+			struct rx_frame *frame = &m_rx_frames[tail];
+
+			ret = mbus_packet_handle(frame->data, frame->len);
+			if (ret) {
+				LOG_ERR("Call `mbus_packet_handle` failed: %d", ret);
+			}
+
+			/* Hand the slot back to the ISR */
+			atomic_set(&m_rx_tail, (tail + 1) % RX_FRAME_COUNT);
+		}
+	}
+}
+
+K_THREAD_DEFINE(wmbus_rx, RX_THREAD_STACK_SIZE, rx_thread, NULL, NULL, NULL, RX_THREAD_PRIORITY,
+		0, 0);
+
 void app_handler_uart_callback(const struct device *dev, void *app_data)
 {
 	int ret;
@@ -469,11 +621,7 @@ void app_handler_uart_callback(const struct device *dev, void *app_data)
 			for (int i = 0; i < bytes_read; i++) {
 				size_t len;
 				if ((len = wmbus_rx_byte(buf[i]))) {
-					ret = mbus_packet_handle(wmbus_get_buffer(), len);
-					if (ret) {
-						LOG_ERR("Call `mbus_packet_handle` failed: %d",
-							ret);
-					}
+					rx_frame_commit(len);
 				}
 			}
 		}
@@ -585,6 +733,8 @@ int wmbus_init(void)
 	wmbus_get_config_device_count(&device_count);
 	g_app_data.scan_all = device_count == 0;
 
+	wmbus_clear_address_flags();
+
 	LOG_INF("Initialization end");
 
 	return 0;
@@ -27,13 +27,21 @@ typedef struct wmbus_packet_meta {
 	uint8_t device_version;
 } wmbus_packet_meta;
 
-size_t wmbus_rx_byte(uint8_t b);
-uint8_t *wmbus_get_buffer(void);
+struct wmbus_stats {
+	/* Frames delimited by the UART ISR */
+	uint32_t received;
+	/* Frames lost because the frame queue was full */
+	uint32_t dropped;
+	/* Frames from a configured address */
+	uint32_t matched;
+};
 
 bool wmbus_set_and_check_address_flag(uint32_t address);
 bool wmbus_check_all_received_flags(void);
 void wmbus_clear_address_flags(void);
+void wmbus_rebuild_address_index(void);
 void wmbus_get_config_device_count(size_t *count);
+void wmbus_get_stats(struct wmbus_stats *stats);
 
 uint32_t wmbus_convert_bcd_to_uint32(uint32_t address);
 int wmbus_convert_rssi_to_dbm(uint8_t rssi_raw);
@@ -67,8 +67,14 @@ LOG_MODULE_REGISTER(ads122c04, CONFIG_ADC_LOG_LEVEL);
 #define MSK_CONFIG_3_I2MUX	(BIT(2) | BIT(3) | BIT(4))
 #define MSK_CONFIG_3_I1MUX	(BIT(5) | BIT(6) | BIT(7))
 
-#define READ_MAX_RETRIES    100
-#define READ_RETRY_DELAY_MS 10
+/* DRDY is polled at a fraction of the conversion period and given up on after a few periods */
+#define DRDY_POLL_DIVIDER     16
+#define DRDY_POLL_MIN_US      100
+#define DRDY_TIMEOUT_PERIODS  4
+#define DRDY_TIMEOUT_EXTRA_MS 10
+
+/* Conversion period for each normal mode data rate setting */
+static const int32_t m_period_us[] = {50000, 22223, 11112, 5715, 3031, 1667, 1000};
 
 struct ads122c04_config {
 	const struct i2c_dt_spec i2c_spec;
@@ -78,6 +84,7 @@ struct ads122c04_config {
 	int idac;
 	int i1mux;
 	int i2mux;
+	int data_rate;
 };
 
 struct ads122c04_data {
@@ -190,78 +197,131 @@ static int ads122c04_channel_setup(const struct device *dev,
 	return 0;
 }
 
-static int ads122c04_read(const struct device *dev, const struct adc_sequence *sequence)
+static int wait_drdy(const struct device *dev)
 {
 	int ret;
 
-	if (sequence->buffer_size < sizeof(int32_t)) {
-		return -ENOSPC;
-	}
+	int32_t period_us = m_period_us[get_config(dev)->data_rate];
+	int32_t poll_us = MAX(period_us / DRDY_POLL_DIVIDER, DRDY_POLL_MIN_US);
+	int64_t deadline =
+		k_uptime_get() + period_us * DRDY_TIMEOUT_PERIODS / 1000 + DRDY_TIMEOUT_EXTRA_MS;
 
-	if (k_is_in_isr()) {
-		return -EWOULDBLOCK;
+	/* Do not load the bus while the conversion cannot be finished yet */
+	k_usleep(period_us - period_us / 8);
+
+	for (;;) {
+		uint8_t val;
+		ret = read_reg(dev, REG_CONFIG_2, &val);
+		if (ret) {
+			LOG_ERR("Call `read_reg` (REG_CONFIG_2) failed: %d", ret);
+			return ret;
+		}
+
+		if (val & MSK_CONFIG_2_DRDY) {
+			return 0;
+		}
+
+		if (k_uptime_get() > deadline) {
+			LOG_ERR("Timed out waiting for DRDY");
+			return -EIO;
+		}
+
+		k_usleep(poll_us);
 	}
+}
 
-	k_sem_take(&get_data(dev)->lock, K_FOREVER);
+/* The converter runs in continuous conversion mode for the whole burst - every sample costs one
+ * conversion period plus the DRDY poll and the readout, START/SYNC and POWERDOWN are only sent
+ * once per burst */
+static int ads122c04_read_burst(const struct device *dev, const struct adc_sequence *sequence,
+				int32_t *samples, size_t count)
+{
+	int ret;
 
 	ret = send_cmd(dev, CMD_START_SYNC);
 	if (ret) {
 		LOG_ERR("Call `send_cmd` (CMD_START_SYNC) failed: %d", ret);
-		goto error;
+		return ret;
 	}
 
-	int retries = 0;
+	enum adc_action action;
 
-	for (;;) {
-		uint8_t val;
-		ret = read_reg(dev, REG_CONFIG_2, &val);
+	for (size_t i = 0; i < count; i += (action == ADC_ACTION_REPEAT ? 0 : 1)) {
+		action = ADC_ACTION_CONTINUE;
+
+		ret = wait_drdy(dev);
 		if (ret) {
-			LOG_ERR("Call `read_reg` (REG_CONFIG_2) failed: %d", ret);
-			goto error;
+			LOG_ERR("Call `wait_drdy` failed: %d", ret);
+			return ret;
 		}
 
-		if (val & MSK_CONFIG_2_DRDY) {
+		/* Reading the data clears DRDY until the next conversion completes */
+		uint8_t data[3];
+		ret = read_data(dev, data);
+		if (ret) {
+			LOG_ERR("Call `read_data` failed: %d", ret);
+			return ret;
+		}
+
+		samples[i] = (uint32_t)data[0] << 16 | (uint32_t)data[1] << 8 | (uint32_t)data[2];
+		samples[i] <<= 8;
+		samples[i] >>= 8;
+
+		if (sequence->options && sequence->options->callback) {
+			action = sequence->options->callback(dev, sequence, i);
+		}
+
+		if (action == ADC_ACTION_FINISH) {
 			break;
 		}
+	}
+
+	return 0;
+}
+
+static int ads122c04_read(const struct device *dev, const struct adc_sequence *sequence)
+{
+	int ret;
+
+	size_t count = 1;
 
-		if (++retries >= READ_MAX_RETRIES) {
-			LOG_ERR("Reached maximum DRDY poll attempts");
-			ret = -EIO;
-			goto error;
+	if (sequence->options) {
+		if (sequence->options->interval_us) {
+			LOG_ERR("Sampling interval not supported (given by data rate)");
+			return -ENOTSUP;
 		}
 
-		k_msleep(READ_RETRY_DELAY_MS);
+		count += sequence->options->extra_samplings;
 	}
 
-	uint8_t data[3];
-	ret = read_data(dev, data);
+	if (sequence->buffer_size < count * sizeof(int32_t)) {
+		return -ENOSPC;
+	}
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	k_sem_take(&get_data(dev)->lock, K_FOREVER);
+
+	ret = ads122c04_read_burst(dev, sequence, sequence->buffer, count);
 	if (ret) {
-		LOG_ERR("Call `read_data` failed: %d", ret);
-		goto error;
+		LOG_ERR("Call `ads122c04_read_burst` failed: %d", ret);
+		send_cmd(dev, CMD_POWERDOWN);
+		k_sem_give(&get_data(dev)->lock);
+		return ret;
 	}
 
 	ret = send_cmd(dev, CMD_POWERDOWN);
 	if (ret) {
 		LOG_ERR("Call `send_cmd` (CMD_POWERDOWN) failed: %d", ret);
-		goto error;
+		k_sem_give(&get_data(dev)->lock);
+		return ret;
 	}
 
-	int32_t *result = sequence->buffer;
-
-	*result = (uint32_t)data[0] << 16 | (uint32_t)data[1] << 8 | (uint32_t)data[2];
-	*result <<= 8;
-	*result >>= 8;
-
 	k_sem_give(&get_data(dev)->lock);
 
 	return 0;
-
-error:
-	send_cmd(dev, CMD_POWERDOWN);
-
-	k_sem_give(&get_data(dev)->lock);
-
-	return ret;
 }
 
 static int ads122c04_init(const struct device *dev)
@@ -281,6 +341,9 @@ static int ads122c04_init(const struct device *dev)
 	get_data(dev)->reg_config_0 |= get_config(dev)->mux << POS_CONFIG_0_MUX;
 	get_data(dev)->reg_config_1 = DEF_CONFIG_1;
 	get_data(dev)->reg_config_1 |= get_config(dev)->vref << POS_CONFIG_1_VREF;
+	get_data(dev)->reg_config_1 |= get_config(dev)->data_rate << POS_CONFIG_1_DR;
+	/* Conversions run between START/SYNC and POWERDOWN, see ads122c04_read_burst */
+	get_data(dev)->reg_config_1 |= MSK_CONFIG_1_CM;
 	get_data(dev)->reg_config_2 = DEF_CONFIG_2;
 	get_data(dev)->reg_config_2 |= get_config(dev)->idac << POS_CONFIG_2_IDAC;
 	get_data(dev)->reg_config_3 = DEF_CONFIG_3;
@@ -331,6 +394,7 @@ static const struct adc_driver_api ads122c04_driver_api = {
 		.idac = DT_INST_PROP(n, idac),                                                     \
 		.i1mux = DT_INST_PROP(n, i1mux),                                                   \
 		.i2mux = DT_INST_PROP(n, i2mux),                                                   \
+		.data_rate = DT_INST_PROP(n, data_rate),                                           \
 	};                                                                                         \
 	static struct ads122c04_data inst_##n##_data = {                                           \
 		.lock = Z_SEM_INITIALIZER(inst_##n##_data.lock, 0, 1),                             \
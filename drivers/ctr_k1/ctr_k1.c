@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_k1_dsp.h"
+
 /* CHESTER includes */
 #include <chester/drivers/ctr_k1.h>
 
@@ -37,6 +39,12 @@ LOG_MODULE_REGISTER(ctr_k1, CONFIG_CTR_K1_LOG_LEVEL);
 #define MAX_SAMPLE_COUNT    500
 #define SAMPLE_INTERVAL_US  1000
 
+/* Streaming uses the halves of the sample buffer as ping-pong buffers */
+#define STREAM_CYCLE_SAMPLES  20
+#define STREAM_BUFFER_COUNT   2
+#define STREAM_BUFFER_SAMPLES (MAX_SAMPLE_COUNT / STREAM_BUFFER_COUNT)
+#define STREAM_STOP_TIMEOUT   K_MSEC(100)
+
 struct ctr_k1_config {
 	const struct gpio_dt_spec on1_spec;
 	const struct gpio_dt_spec on2_spec;
@@ -61,6 +69,37 @@ static int16_t m_samples[MAX_CHANNEL_COUNT * MAX_SAMPLE_COUNT];
 static K_MUTEX_DEFINE(m_lock);
 static K_SEM_DEFINE(m_adc_sem, 0, 1);
 
+typedef float (*convert_t)(int16_t value);
+
+#if defined(CONFIG_CTR_K1_STREAM)
+
+struct stream_buffer {
+	int index;
+	int16_t *samples;
+	size_t size;
+};
+
+struct stream {
+	const struct device *dev;
+	bool is_active;
+	size_t channels_count;
+	convert_t convert[MAX_CHANNEL_COUNT];
+	struct ctr_k1_dsp dsp[MAX_CHANNEL_COUNT];
+	struct ctr_k1_cycle cycles[MAX_CHANNEL_COUNT];
+	ctr_k1_stream_cb_t cb;
+	void *user_data;
+	int next_buffer;
+	/* Bit per buffer owned by the stream thread */
+	atomic_t busy;
+	atomic_t overruns;
+};
+
+static struct stream m_stream;
+static K_MUTEX_DEFINE(m_stream_lock);
+K_MSGQ_DEFINE(m_stream_msgq, sizeof(struct stream_buffer), STREAM_BUFFER_COUNT, 4);
+
+#endif /* defined(CONFIG_CTR_K1_STREAM) */
+
 static const nrf_saadc_channel_config_t m_channel_config_single_ended = {
 	.resistor_p = NRF_SAADC_RESISTOR_DISABLED,
 	.resistor_n = NRF_SAADC_RESISTOR_DISABLED,
@@ -276,7 +315,37 @@ static void saadc_event_handler(nrfx_saadc_evt_t const *p_event)
 	switch (p_event->type) {
 	case NRFX_SAADC_EVT_DONE:
 		LOG_DBG("Event `NRFX_SAADC_EVT_DONE`");
+#if defined(CONFIG_CTR_K1_STREAM)
+		if (m_stream.is_active) {
+			struct stream_buffer buffer = {
+				.index = p_event->data.done.p_buffer == m_samples ? 0 : 1,
+				.samples = p_event->data.done.p_buffer,
+				.size = p_event->data.done.size,
+			};
+
+			/* Still owned by the thread - counted as overrun when it was handed back */
+			if (!atomic_test_and_set_bit(&m_stream.busy, buffer.index)) {
+				k_msgq_put(&m_stream_msgq, &buffer, K_NO_WAIT);
+			}
+		}
+#endif /* defined(CONFIG_CTR_K1_STREAM) */
+		break;
+#if defined(CONFIG_CTR_K1_STREAM)
+	case NRFX_SAADC_EVT_BUF_REQ:
+		LOG_DBG("Event `NRFX_SAADC_EVT_BUF_REQ`");
+		if (m_stream.is_active) {
+			size_t size = m_stream.channels_count * STREAM_BUFFER_SAMPLES;
+
+			/* The thread has not finished the buffer that is going to be refilled */
+			if (atomic_test_bit(&m_stream.busy, m_stream.next_buffer)) {
+				atomic_inc(&m_stream.overruns);
+			}
+
+			nrfx_saadc_buffer_set(&m_samples[m_stream.next_buffer * size], size);
+			m_stream.next_buffer ^= 1;
+		}
 		break;
+#endif /* defined(CONFIG_CTR_K1_STREAM) */
 	case NRFX_SAADC_EVT_CALIBRATEDONE:
 		LOG_DBG("Event `NRFX_SAADC_EVT_CALIBRATEDONE`");
 		k_sem_give(&m_adc_sem);
@@ -372,6 +441,68 @@ static inline float convert_differential_to_millivolts(int16_t value)
 	return (float)value * 6 * 600 / 2048;
 }
 
+static int get_channel(enum ctr_k1_channel channel, size_t index,
+		       nrfx_saadc_channel_t *saadc_channel, convert_t *convert)
+{
+	saadc_channel->channel_index = index;
+
+	switch (channel) {
+	case CTR_K1_CHANNEL_1_SINGLE_ENDED:
+		saadc_channel->channel_config = m_channel_config_single_ended;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN1;
+		saadc_channel->pin_n = NRF_SAADC_INPUT_DISABLED;
+		*convert = convert_single_ended_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_2_SINGLE_ENDED:
+		saadc_channel->channel_config = m_channel_config_single_ended;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN0;
+		saadc_channel->pin_n = NRF_SAADC_INPUT_DISABLED;
+		*convert = convert_single_ended_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_3_SINGLE_ENDED:
+		saadc_channel->channel_config = m_channel_config_single_ended;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN4;
+		saadc_channel->pin_n = NRF_SAADC_INPUT_DISABLED;
+		*convert = convert_single_ended_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_4_SINGLE_ENDED:
+		saadc_channel->channel_config = m_channel_config_single_ended;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN2;
+		saadc_channel->pin_n = NRF_SAADC_INPUT_DISABLED;
+		*convert = convert_single_ended_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_1_DIFFERENTIAL:
+		saadc_channel->channel_config = m_channel_config_differential;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN5;
+		saadc_channel->pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN1;
+		*convert = convert_differential_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_2_DIFFERENTIAL:
+		saadc_channel->channel_config = m_channel_config_differential;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN7;
+		saadc_channel->pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN0;
+		*convert = convert_differential_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_3_DIFFERENTIAL:
+		saadc_channel->channel_config = m_channel_config_differential;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN6;
+		saadc_channel->pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN4;
+		*convert = convert_differential_to_millivolts;
+		break;
+	case CTR_K1_CHANNEL_4_DIFFERENTIAL:
+		saadc_channel->channel_config = m_channel_config_differential;
+		saadc_channel->pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN3;
+		saadc_channel->pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN2;
+		*convert = convert_differential_to_millivolts;
+		break;
+	default:
+		LOG_ERR("Unknown channel: %d", channel);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 static int ctr_k1_measure_(const struct device *dev, const enum ctr_k1_channel channels[],
 			   size_t channels_count, struct ctr_k1_result results[])
 {
@@ -386,71 +517,28 @@ static int ctr_k1_measure_(const struct device *dev, const enum ctr_k1_channel c
 	}
 
 	nrfx_saadc_channel_t saadc_channels[MAX_CHANNEL_COUNT] = {0};
-	float (*convert[MAX_CHANNEL_COUNT])(int16_t) = {0};
+	convert_t convert[MAX_CHANNEL_COUNT] = {0};
 
 	for (size_t i = 0; i < channels_count; i++) {
 		results[i].avg = 0.f;
 		results[i].rms = 0.f;
 
-		saadc_channels[i].channel_index = i;
-
-		switch (channels[i]) {
-		case CTR_K1_CHANNEL_1_SINGLE_ENDED:
-			saadc_channels[i].channel_config = m_channel_config_single_ended;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN1;
-			saadc_channels[i].pin_n = NRF_SAADC_INPUT_DISABLED;
-			convert[i] = convert_single_ended_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_2_SINGLE_ENDED:
-			saadc_channels[i].channel_config = m_channel_config_single_ended;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN0;
-			saadc_channels[i].pin_n = NRF_SAADC_INPUT_DISABLED;
-			convert[i] = convert_single_ended_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_3_SINGLE_ENDED:
-			saadc_channels[i].channel_config = m_channel_config_single_ended;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN4;
-			saadc_channels[i].pin_n = NRF_SAADC_INPUT_DISABLED;
-			convert[i] = convert_single_ended_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_4_SINGLE_ENDED:
-			saadc_channels[i].channel_config = m_channel_config_single_ended;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN2;
-			saadc_channels[i].pin_n = NRF_SAADC_INPUT_DISABLED;
-			convert[i] = convert_single_ended_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_1_DIFFERENTIAL:
-			saadc_channels[i].channel_config = m_channel_config_differential;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN5;
-			saadc_channels[i].pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN1;
-			convert[i] = convert_differential_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_2_DIFFERENTIAL:
-			saadc_channels[i].channel_config = m_channel_config_differential;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN7;
-			saadc_channels[i].pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN0;
-			convert[i] = convert_differential_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_3_DIFFERENTIAL:
-			saadc_channels[i].channel_config = m_channel_config_differential;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN6;
-			saadc_channels[i].pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN4;
-			convert[i] = convert_differential_to_millivolts;
-			break;
-		case CTR_K1_CHANNEL_4_DIFFERENTIAL:
-			saadc_channels[i].channel_config = m_channel_config_differential;
-			saadc_channels[i].pin_p = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN3;
-			saadc_channels[i].pin_n = (nrf_saadc_input_t)NRF_SAADC_INPUT_AIN2;
-			convert[i] = convert_differential_to_millivolts;
-			break;
-		default:
-			LOG_ERR("Unknown channel: %d", channels[i]);
-			return -EINVAL;
+		ret = get_channel(channels[i], i, &saadc_channels[i], &convert[i]);
+		if (ret) {
+			return ret;
 		}
 	}
 
 	k_mutex_lock(&m_lock, K_FOREVER);
 
+#if defined(CONFIG_CTR_K1_STREAM)
+	if (m_stream.is_active) {
+		LOG_ERR("Streaming in progress");
+		k_mutex_unlock(&m_lock);
+		return -EBUSY;
+	}
+#endif /* defined(CONFIG_CTR_K1_STREAM) */
+
 	ret = measure(saadc_channels, channels_count);
 	if (ret) {
 		LOG_ERR("Call `measure` failed: %d", ret);
@@ -481,6 +569,232 @@ static int ctr_k1_measure_(const struct device *dev, const enum ctr_k1_channel c
 	return 0;
 }
 
+#if defined(CONFIG_CTR_K1_STREAM)
+
+static void stream_thread(void *p1, void *p2, void *p3)
+{
+	for (;;) {
+		struct stream_buffer buffer;
+		k_msgq_get(&m_stream_msgq, &buffer, K_FOREVER);
+
+		k_mutex_lock(&m_stream_lock, K_FOREVER);
+
+		if (!m_stream.is_active) {
+			atomic_clear_bit(&m_stream.busy, buffer.index);
+			k_mutex_unlock(&m_stream_lock);
+			continue;
+		}
+
+		atomic_val_t overruns = atomic_set(&m_stream.overruns, 0);
+		if (overruns) {
+			LOG_WRN("Dropped buffers: %ld", (long)overruns);
+		}
+
+		size_t channels_count = m_stream.channels_count;
+
+		for (size_t i = 0; i + channels_count <= buffer.size; i += channels_count) {
+			bool is_cycle = false;
+
+			/* All channels share the sample clock, so their cycles complete together */
+			for (size_t j = 0; j < channels_count; j++) {
+				float x = m_stream.convert[j](buffer.samples[i + j]);
+				struct ctr_k1_dsp *dsp = &m_stream.dsp[j];
+				is_cycle = ctr_k1_dsp_feed(dsp, x, &m_stream.cycles[j]);
+			}
+
+			if (is_cycle && m_stream.cb) {
+				m_stream.cb(m_stream.dev, m_stream.cycles, channels_count,
+					    m_stream.user_data);
+			}
+		}
+
+		atomic_clear_bit(&m_stream.busy, buffer.index);
+
+		k_mutex_unlock(&m_stream_lock);
+	}
+}
+
+K_THREAD_DEFINE(ctr_k1_stream, CONFIG_CTR_K1_STREAM_THREAD_STACK_SIZE, stream_thread, NULL, NULL,
+		NULL, CONFIG_CTR_K1_STREAM_THREAD_PRIORITY, 0, 0);
+
+static int ctr_k1_stream_start_(const struct device *dev, const enum ctr_k1_channel channels[],
+				size_t channels_count, int mains_freq, ctr_k1_stream_cb_t cb,
+				void *user_data)
+{
+	int ret;
+
+	if (!channels_count || channels_count > MAX_CHANNEL_COUNT) {
+		return -EINVAL;
+	}
+
+	if (mains_freq != 50 && mains_freq != 60) {
+		LOG_ERR("Unsupported mains frequency: %d", mains_freq);
+		return -EINVAL;
+	}
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	nrfx_saadc_channel_t saadc_channels[MAX_CHANNEL_COUNT] = {0};
+	convert_t convert[MAX_CHANNEL_COUNT] = {0};
+
+	for (size_t i = 0; i < channels_count; i++) {
+		ret = get_channel(channels[i], i, &saadc_channels[i], &convert[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+	k_mutex_lock(&m_stream_lock, K_FOREVER);
+
+	if (m_stream.is_active) {
+		LOG_ERR("Streaming in progress");
+		k_mutex_unlock(&m_stream_lock);
+		k_mutex_unlock(&m_lock);
+		return -EBUSY;
+	}
+
+	m_stream.dev = dev;
+	m_stream.channels_count = channels_count;
+	m_stream.cb = cb;
+	m_stream.user_data = user_data;
+	m_stream.next_buffer = 1;
+	atomic_set(&m_stream.busy, 0);
+	atomic_set(&m_stream.overruns, 0);
+
+	for (size_t i = 0; i < channels_count; i++) {
+		m_stream.convert[i] = convert[i];
+		ctr_k1_dsp_init(&m_stream.dsp[i], STREAM_CYCLE_SAMPLES);
+	}
+
+	k_msgq_purge(&m_stream_msgq);
+
+	/* Sample period is an integer fraction of the mains period */
+	nrfx_timer_extended_compare(
+		&m_timer, NRF_TIMER_CC_CHANNEL0,
+		NRF_TIMER_BASE_FREQUENCY_GET(m_timer.p_reg) / (mains_freq * STREAM_CYCLE_SAMPLES),
+		NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK, false);
+
+	ret = nrfx_saadc_init(NRFX_SAADC_DEFAULT_CONFIG_IRQ_PRIORITY);
+	if (ret) {
+		LOG_ERR("Call `nrfx_saadc_init` failed: %d", ret);
+		ret = -EIO;
+		goto error;
+	}
+
+	ret = nrfx_saadc_channels_config(saadc_channels, channels_count);
+	if (ret) {
+		LOG_ERR("Call `nrfx_saadc_channels_config` failed: %d", ret);
+		ret = -EIO;
+		goto error_uninit;
+	}
+
+	nrfx_saadc_adv_config_t config = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+	config.start_on_end = true;
+
+	ret = nrfx_saadc_advanced_mode_set(BIT_MASK(channels_count), NRF_SAADC_RESOLUTION_12BIT,
+					   &config, saadc_event_handler);
+	if (ret) {
+		LOG_ERR("Call `nrfx_saadc_advanced_mode_set` failed: %d", ret);
+		ret = -EIO;
+		goto error_uninit;
+	}
+
+	/* The other half is handed over on NRFX_SAADC_EVT_BUF_REQ */
+	m_stream.is_active = true;
+
+	ret = nrfx_saadc_buffer_set(m_samples, channels_count * STREAM_BUFFER_SAMPLES);
+	if (ret) {
+		LOG_ERR("Call `nrfx_saadc_buffer_set` failed: %d", ret);
+		ret = -EIO;
+		goto error_uninit;
+	}
+
+	ret = nrfx_saadc_mode_trigger();
+	if (ret) {
+		LOG_ERR("Call `nrfx_saadc_mode_trigger` failed: %d", ret);
+		ret = -EIO;
+		goto error_uninit;
+	}
+
+	k_mutex_unlock(&m_stream_lock);
+	k_mutex_unlock(&m_lock);
+
+	return 0;
+
+error_uninit:
+	m_stream.is_active = false;
+	nrfx_saadc_uninit();
+
+error:
+	nrfx_timer_extended_compare(&m_timer, NRF_TIMER_CC_CHANNEL0,
+				    nrfx_timer_us_to_ticks(&m_timer, SAMPLE_INTERVAL_US),
+				    NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK, false);
+
+	k_mutex_unlock(&m_stream_lock);
+	k_mutex_unlock(&m_lock);
+
+	return ret;
+}
+
+static int ctr_k1_stream_stop_(const struct device *dev)
+{
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+	k_mutex_lock(&m_stream_lock, K_FOREVER);
+
+	if (!m_stream.is_active) {
+		k_mutex_unlock(&m_stream_lock);
+		k_mutex_unlock(&m_lock);
+		return 0;
+	}
+
+	m_stream.is_active = false;
+
+	k_sem_reset(&m_adc_sem);
+
+	nrfx_saadc_abort();
+
+	if (k_sem_take(&m_adc_sem, STREAM_STOP_TIMEOUT)) {
+		LOG_WRN("SAADC did not report the end of conversion");
+		nrfx_timer_disable(&m_timer);
+	}
+
+	nrfx_saadc_uninit();
+
+	nrfx_timer_extended_compare(&m_timer, NRF_TIMER_CC_CHANNEL0,
+				    nrfx_timer_us_to_ticks(&m_timer, SAMPLE_INTERVAL_US),
+				    NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK, false);
+
+	k_msgq_purge(&m_stream_msgq);
+
+	k_mutex_unlock(&m_stream_lock);
+	k_mutex_unlock(&m_lock);
+
+	return 0;
+}
+
+#else
+
+static int ctr_k1_stream_start_(const struct device *dev, const enum ctr_k1_channel channels[],
+				size_t channels_count, int mains_freq, ctr_k1_stream_cb_t cb,
+				void *user_data)
+{
+	return -ENOTSUP;
+}
+
+static int ctr_k1_stream_stop_(const struct device *dev)
+{
+	return -ENOTSUP;
+}
+
+#endif /* defined(CONFIG_CTR_K1_STREAM) */
+
 static int ctr_k1_init(const struct device *dev)
 {
 	int ret;
@@ -550,6 +864,8 @@ static int ctr_k1_init(const struct device *dev)
 static const struct ctr_k1_driver_api ctr_k1_driver_api = {
 	.set_power = ctr_k1_set_power_,
 	.measure = ctr_k1_measure_,
+	.stream_start = ctr_k1_stream_start_,
+	.stream_stop = ctr_k1_stream_stop_,
 };
 
 #define CTR_K1_INIT(n)                                                                             \
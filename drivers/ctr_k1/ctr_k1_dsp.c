@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_k1_dsp.h"
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_k1.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+static void reset(struct ctr_k1_dsp *dsp)
+{
+	memset(dsp->s1, 0, sizeof(dsp->s1));
+	memset(dsp->s2, 0, sizeof(dsp->s2));
+	dsp->sum = 0.f;
+	dsp->sum_sq = 0.f;
+	dsp->peak = 0.f;
+	dsp->count = 0;
+}
+
+int ctr_k1_dsp_init(struct ctr_k1_dsp *dsp, int cycle_samples)
+{
+	if (cycle_samples <= 2 * CTR_K1_HARMONIC_COUNT) {
+		return -EINVAL;
+	}
+
+	dsp->cycle_samples = cycle_samples;
+
+	/* Harmonic k lies exactly in bin k as the window is one mains cycle long */
+	for (int k = 0; k < CTR_K1_HARMONIC_COUNT; k++) {
+		dsp->coeff[k] = 2.f * cosf(2.f * (float)M_PI * (k + 1) / cycle_samples);
+	}
+
+	reset(dsp);
+
+	return 0;
+}
+
+bool ctr_k1_dsp_feed(struct ctr_k1_dsp *dsp, float x, struct ctr_k1_cycle *cycle)
+{
+	dsp->sum += x;
+	dsp->sum_sq += x * x;
+	dsp->peak = fmaxf(dsp->peak, fabsf(x));
+
+	for (int k = 0; k < CTR_K1_HARMONIC_COUNT; k++) {
+		float s0 = x + dsp->coeff[k] * dsp->s1[k] - dsp->s2[k];
+		dsp->s2[k] = dsp->s1[k];
+		dsp->s1[k] = s0;
+	}
+
+	if (++dsp->count < dsp->cycle_samples) {
+		return false;
+	}
+
+	float n = dsp->cycle_samples;
+
+	cycle->avg = dsp->sum / n;
+	cycle->rms = sqrtf(dsp->sum_sq / n);
+	cycle->peak = dsp->peak;
+	cycle->crest = cycle->rms > 0.f ? cycle->peak / cycle->rms : 0.f;
+
+	for (int k = 0; k < CTR_K1_HARMONIC_COUNT; k++) {
+		float s1 = dsp->s1[k];
+		float s2 = dsp->s2[k];
+		float power = s1 * s1 + s2 * s2 - dsp->coeff[k] * s1 * s2;
+
+		/* Bin magnitude to the RMS value of the sinusoid */
+		cycle->harmonics[k] = sqrtf(fmaxf(power, 0.f)) * (float)M_SQRT2 / n;
+	}
+
+	reset(dsp);
+
+	return true;
+}
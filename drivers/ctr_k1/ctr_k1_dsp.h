@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_DRIVERS_CTR_K1_CTR_K1_DSP_H_
+#define CHESTER_DRIVERS_CTR_K1_CTR_K1_DSP_H_
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_k1.h>
+
+/* Standard includes */
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Incremental per-cycle metrics of one channel - the samples of one mains cycle are folded in as
+ * they arrive, harmonics are tracked with one Goertzel filter each */
+struct ctr_k1_dsp {
+	int cycle_samples;
+	float coeff[CTR_K1_HARMONIC_COUNT];
+	float s1[CTR_K1_HARMONIC_COUNT];
+	float s2[CTR_K1_HARMONIC_COUNT];
+	float sum;
+	float sum_sq;
+	float peak;
+	int count;
+};
+
+/* Samples per cycle has to be greater than twice CTR_K1_HARMONIC_COUNT */
+int ctr_k1_dsp_init(struct ctr_k1_dsp *dsp, int cycle_samples);
+
+/* Returns true and fills the cycle when the sample completes a mains cycle */
+bool ctr_k1_dsp_feed(struct ctr_k1_dsp *dsp, float x, struct ctr_k1_cycle *cycle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_DRIVERS_CTR_K1_CTR_K1_DSP_H_ */
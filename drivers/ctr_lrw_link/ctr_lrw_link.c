@@ -38,6 +38,45 @@ LOG_MODULE_REGISTER(ctr_lrw_link, CONFIG_CTR_LRW_LINK_LOG_LEVEL);
 #define TX_LINE_PREFIX ""
 #define TX_LINE_SUFFIX "\r\n"
 
+#define TX_LINE_BUF_SIZE 1024
+#define RX_LINE_BUF_SIZE 1024
+
+#define RX_HEAP_MEM_SIZE    4096
+#define RX_PIPE_BUF_SIZE    512
+#define RX_SLAB_BLOCK_ALIGN 4
+#define RX_SLAB_BLOCK_COUNT 2
+#define RX_SLAB_BLOCK_SIZE  64
+#define RX_TIMEOUT          100000
+
+struct ctr_lrw_link_data {
+	atomic_t in_dialog;
+	atomic_t rx_line_synced;
+	atomic_t recv_line;
+	atomic_t stop_request;
+	bool enabled;
+	char rx_line_buf[RX_LINE_BUF_SIZE];
+	char rx_slab_mem[RX_SLAB_BLOCK_SIZE * RX_SLAB_BLOCK_COUNT] __aligned(RX_SLAB_BLOCK_ALIGN);
+	char tx_line_buf[TX_LINE_BUF_SIZE];
+	const struct device *dev;
+	ctr_lrw_link_user_cb user_cb;
+	size_t rx_line_len;
+	struct k_fifo rx_fifo;
+	struct k_heap rx_heap;
+	struct k_mem_slab rx_slab;
+	struct k_mutex lock;
+	struct k_pipe rx_pipe;
+	struct k_sem rx_disabled_sem;
+	struct k_sem tx_finished_sem;
+	struct k_work rx_loss_work;
+	struct k_work rx_receive_work;
+	struct k_work rx_restart_work;
+	struct onoff_client onoff_cli;
+	struct onoff_manager *onoff_mgr;
+	uint8_t rx_heap_mem[RX_HEAP_MEM_SIZE];
+	uint8_t rx_pipe_buf[RX_PIPE_BUF_SIZE];
+	void *user_data;
+};
+
 struct ctr_lrw_link_config {
 	const struct device *uart_dev;
 	const struct gpio_dt_spec reset_spec;
@@ -42,8 +42,12 @@ LOG_MODULE_REGISTER(ctr_lte_link, CONFIG_CTR_LTE_LINK_LOG_LEVEL);
 #define TX_LINE_BUF_SIZE 1024
 #define RX_LINE_BUF_SIZE 1024
 
-#define RX_HEAP_MEM_SIZE    4096
+#define RX_BLOCK_SIZE       64
+#define RX_HEAP_MEM_SIZE    2048
 #define RX_PIPE_BUF_SIZE    512
+#define RX_POOL_SLOT_ALIGN  4
+#define RX_POOL_SLOT_COUNT  16
+#define RX_POOL_SLOT_SIZE   128
 #define RX_SLAB_BLOCK_ALIGN 4
 #define RX_SLAB_BLOCK_COUNT 2
 #define RX_SLAB_BLOCK_SIZE  64
@@ -61,18 +65,31 @@ struct ctr_lte_link_data {
 	atomic_t in_dialog;
 	atomic_t in_data_mode;
 	atomic_t rx_line_synced;
+	atomic_t rx_bytes;
+	atomic_t rx_lines;
+	atomic_t rx_drops;
+	atomic_t rx_pool_max;
+	atomic_t rx_heap_used;
+	atomic_t rx_heap_max;
 	atomic_t stop_request;
 	bool enabled;
+	char rx_block[RX_BLOCK_SIZE];
 	char rx_line_buf[RX_LINE_BUF_SIZE];
+	char rx_pool_mem[RX_POOL_SLOT_SIZE * RX_POOL_SLOT_COUNT] __aligned(RX_POOL_SLOT_ALIGN);
 	char rx_slab_mem[RX_SLAB_BLOCK_SIZE * RX_SLAB_BLOCK_COUNT] __aligned(RX_SLAB_BLOCK_ALIGN);
 	char tx_line_buf[TX_LINE_BUF_SIZE];
 	const struct device *dev;
 	ctr_lte_link_user_cb user_cb;
+	size_t rx_block_len;
+	size_t rx_block_pos;
 	size_t rx_line_len;
 	struct k_fifo rx_fifo;
 	struct k_heap rx_heap;
+	struct k_mem_slab rx_pool;
 	struct k_mem_slab rx_slab;
 	struct k_mutex lock;
+	/* Guards rx_block and the line scanner state shared by the work handler and the dialog */
+	struct k_mutex rx_lock;
 	struct k_pipe rx_pipe;
 	struct k_sem rx_disabled_sem;
 	struct k_sem tx_finished_sem;
@@ -97,22 +114,68 @@ static inline struct ctr_lte_link_data *get_data(const struct device *dev)
 	return dev->data;
 }
 
-static void process_line(const struct device *dev)
+/* Received line as stacked in rx_fifo (the first word is reserved by the FIFO) */
+struct rx_line {
+	void *fifo_reserved;
+	uint16_t size;
+	char text[];
+};
+
+static void update_max(atomic_t *max, atomic_val_t value)
 {
-	int ret;
+	if (value > atomic_get(max)) {
+		atomic_set(max, value);
+	}
+}
 
+static struct rx_line *alloc_line(const struct device *dev, size_t len)
+{
 	struct ctr_lte_link_data *data = get_data(dev);
 
-	size_t len = strlen(data->rx_line_buf);
-	if (len) {
-		LOG_DBG("Stacking line: %s", data->rx_line_buf);
+	struct rx_line *item;
+	size_t size = sizeof(*item) + len + 1;
+
+	if (size <= RX_POOL_SLOT_SIZE &&
+	    !k_mem_slab_alloc(&data->rx_pool, (void **)&item, K_NO_WAIT)) {
+		item->size = 0;
+		update_max(&data->rx_pool_max, k_mem_slab_num_used_get(&data->rx_pool));
+		return item;
+	}
+
+	/* Long lines (or an exhausted pool) fall back to the heap */
+	item = k_heap_alloc(&data->rx_heap, size, K_NO_WAIT);
+	if (!item) {
+		return NULL;
+	}
+
+	item->size = size;
+	update_max(&data->rx_heap_max, atomic_add(&data->rx_heap_used, size) + size);
+
+	return item;
+}
+
+static void free_line(const struct device *dev, struct rx_line *item)
+{
+	struct ctr_lte_link_data *data = get_data(dev);
+
+	if (item->size) {
+		atomic_sub(&data->rx_heap_used, item->size);
+		k_heap_free(&data->rx_heap, item);
 	} else {
-		LOG_DBG("Stacking empty line");
+		k_mem_slab_free(&data->rx_pool, item);
 	}
+}
+
+static void process_line(const struct device *dev, size_t len)
+{
+	struct ctr_lte_link_data *data = get_data(dev);
 
-	char *p = k_heap_alloc(&data->rx_heap, len + 1, K_NO_WAIT);
-	if (!p) {
-		LOG_ERR("Call `k_heap_alloc` failed");
+	LOG_DBG("Stacking line: %s", data->rx_line_buf);
+
+	struct rx_line *item = alloc_line(dev, len);
+	if (!item) {
+		LOG_ERR("Call `alloc_line` failed");
+		atomic_inc(&data->rx_drops);
 		if (data->user_cb) {
 			data->user_cb(data->dev, CTR_LTE_LINK_EVENT_RX_LOSS, data->user_data);
 		}
@@ -120,93 +183,173 @@ static void process_line(const struct device *dev)
 		return;
 	}
 
-	LOG_DBG("Allocated from heap: %p - %u byte(s)", (void *)p, len + 1);
+	memcpy(item->text, data->rx_line_buf, len + 1);
 
-	strcpy(p, data->rx_line_buf);
+	k_fifo_put(&data->rx_fifo, item);
 
-	ret = k_fifo_alloc_put(&data->rx_fifo, p);
-	if (ret) {
-		LOG_ERR("Call `k_fifo_alloc_put` failed: %d", ret);
-		k_heap_free(&data->rx_heap, p);
-		LOG_DBG("Released from heap: %p", (void *)p);
-	}
+	atomic_inc(&data->rx_lines);
 
 	if (data->user_cb && !atomic_get(&data->in_dialog)) {
 		data->user_cb(data->dev, CTR_LTE_LINK_EVENT_RX_LINE, data->user_data);
 	}
 }
 
-static void receive_character(const struct device *dev, char c, bool *received_line)
+static void receive_line_data(const struct device *dev, const char *p, size_t len)
 {
-	if (received_line) {
-		*received_line = false;
-	}
+	struct ctr_lte_link_data *data = get_data(dev);
 
-	if (c == '\r') {
-		return;
+	for (size_t i = 0; i < len; i++) {
+		char c = p[i];
+
+		if (c == '\r') {
+			continue;
+		}
+
+		if (!atomic_get(&data->rx_line_synced)) {
+			data->rx_line_len = 0;
+			LOG_WRN("Not synced character: %c (0x%02x)", c, c);
+			continue;
+		}
+
+		if (data->rx_line_len >= sizeof(data->rx_line_buf) - 1) {
+			LOG_ERR("Line buffer overflow");
+			atomic_inc(&data->rx_drops);
+			atomic_set(&data->rx_line_synced, false);
+			continue;
+		}
+
+		data->rx_line_buf[data->rx_line_len++] = c;
 	}
+}
 
+static bool receive_line_end(const struct device *dev)
+{
 	struct ctr_lte_link_data *data = get_data(dev);
 
 	if (!atomic_get(&data->rx_line_synced)) {
 		data->rx_line_len = 0;
+		atomic_set(&data->rx_line_synced, true);
+		return false;
+	}
 
-		if (c == '\n') {
-			atomic_set(&data->rx_line_synced, true);
-		} else {
-			LOG_WRN("Not synced character: %c (0x%02x)", c, c);
-		}
-
-		return;
+	if (data->rx_line_len == 0) {
+		LOG_WRN("Unexpected empty line");
+		return false;
 	}
 
-	if (c == '\n') {
-		if (data->rx_line_len == 0) {
-			LOG_WRN("Unexpected empty line");
-			return;
-		}
+	size_t len = data->rx_line_len;
+
+	data->rx_line_buf[len] = '\0';
+	data->rx_line_len = 0;
+
+	process_line(dev, len);
+
+	atomic_set(&data->rx_line_synced, false);
+
+	return true;
+}
+
+/* Scans the buffered block for line terminators; with single_line set it stops right after the
+   first completed line so that any data following it stays buffered for recv_data */
+static bool receive_block(const struct device *dev, bool single_line)
+{
+	struct ctr_lte_link_data *data = get_data(dev);
+
+	bool received_line = false;
 
-		if (received_line) {
-			*received_line = true;
+	while (data->rx_block_pos < data->rx_block_len) {
+		const char *p = &data->rx_block[data->rx_block_pos];
+		size_t n = data->rx_block_len - data->rx_block_pos;
+
+		const char *lf = memchr(p, '\n', n);
+		size_t len = lf ? lf - p : n;
+
+		receive_line_data(dev, p, len);
+
+		data->rx_block_pos += lf ? len + 1 : len;
+
+		if (lf && receive_line_end(dev)) {
+			received_line = true;
+
+			if (single_line) {
+				break;
+			}
 		}
+	}
 
-		data->rx_line_buf[data->rx_line_len] = '\0';
-		data->rx_line_len = 0;
+	return received_line;
+}
 
-		process_line(dev);
+static int fill_block(const struct device *dev, k_timeout_t timeout)
+{
+	int ret;
 
-		atomic_set(&data->rx_line_synced, false);
+	struct ctr_lte_link_data *data = get_data(dev);
 
-		return;
+	if (data->rx_block_pos < data->rx_block_len) {
+		return 0;
 	}
 
-	if (data->rx_line_len >= sizeof(data->rx_line_buf) - 1) {
-		LOG_ERR("Line buffer overflow");
+	ret = k_pipe_read(&data->rx_pipe, (uint8_t *)data->rx_block, sizeof(data->rx_block),
+			  K_NO_WAIT);
 
-		atomic_set(&data->rx_line_synced, false);
+	/* Only wait for the first byte - a blocking block read could wait for the whole block */
+	if (ret <= 0 && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = k_pipe_read(&data->rx_pipe, (uint8_t *)data->rx_block, 1, timeout);
+	}
 
-		return;
+	if (ret <= 0) {
+		return ret < 0 ? ret : -EAGAIN;
 	}
 
-	data->rx_line_buf[data->rx_line_len++] = c;
+	data->rx_block_pos = 0;
+	data->rx_block_len = ret;
+
+	return 0;
 }
 
-static void receive_in_line_mode(const struct device *dev)
+static size_t take_block(const struct device *dev, void *buf, size_t size)
 {
-	int ret;
+	struct ctr_lte_link_data *data = get_data(dev);
+
+	size_t len = MIN(size, data->rx_block_len - data->rx_block_pos);
+
+	memcpy(buf, &data->rx_block[data->rx_block_pos], len);
+	data->rx_block_pos += len;
 
+	return len;
+}
+
+static void reset_rx_pipe(const struct device *dev)
+{
 	struct ctr_lte_link_data *data = get_data(dev);
 
-	for (;;) {
-		char c;
+	k_mutex_lock(&data->rx_lock, K_FOREVER);
 
-		ret = k_pipe_read(&data->rx_pipe, (uint8_t *)&c, 1, K_NO_WAIT);
-		if (ret != 1) {
-			break;
-		}
+	k_pipe_reset(&data->rx_pipe);
+
+	data->rx_block_len = 0;
+	data->rx_block_pos = 0;
+
+	k_mutex_unlock(&data->rx_lock);
+}
+
+static void receive_in_line_mode(const struct device *dev)
+{
+	struct ctr_lte_link_data *data = get_data(dev);
+
+	/* Held by a dialog or data receiver - it consumes the pipe itself */
+	if (k_mutex_lock(&data->rx_lock, K_NO_WAIT)) {
+		return;
+	}
 
-		receive_character(dev, c, NULL);
+	/* The mode may have changed since the work was submitted */
+	while (!atomic_get(&data->in_dialog) && !atomic_get(&data->in_data_mode) &&
+	       !fill_block(dev, K_NO_WAIT)) {
+		receive_block(dev, false);
 	}
+
+	k_mutex_unlock(&data->rx_lock);
 }
 
 static void receive_in_data_mode(const struct device *dev)
@@ -241,7 +384,7 @@ static void rx_restart_work_handler(struct k_work *work)
 	struct ctr_lte_link_data *data =
 		CONTAINER_OF(work, struct ctr_lte_link_data, rx_restart_work);
 
-	k_pipe_reset(&data->rx_pipe);
+	reset_rx_pipe(data->dev);
 
 	atomic_set(&data->rx_line_synced, false);
 
@@ -269,7 +412,7 @@ static void rx_loss_work_handler(struct k_work *work)
 {
 	struct ctr_lte_link_data *data = CONTAINER_OF(work, struct ctr_lte_link_data, rx_loss_work);
 
-	k_pipe_reset(&data->rx_pipe);
+	reset_rx_pipe(data->dev);
 
 	atomic_set(&data->rx_line_synced, false);
 
@@ -309,11 +452,13 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 
 			if (ret != (int)rx->len) {
 				LOG_ERR("Call `k_pipe_write` failed: %d", ret);
+				atomic_inc(&data->rx_drops);
 				ret = k_work_submit(&data->rx_loss_work);
 				if (ret < 0) {
 					LOG_ERR("Call `k_work_submit` failed: %d", ret);
 				}
 			} else {
+				atomic_add(&data->rx_bytes, rx->len);
 				ret = k_work_submit(&data->rx_receive_work);
 				if (ret < 0) {
 					LOG_ERR("Call `k_work_submit` failed: %d", ret);
@@ -437,7 +582,7 @@ static int ctr_lte_link_wake_up_(const struct device *dev)
 	/* Message "Ready" from modem does not start with <LF>,
 	   so we fake it in order to synchronize the reception properly. */
 
-	k_pipe_reset(&get_data(dev)->rx_pipe);
+	reset_rx_pipe(dev);
 
 	char c = '\n';
 	ret = k_pipe_write(&get_data(dev)->rx_pipe, (const uint8_t *)&c, 1, K_NO_WAIT);
@@ -500,11 +645,10 @@ static int request_hfclk(const struct device *dev)
 
 static void purge_rx_fifo(const struct device *dev)
 {
-	char *p;
+	struct rx_line *item;
 
-	while ((p = k_fifo_get(&get_data(dev)->rx_fifo, K_NO_WAIT))) {
-		k_heap_free(&get_data(dev)->rx_heap, p);
-		LOG_DBG("Released from heap: %p", (void *)p);
+	while ((item = k_fifo_get(&get_data(dev)->rx_fifo, K_NO_WAIT))) {
+		free_line(dev, item);
 	}
 }
 
@@ -548,7 +692,7 @@ static int ctr_lte_link_enable_uart_(const struct device *dev)
 	atomic_set(&get_data(dev)->stop_request, false);
 	atomic_set(&get_data(dev)->rx_line_synced, false);
 
-	k_pipe_reset(&get_data(dev)->rx_pipe);
+	reset_rx_pipe(dev);
 
 	purge_rx_fifo(dev);
 
@@ -830,25 +974,30 @@ static int ctr_lte_link_recv_line_(const struct device *dev, k_timeout_t timeout
 	if (get_data(dev)->in_dialog) {
 		k_timepoint_t end = sys_timepoint_calc(timeout);
 
+		k_mutex_lock(&get_data(dev)->rx_lock, K_FOREVER);
+
 		bool received_line = false;
 		while (!received_line) {
 			if (sys_timepoint_expired(end)) {
+				k_mutex_unlock(&get_data(dev)->rx_lock);
 				k_mutex_unlock(&get_data(dev)->lock);
 				return -ETIMEDOUT;
 			}
 
-			char c;
-			ret = k_pipe_read(&get_data(dev)->rx_pipe, (uint8_t *)&c, 1,
-					  sys_timepoint_timeout(end));
-			if (ret != 1) {
+			ret = fill_block(dev, sys_timepoint_timeout(end));
+			if (ret) {
 				break;
 			}
 
-			receive_character(dev, c, &received_line);
+			received_line = receive_block(dev, true);
 		}
+
+		k_mutex_unlock(&get_data(dev)->rx_lock);
 	}
 
-	*line = k_fifo_get(&get_data(dev)->rx_fifo, K_NO_WAIT);
+	struct rx_line *item = k_fifo_get(&get_data(dev)->rx_fifo, K_NO_WAIT);
+
+	*line = item ? item->text : NULL;
 	if (*line) {
 		rx(*line);
 	}
@@ -871,8 +1020,7 @@ static int ctr_lte_link_free_line_(const struct device *dev, char *line)
 	// 	return -EBUSY;
 	// }
 
-	k_heap_free(&get_data(dev)->rx_heap, line);
-	LOG_DBG("Released from heap: %p", (void *)line);
+	free_line(dev, (struct rx_line *)(line - offsetof(struct rx_line, text)));
 
 	k_mutex_unlock(&get_data(dev)->lock);
 
@@ -942,7 +1090,10 @@ static int ctr_lte_link_recv_data_(const struct device *dev, k_timeout_t timeout
 		return -EPERM;
 	}
 
-	size_t total = 0;
+	/* Data following the last line may already be buffered by the line scanner */
+	k_mutex_lock(&get_data(dev)->rx_lock, K_FOREVER);
+	size_t total = take_block(dev, buf, size);
+	k_mutex_unlock(&get_data(dev)->rx_lock);
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	while (total < size) {
 		ret = k_pipe_read(&get_data(dev)->rx_pipe, (uint8_t *)buf + total,
@@ -962,6 +1113,19 @@ static int ctr_lte_link_recv_data_(const struct device *dev, k_timeout_t timeout
 	return 0;
 }
 
+static int ctr_lte_link_get_stats_(const struct device *dev, struct ctr_lte_link_stats *stats)
+{
+	struct ctr_lte_link_data *data = get_data(dev);
+
+	stats->rx_bytes = atomic_get(&data->rx_bytes);
+	stats->rx_lines = atomic_get(&data->rx_lines);
+	stats->rx_drops = atomic_get(&data->rx_drops);
+	stats->rx_pool_max = atomic_get(&data->rx_pool_max);
+	stats->rx_heap_max = atomic_get(&data->rx_heap_max);
+
+	return 0;
+}
+
 static int ctr_lte_link_drv_init(const struct device *dev)
 {
 	int ret;
@@ -971,8 +1135,10 @@ static int ctr_lte_link_drv_init(const struct device *dev)
 
 	k_fifo_init(&data->rx_fifo);
 	k_heap_init(&data->rx_heap, data->rx_heap_mem, RX_HEAP_MEM_SIZE);
+	k_mem_slab_init(&data->rx_pool, data->rx_pool_mem, RX_POOL_SLOT_SIZE, RX_POOL_SLOT_COUNT);
 	k_mem_slab_init(&data->rx_slab, data->rx_slab_mem, RX_SLAB_BLOCK_SIZE, RX_SLAB_BLOCK_COUNT);
 	k_mutex_init(&data->lock);
+	k_mutex_init(&data->rx_lock);
 	k_pipe_init(&data->rx_pipe, data->rx_pipe_buf, RX_PIPE_BUF_SIZE);
 	k_sem_init(&data->rx_disabled_sem, 0, 1);
 	k_sem_init(&data->tx_finished_sem, 0, 1);
@@ -1039,6 +1205,7 @@ static const struct ctr_lte_link_driver_api ctr_lte_link_driver_api = {
 	.free_line = ctr_lte_link_free_line_,
 	.send_data = ctr_lte_link_send_data_,
 	.recv_data = ctr_lte_link_recv_data_,
+	.get_stats = ctr_lte_link_get_stats_,
 };
 
 #define CTR_LTE_LINK_INIT(n)                                                                       \
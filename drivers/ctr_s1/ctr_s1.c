@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_s1_meas.h"
 #include "ctr_s1_reg.h"
 
 /* CHESTER includes */
@@ -39,8 +40,15 @@ struct ctr_s1_config {
 	bool auto_beep;
 };
 
+enum burst_state {
+	BURST_UNVERIFIED = 0,
+	BURST_VERIFIED,
+	BURST_BROKEN,
+};
+
 struct ctr_s1_data {
 	const struct device *dev;
+	enum burst_state burst_state;
 	struct k_work work;
 	struct gpio_callback gpio_cb;
 	ctr_s1_user_cb user_cb;
@@ -91,6 +99,81 @@ static int read(const struct device *dev, uint8_t reg, uint16_t *data)
 	return ret;
 }
 
+/* Reads consecutive registers in a single transfer, relies on the register address
+ * auto-incrementing in the module firmware (see read_span) */
+static int read_burst(const struct device *dev, uint8_t reg, uint8_t *buf, size_t len)
+{
+	int ret;
+
+	if (!device_is_ready(get_config(dev)->i2c_dev)) {
+		LOG_ERR("Device not ready");
+		return -ENODEV;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		ret = i2c_write_read(get_config(dev)->i2c_dev, get_config(dev)->i2c_addr, &reg, 1,
+				     buf, len);
+		if (!ret) {
+			return ret;
+		}
+
+		LOG_WRN("Call `i2c_write_read` failed: %d", ret);
+	}
+
+	LOG_ERR("Call `i2c_write_read` failed: %d", ret);
+
+	return ret;
+}
+
+/* Reads consecutive registers into big-endian words. With CONFIG_CTR_S1_BURST_READ, the first
+ * burst read is checked against the single register reads and used from then on only if they
+ * match - otherwise the single register reads stay in use. */
+static int read_span(const struct device *dev, uint8_t reg, uint8_t *buf, size_t count)
+{
+	int ret;
+
+	struct ctr_s1_data *data = get_data(dev);
+
+	if (IS_ENABLED(CONFIG_CTR_S1_BURST_READ) && data->burst_state != BURST_BROKEN) {
+		ret = read_burst(dev, reg, buf, count * 2);
+		if (ret) {
+			LOG_ERR("Call `read_burst` failed: %d", ret);
+			return ret;
+		}
+
+		if (data->burst_state == BURST_VERIFIED) {
+			return 0;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		uint16_t word;
+		ret = read(dev, reg + (uint8_t)i, &word);
+		if (ret) {
+			LOG_ERR("Call `read` failed: %d", ret);
+			return ret;
+		}
+
+		if (IS_ENABLED(CONFIG_CTR_S1_BURST_READ) && data->burst_state == BURST_UNVERIFIED &&
+		    sys_get_be16(&buf[i * 2]) != word) {
+			LOG_WRN("Burst read mismatch at register 0x%02x, using single reads",
+				reg + (uint8_t)i);
+			data->burst_state = BURST_BROKEN;
+		}
+
+		sys_put_be16(word, &buf[i * 2]);
+	}
+
+	/* A single register says nothing about the auto-increment */
+	if (IS_ENABLED(CONFIG_CTR_S1_BURST_READ) && data->burst_state == BURST_UNVERIFIED &&
+	    count > 1) {
+		LOG_INF("Burst read verified");
+		data->burst_state = BURST_VERIFIED;
+	}
+
+	return 0;
+}
+
 static int write(const struct device *dev, uint8_t reg, uint16_t data)
 {
 	int ret;
@@ -792,6 +875,151 @@ static int ctr_s1_read_co2_conc_(const struct device *dev, float *co2_conc)
 
 #undef WAIT_FOR_SIGNAL
 
+static struct k_poll_signal *get_signal(const struct device *dev, unsigned int quantity)
+{
+	switch (quantity) {
+	case CTR_S1_QUANTITY_CO2_CONC:
+		return &get_data(dev)->co2_conc_sig;
+	case CTR_S1_QUANTITY_TEMPERATURE:
+		return &get_data(dev)->temperature_sig;
+	case CTR_S1_QUANTITY_HUMIDITY:
+		return &get_data(dev)->humidity_sig;
+	case CTR_S1_QUANTITY_ILLUMINANCE:
+		return &get_data(dev)->illuminance_sig;
+	case CTR_S1_QUANTITY_PRESSURE:
+		return &get_data(dev)->pressure_sig;
+	case CTR_S1_QUANTITY_ALTITUDE:
+		return &get_data(dev)->altitude_sig;
+	default:
+		return NULL;
+	}
+}
+
+/* On timeout, pending keeps the quantities not converted yet */
+static int wait_for_signals(const struct device *dev, unsigned int *pending)
+{
+	int ret;
+
+	struct k_poll_event events[6];
+
+	while (*pending) {
+		int count = 0;
+
+		for (unsigned int q = BIT(0); q & CTR_S1_QUANTITY_ALL; q <<= 1) {
+			if (*pending & q) {
+				k_poll_event_init(&events[count++], K_POLL_TYPE_SIGNAL,
+						  K_POLL_MODE_NOTIFY_ONLY, get_signal(dev, q));
+			}
+		}
+
+		/* Conversions complete one after another, each of them gets the full timeout */
+		ret = k_poll(events, count, MAX_POLL_TIME);
+		if (ret == -EAGAIN) {
+			LOG_INF("Measurement timed out (pending: 0x%04x)", *pending);
+			return ret;
+		} else if (ret) {
+			LOG_ERR("Call `k_poll` failed: %d", ret);
+			return ret;
+		}
+
+		for (unsigned int q = BIT(0); q & CTR_S1_QUANTITY_ALL; q <<= 1) {
+			unsigned int signaled;
+			int result;
+
+			if (*pending & q) {
+				k_poll_signal_check(get_signal(dev, q), &signaled, &result);
+				if (signaled) {
+					*pending &= ~q;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int ctr_s1_measure_(const struct device *dev, unsigned int quantities,
+			   struct ctr_s1_measurement *measurement)
+{
+	int ret;
+
+	measurement->co2_conc = NAN;
+	measurement->temperature = NAN;
+	measurement->humidity = NAN;
+	measurement->illuminance = NAN;
+	measurement->pressure = NAN;
+	measurement->altitude = NAN;
+
+	quantities &= CTR_S1_QUANTITY_ALL;
+	if (!quantities) {
+		LOG_ERR("No quantity requested");
+		return -EINVAL;
+	}
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	k_mutex_lock(&get_data(dev)->read_lock, K_FOREVER);
+
+	if (!device_is_ready(dev)) {
+		LOG_ERR("Device not ready");
+		k_mutex_unlock(&get_data(dev)->read_lock);
+		return -ENODEV;
+	}
+
+	for (unsigned int q = BIT(0); q & CTR_S1_QUANTITY_ALL; q <<= 1) {
+		if (quantities & q) {
+			k_poll_signal_reset(get_signal(dev, q));
+		}
+	}
+
+	/* Start all measurements */
+	ret = write(dev, REG_MEASURE, quantities);
+	if (ret) {
+		LOG_ERR("Call `write` failed: %d", ret);
+		k_mutex_unlock(&get_data(dev)->read_lock);
+		return ret;
+	}
+
+	unsigned int pending = quantities;
+	int wait_ret = wait_for_signals(dev, &pending);
+	if (wait_ret && wait_ret != -EAGAIN) {
+		k_mutex_unlock(&get_data(dev)->read_lock);
+		return wait_ret;
+	}
+
+	/* Read out the quantities converted before a timeout */
+	quantities &= ~pending;
+
+	uint8_t reg;
+	size_t count;
+	ret = ctr_s1_meas_span(quantities, &reg, &count);
+	if (ret) {
+		k_mutex_unlock(&get_data(dev)->read_lock);
+		return wait_ret;
+	}
+
+	/* Read converted data */
+	uint8_t buf[CTR_S1_MEAS_REG_COUNT * 2];
+	ret = read_span(dev, reg, buf, count);
+	if (ret) {
+		LOG_ERR("Call `read_span` failed: %d", ret);
+		k_mutex_unlock(&get_data(dev)->read_lock);
+		return ret;
+	}
+
+	k_mutex_unlock(&get_data(dev)->read_lock);
+
+	ret = ctr_s1_meas_convert(quantities, reg, buf, measurement);
+	if (ret) {
+		LOG_ERR("Measurement error");
+		return ret;
+	}
+
+	return wait_ret;
+}
+
 static int ctr_s1_calib_tgt_co2_conc_(const struct device *dev, float tgt_co2_conc)
 {
 	int ret;
@@ -975,6 +1203,7 @@ static const struct ctr_s1_driver_api ctr_s1_driver_api = {
 	.read_altitude = ctr_s1_read_altitude_,
 	.read_pressure = ctr_s1_read_pressure_,
 	.read_co2_conc = ctr_s1_read_co2_conc_,
+	.measure = ctr_s1_measure_,
 	.calib_tgt_co2_conc = ctr_s1_calib_tgt_co2_conc_,
 };
 
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_s1_meas.h"
+#include "ctr_s1_reg.h"
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_s1.h>
+
+/* Zephyr includes */
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct quantity {
+	unsigned int mask;
+	uint8_t reg;
+	uint8_t reg_count;
+};
+
+static const struct quantity m_quantities[] = {
+	{CTR_S1_QUANTITY_CO2_CONC, REG_CO2CONC, 1},
+	{CTR_S1_QUANTITY_TEMPERATURE, REG_TEMPERATURE, 1},
+	{CTR_S1_QUANTITY_HUMIDITY, REG_HUMIDITY, 1},
+	{CTR_S1_QUANTITY_ILLUMINANCE, REG_ILLUM0, 2},
+	{CTR_S1_QUANTITY_PRESSURE, REG_PRESSURE0, 2},
+	{CTR_S1_QUANTITY_ALTITUDE, REG_ALTITUDE, 1},
+};
+
+BUILD_ASSERT(CTR_S1_MEAS_REG_COUNT == REG_PRESSURE1 - REG_CO2CONC + 1);
+
+static int convert(unsigned int mask, const uint8_t *buf, struct ctr_s1_measurement *measurement)
+{
+	uint16_t reg = sys_get_be16(&buf[0]);
+	uint32_t reg32;
+
+	switch (mask) {
+	case CTR_S1_QUANTITY_CO2_CONC:
+		if (reg == UINT16_MAX) {
+			return -EINVAL;
+		}
+		measurement->co2_conc = reg;
+		break;
+	case CTR_S1_QUANTITY_TEMPERATURE:
+		if ((int16_t)reg == INT16_MAX) {
+			return -EINVAL;
+		}
+		measurement->temperature = (int16_t)reg / 100.f;
+		break;
+	case CTR_S1_QUANTITY_HUMIDITY:
+		if (reg == UINT16_MAX) {
+			return -EINVAL;
+		}
+		measurement->humidity = reg / 100.f;
+		break;
+	case CTR_S1_QUANTITY_ILLUMINANCE:
+		reg32 = (uint32_t)sys_get_be16(&buf[2]) << 16 | reg;
+		if (reg32 == UINT32_MAX) {
+			return -EINVAL;
+		}
+		measurement->illuminance = reg32;
+		break;
+	case CTR_S1_QUANTITY_PRESSURE:
+		reg32 = (uint32_t)sys_get_be16(&buf[2]) << 16 | reg;
+		if (reg32 == UINT32_MAX) {
+			return -EINVAL;
+		}
+		measurement->pressure = reg32;
+		break;
+	case CTR_S1_QUANTITY_ALTITUDE:
+		if ((int16_t)reg == INT16_MAX) {
+			return -EINVAL;
+		}
+		measurement->altitude = (int16_t)reg;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int ctr_s1_meas_span(unsigned int quantities, uint8_t *reg, size_t *count)
+{
+	uint8_t first = REG_PRESSURE1;
+	uint8_t last = REG_CO2CONC;
+
+	quantities &= CTR_S1_QUANTITY_ALL;
+
+	if (!quantities) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_quantities); i++) {
+		const struct quantity *q = &m_quantities[i];
+
+		if (quantities & q->mask) {
+			first = MIN(first, q->reg);
+			last = MAX(last, q->reg + q->reg_count - 1);
+		}
+	}
+
+	*reg = first;
+	*count = last - first + 1;
+
+	return 0;
+}
+
+int ctr_s1_meas_convert(unsigned int quantities, uint8_t reg, const uint8_t *buf,
+			struct ctr_s1_measurement *measurement)
+{
+	int ret = 0;
+
+	measurement->co2_conc = NAN;
+	measurement->temperature = NAN;
+	measurement->humidity = NAN;
+	measurement->illuminance = NAN;
+	measurement->pressure = NAN;
+	measurement->altitude = NAN;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_quantities); i++) {
+		const struct quantity *q = &m_quantities[i];
+
+		if (!(quantities & q->mask)) {
+			continue;
+		}
+
+		if (q->reg < reg) {
+			ret = -EINVAL;
+			continue;
+		}
+
+		if (convert(q->mask, &buf[(q->reg - reg) * 2], measurement)) {
+			ret = -EINVAL;
+		}
+	}
+
+	return ret;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_DRIVERS_CTR_S1_CTR_S1_MEAS_H_
+#define CHESTER_DRIVERS_CTR_S1_CTR_S1_MEAS_H_
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_s1.h>
+
+/* Standard includes */
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Result registers of all quantities, REG_CO2CONC to REG_PRESSURE1 */
+#define CTR_S1_MEAS_REG_COUNT 9
+
+/* Smallest register range holding the results of the requested quantities */
+int ctr_s1_meas_span(unsigned int quantities, uint8_t *reg, size_t *count);
+
+/* Converts the big-endian registers read from the span start, returns -EINVAL when any
+ * requested quantity reports a measurement error (the others are still converted) */
+int ctr_s1_meas_convert(unsigned int quantities, uint8_t reg, const uint8_t *buf,
+			struct ctr_s1_measurement *measurement);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_DRIVERS_CTR_S1_CTR_S1_MEAS_H_ */
@@ -70,28 +70,43 @@ static int ctr_x3_set_power_(const struct device *dev, enum ctr_x3_channel chann
 	return 0;
 }
 
-static int ctr_x3_measure_(const struct device *dev, enum ctr_x3_channel channel, int32_t *result)
+static const struct device *get_adc_dev(const struct device *dev, enum ctr_x3_channel channel)
 {
-	int ret;
-
-	const struct device *adc_dev;
-
 	switch (channel) {
 	case CTR_X3_CHANNEL_1:
-		adc_dev = get_config(dev)->adc0_dev;
-		break;
+		return get_config(dev)->adc0_dev;
 	case CTR_X3_CHANNEL_2:
-		adc_dev = get_config(dev)->adc1_dev;
-		break;
+		return get_config(dev)->adc1_dev;
 	default:
+		return NULL;
+	}
+}
+
+static int ctr_x3_measure_burst_(const struct device *dev, enum ctr_x3_channel channel,
+				 int32_t *samples, size_t count)
+{
+	int ret;
+
+	const struct device *adc_dev = get_adc_dev(dev, channel);
+	if (!adc_dev) {
 		LOG_ERR("Unknown channel: %d", channel);
 		return -EINVAL;
 	}
 
+	if (!count || count > UINT16_MAX + 1) {
+		LOG_ERR("Invalid sample count: %zu", count);
+		return -EINVAL;
+	}
+
+	const struct adc_sequence_options options = {
+		.extra_samplings = count - 1,
+	};
+
 	const struct adc_sequence sequence = {
+		.options = &options,
 		.channels = BIT(0),
-		.buffer = result,
-		.buffer_size = sizeof(*result),
+		.buffer = samples,
+		.buffer_size = count * sizeof(*samples),
 		.resolution = 24,
 	};
 
@@ -104,6 +119,11 @@ static int ctr_x3_measure_(const struct device *dev, enum ctr_x3_channel channel
 	return 0;
 }
 
+static int ctr_x3_measure_(const struct device *dev, enum ctr_x3_channel channel, int32_t *result)
+{
+	return ctr_x3_measure_burst_(dev, channel, result, 1);
+}
+
 static int ctr_x3_init(const struct device *dev)
 {
 	int ret;
@@ -172,6 +192,7 @@ static int ctr_x3_init(const struct device *dev)
 static const struct ctr_x3_driver_api ctr_x3_driver_api = {
 	.set_power = ctr_x3_set_power_,
 	.measure = ctr_x3_measure_,
+	.measure_burst = ctr_x3_measure_burst_,
 };
 
 #define CTR_X3_INIT(n)                                                                             \
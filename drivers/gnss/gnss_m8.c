@@ -29,6 +29,7 @@ struct m8_config {
 	const struct i2c_dt_spec i2c_spec;
 	const struct gpio_dt_spec main_en_spec;
 	const struct gpio_dt_spec bckp_en_spec;
+	const struct gpio_dt_spec txready_spec;
 };
 
 struct m8_data {
@@ -115,6 +116,42 @@ static int m8_read_buffer_(const struct device *dev, void *buf, size_t buf_size,
 	return 0;
 }
 
+static int m8_write_buffer_(const struct device *dev, const void *buf, size_t len)
+{
+	int ret;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	ret = i2c_write_dt(&get_config(dev)->i2c_spec, buf, len);
+	if (ret) {
+		LOG_ERR("Buffer writing failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int m8_get_tx_ready_(const struct device *dev, bool *ready)
+{
+	int ret;
+
+	if (!get_config(dev)->txready_spec.port) {
+		return -ENOTSUP;
+	}
+
+	ret = gpio_pin_get_dt(&get_config(dev)->txready_spec);
+	if (ret < 0) {
+		LOG_ERR("Pin `TX READY` reading failed: %d", ret);
+		return ret;
+	}
+
+	*ready = ret == 1;
+
+	return 0;
+}
+
 static int m8_init(const struct device *dev)
 {
 	int ret;
@@ -141,6 +178,19 @@ static int m8_init(const struct device *dev)
 		return ret;
 	}
 
+	if (get_config(dev)->txready_spec.port) {
+		if (!device_is_ready(get_config(dev)->txready_spec.port)) {
+			LOG_ERR("Port `TX READY` not ready");
+			return -EINVAL;
+		}
+
+		ret = gpio_pin_configure_dt(&get_config(dev)->txready_spec, GPIO_INPUT);
+		if (ret) {
+			LOG_ERR("Pin `TX READY` configuration failed: %d", ret);
+			return ret;
+		}
+	}
+
 	return 0;
 }
 
@@ -148,6 +198,8 @@ static const struct m8_driver_api m8_driver_api = {
 	.set_main_power = m8_set_main_power_,
 	.set_bckp_power = m8_set_bckp_power_,
 	.read_buffer = m8_read_buffer_,
+	.write_buffer = m8_write_buffer_,
+	.get_tx_ready = m8_get_tx_ready_,
 };
 
 #define M8_INIT(n)                                                                                 \
@@ -155,6 +207,7 @@ static const struct m8_driver_api m8_driver_api = {
 		.i2c_spec = I2C_DT_SPEC_INST_GET(n),                                               \
 		.main_en_spec = GPIO_DT_SPEC_INST_GET(n, main_en_gpios),                           \
 		.bckp_en_spec = GPIO_DT_SPEC_INST_GET(n, bckp_en_gpios),                           \
+		.txready_spec = GPIO_DT_SPEC_INST_GET_OR(n, txready_gpios, {0}),                   \
 	};                                                                                         \
 	static struct m8_data inst_##n##_data = {                                                  \
 		.dev = DEVICE_DT_INST_GET(n),                                                      \
@@ -7,6 +7,9 @@
 #ifndef CHESTER_INCLUDE_CTR_ACCEL_H_
 #define CHESTER_INCLUDE_CTR_ACCEL_H_
 
+/* Standard includes */
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,8 +19,45 @@ extern "C" {
  * @{
  */
 
+/* Returns -EBUSY while streaming is active */
 int ctr_accel_read(float *accel_x, float *accel_y, float *accel_z, int *orientation);
 
+/* FFT band energies split 0 Hz to the Nyquist frequency into equally wide bands */
+#define CTR_ACCEL_VIB_BAND_COUNT 4
+
+enum ctr_accel_axis {
+	CTR_ACCEL_AXIS_X = 0,
+	CTR_ACCEL_AXIS_Y = 1,
+	CTR_ACCEL_AXIS_Z = 2,
+};
+
+/* Vibration features of one axis over the window - the mean (gravity) is removed first, so rms
+ * and band energies only cover the AC part, band energies sum up to rms^2 */
+struct ctr_accel_vib_axis {
+	float rms;
+	float p2p;
+	float kurtosis;
+	float band[CTR_ACCEL_VIB_BAND_COUNT];
+};
+
+struct ctr_accel_vib {
+	int sample_rate;
+	int window;
+	struct ctr_accel_vib_axis axis[3];
+};
+
+typedef void (*ctr_accel_stream_cb_t)(const struct ctr_accel_vib *vib, void *user_data);
+
+/* Sample rate is one of 10, 25, 50, 100, 200 or 400 Hz, window is a power of two samples. The
+ * callback is called after every window from the LIS2DH12 driver trigger context - the system work
+ * queue with CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD, the driver thread with
+ * CONFIG_LIS2DH_TRIGGER_OWN_THREAD - with the stream lock held, so it must not block. With the
+ * global thread, starting from the system work queue returns -EDEADLK */
+int ctr_accel_stream_start(int sample_rate, int window, ctr_accel_stream_cb_t cb,
+			   void *user_data);
+int ctr_accel_stream_stop(void);
+bool ctr_accel_stream_is_active(void);
+
 /** @} */
 
 #ifdef __cplusplus
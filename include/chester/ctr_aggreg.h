@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_INCLUDE_CTR_AGGREG_H_
+#define CHESTER_INCLUDE_CTR_AGGREG_H_
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup ctr_aggreg ctr_aggreg
+ * @{
+ */
+
+/**
+ * Streaming aggregator - min/max/avg are exact, the median is estimated with the P-square
+ * algorithm (exact up to 5 samples) so no sample array has to be kept. The estimate assumes
+ * a stationary signal - use ctr_aggreg_array() where the exact median matters.
+ */
+struct ctr_aggreg {
+	uint32_t count;
+	bool invalid;
+	double sum;
+	/* P-square marker heights, positions and desired positions */
+	float q[5];
+	int32_t n[5];
+	float np[5];
+};
+
+void ctr_aggreg_reset(struct ctr_aggreg *aggreg);
+void ctr_aggreg_add(struct ctr_aggreg *aggreg, float value);
+
+/* All results are NAN when no sample was added or any of the samples was NAN */
+void ctr_aggreg_get(const struct ctr_aggreg *aggreg, float *min, float *max, float *avg,
+		    float *mdn);
+
+/* Exact aggregation over a sample array in O(n) - the array is reordered in place */
+void ctr_aggreg_array(float *samples, size_t count, float *min, float *max, float *avg,
+		      float *mdn);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_INCLUDE_CTR_AGGREG_H_ */
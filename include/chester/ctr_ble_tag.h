@@ -55,6 +55,17 @@ extern "C" {
  * @{
  */
 
+/* Radio usage of the periodic scan (times in milliseconds) */
+struct ctr_ble_tag_scan_stats {
+	int64_t last_radio_on;
+	int64_t total_radio_on;
+	uint32_t cycles;
+	/* Cycles stopped before the window ended, every enrolled tag heard */
+	uint32_t early_cycles;
+	int last_heard;
+	int last_enrolled;
+};
+
 int ctr_ble_tag_enable(bool enabled);
 int ctr_ble_tag_add(char *addr);
 int ctr_ble_tag_remove_addr(char *addr);
@@ -72,6 +83,7 @@ int ctr_ble_tag_read_cached(size_t slot, uint8_t addr[BT_ADDR_SIZE], int8_t *rss
 			    bool *low_battery, int16_t *sensor_mask, bool *valid);
 
 int ctr_ble_tag_is_addr_empty(const uint8_t addr[BT_ADDR_SIZE]);
+int ctr_ble_tag_get_scan_stats(struct ctr_ble_tag_scan_stats *stats);
 
 /** @} */
 
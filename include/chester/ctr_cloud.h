@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 
 /* Standard includes */
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #ifdef __cplusplus
@@ -49,6 +50,11 @@ struct ctr_cloud_metrics {
 	uint32_t uplink_data_count;  /**< Number of data messages sent. */
 	int64_t uplink_data_last_ts; /**< Timestamp of last data message sent (sec). */
 
+	uint32_t uplink_batch_count;    /**< Number of batched spool uplinks. */
+	uint32_t uplink_batch_messages; /**< Number of spooled messages sent in batches. */
+	uint32_t uplink_batch_bytes;    /**< Total bytes of batched spool uplinks. */
+	int64_t uplink_batch_last_ts;   /**< Timestamp of last batched spool uplink (sec). */
+
 	uint32_t downlink_data_count;  /**< Number of data messages received. */
 	int64_t downlink_data_last_ts; /**< Timestamp of last data message received (sec). */
 
@@ -73,6 +79,11 @@ struct ctr_cloud_session {
 	int64_t timestamp;
 	char device_id[36 + 1];
 	char device_name[32 + 1];
+	uint8_t transfer_window; /**< Uplink window accepted by server (0 or 1 = stop-and-wait). */
+	bool transfer_binary;    /**< Server accepted binary (non-base64) packets. */
+	uint8_t compression;     /**< Payload codecs accepted by server (bitmask). */
+	uint32_t batch_size;     /**< Batch uplink size accepted by server (0 = no batching). */
+	bool config_snapshot;    /**< Server accepted structured configuration upload. */
 };
 
 enum ctr_cloud_event {
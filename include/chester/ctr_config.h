@@ -144,11 +144,43 @@ struct ctr_config_item {
 };
 
 typedef int (*ctr_config_show_cb)(const struct shell *shell, size_t argc, char **argv);
+typedef int (*ctr_config_items_cb)(const struct ctr_config_item *items, int nitems,
+				   void *user_data);
+typedef int (*ctr_config_commit_cb)(void);
 
 int ctr_config_save(bool reboot);
 int ctr_config_reset(bool reboot);
 void ctr_config_append_show(const char *name, ctr_config_show_cb cb);
 
+/* Registers an item table for the structured export (tables are visited in registration order) */
+void ctr_config_append_items(const struct ctr_config_item *items, int nitems);
+int ctr_config_foreach_items(ctr_config_items_cb cb, void *user_data);
+
+/* Marks a registered table as not covering all settings of its module (e.g. custom arrays) */
+int ctr_config_set_items_partial(const struct ctr_config_item *items);
+
+/* True when every module registered with a show callback has a complete item table */
+bool ctr_config_is_items_complete(void);
+
+/**
+ * Declares the items of a registered table (NULL terminated list of names) that take effect
+ * without reboot - the commit callback copies the interim values into the active configuration
+ */
+int ctr_config_set_hot_items(const struct ctr_config_item *items, const char *const *names,
+			     ctr_config_commit_cb commit_cb);
+
+/**
+ * Writes the items changed since the last load or save to settings. When all of them are hot, the
+ * commit callbacks of their tables are called, otherwise the device reboots (if allowed) to apply
+ * them - is_reboot_needed (optional) reports which of the two is the case. When a module has no
+ * complete item table (see ctr_config_is_items_complete), all settings are saved and a reboot is
+ * always needed.
+ */
+int ctr_config_apply(bool reboot, bool *is_reboot_needed);
+
+/* CRC32 of the item value (strings up to the terminator) */
+uint32_t ctr_config_get_item_digest(const struct ctr_config_item *item);
+
 int ctr_config_show_item(const struct shell *shell, const struct ctr_config_item *item);
 int ctr_config_help_item(const struct shell *shell, const struct ctr_config_item *item);
 int ctr_config_parse_item(const struct shell *shell, char *argv,
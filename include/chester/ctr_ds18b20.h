@@ -19,10 +19,19 @@ extern "C" {
  * @{
  */
 
+struct ctr_ds18b20_sample {
+	uint64_t serial_number;
+	/* NAN if the sensor could not be read */
+	float temperature;
+};
+
 int ctr_ds18b20_scan(void);
 int ctr_ds18b20_get_count(void);
 int ctr_ds18b20_read(int index, uint64_t *serial_number, float *temperature);
 
+/* Single conversion for all sensors on the bus, returns the number of filled samples */
+int ctr_ds18b20_read_all(struct ctr_ds18b20_sample *samples, int max_count);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -26,6 +26,7 @@ enum ctr_gnss_event {
 	CTR_GNSS_EVENT_STOP_OK = 2,
 	CTR_GNSS_EVENT_STOP_ERR = 3,
 	CTR_GNSS_EVENT_UPDATE = 4,
+	CTR_GNSS_EVENT_SESSION_END = 5,
 };
 
 struct ctr_gnss_data_start_ok {
@@ -50,6 +51,22 @@ struct ctr_gnss_data_update {
 	float latitude;
 	float longitude;
 	float altitude;
+	/* Horizontal and vertical accuracy estimate in metres, NAN when not reported */
+	float h_acc;
+	float v_acc;
+};
+
+/** @brief Session ended, the receiver has been stopped with the backup domain kept */
+struct ctr_gnss_data_session_end {
+	int corr_id;
+	/* The target was reached, otherwise the maximum duration elapsed */
+	bool fix;
+	/* Time to the first fix in milliseconds, -1 when none was acquired */
+	int ttff;
+	/* Session duration in milliseconds */
+	int duration;
+	/* Most accurate update of the session */
+	struct ctr_gnss_data_update update;
 };
 
 union ctr_gnss_event_data {
@@ -58,6 +75,33 @@ union ctr_gnss_event_data {
 	struct ctr_gnss_data_stop_ok stop_ok;
 	struct ctr_gnss_data_stop_err stop_err;
 	struct ctr_gnss_data_update update;
+	struct ctr_gnss_data_session_end session_end;
+};
+
+struct ctr_gnss_session_config {
+	/* Target horizontal accuracy in metres, 0 to accept any fix (not checked when the backend
+	 * does not report accuracy) */
+	float accuracy;
+	/* Minimum number of satellites, 0 to accept any (not checked when not reported) */
+	int min_satellites;
+	/* Maximum session duration in seconds */
+	int max_duration;
+};
+
+#define CTR_GNSS_SESSION_CONFIG_DEFAULTS                                                           \
+	{                                                                                          \
+		.accuracy = 10.f, .min_satellites = 4, .max_duration = 300,                        \
+	}
+
+struct ctr_gnss_session_stats {
+	int sessions;
+	int fixes;
+	int timeouts;
+	/* Time to first fix in milliseconds, -1 when no session has acquired a fix yet */
+	int last_ttff;
+	int min_ttff;
+	int max_ttff;
+	int avg_ttff;
 };
 
 typedef void (*ctr_gnss_user_cb)(enum ctr_gnss_event event, union ctr_gnss_event_data *data,
@@ -69,6 +113,16 @@ int ctr_gnss_stop(bool keep_bckp_domain, int *corr_id);
 int ctr_gnss_is_running(bool *running);
 int ctr_gnss_get_last_data_update(struct ctr_gnss_data_update *data_update);
 
+/**
+ * @brief Start the receiver until a fix meets the target or the maximum duration elapses
+ *
+ * The receiver is stopped automatically with the backup domain kept for a hot start of the next
+ * session, CTR_GNSS_EVENT_SESSION_END reports the result. Updates are forwarded as usual while
+ * the session runs. A running session is replaced, ctr_gnss_stop() cancels it.
+ */
+int ctr_gnss_start_session(const struct ctr_gnss_session_config *config, int *corr_id);
+int ctr_gnss_get_session_stats(struct ctr_gnss_session_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -25,6 +25,7 @@ typedef void (*ctr_lrw_v2_recv_cb)(enum ctr_lrw_v2_event event, const char *line
 
 struct send_msgq_data {
 	int64_t ttl;
+	int priority;
 	bool confirmed;
 	int port;
 	void *buf;
@@ -32,14 +33,17 @@ struct send_msgq_data {
 };
 
 struct ctr_lrw_send_opts {
+	/* Uptime in milliseconds after which the queued message is dropped, zero for no expiry */
 	int64_t ttl;
+	/* Messages with a higher priority are sent first and may evict lower ones from full queue */
+	int priority;
 	bool confirmed;
 	int port;
 };
 
 #define CTR_LRW_SEND_OPTS_DEFAULTS                                                                 \
 	{                                                                                          \
-		.ttl = 0, .confirmed = false, .port = -1,                                          \
+		.ttl = 0, .priority = 0, .confirmed = false, .port = -1,                           \
 	}
 
 int ctr_lrw_v2_init(ctr_lrw_v2_recv_cb recv_cb);
@@ -142,6 +142,11 @@ struct ctr_lte_v2_metrics {
 
 	uint32_t cscon_1_duration_ms;      /**< Total time in RRC Connected (CSCON=1). */
 	uint32_t cscon_1_last_duration_ms; /**< Duration of last RRC Connected period. */
+
+	uint32_t prepare_count;            /**< Number of modem prepare runs. */
+	uint32_t prepare_cached_count;     /**< Prepare runs reusing the cached configuration. */
+	uint32_t prepare_duration_ms;      /**< Total prepare duration (ms). */
+	uint32_t prepare_last_duration_ms; /**< Duration of last prepare (ms). */
 };
 
 /**
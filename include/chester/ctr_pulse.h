@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_INCLUDE_CTR_PULSE_H_
+#define CHESTER_INCLUDE_CTR_PULSE_H_
+
+/* Zephyr includes */
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/kernel.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup ctr_pulse ctr_pulse
+ * @{
+ */
+
+/* Physical pin transition that is counted */
+enum ctr_pulse_edge {
+	CTR_PULSE_EDGE_RISING = 0,
+	CTR_PULSE_EDGE_FALLING = 1,
+	CTR_PULSE_EDGE_BOTH = 2,
+};
+
+struct ctr_pulse;
+
+typedef void (*ctr_pulse_cb_t)(struct ctr_pulse *pulse, uint64_t count, void *user_data);
+
+/**
+ * Hardware pulse counter - pulses are counted without CPU involvement, the CPU only wakes up on
+ * readout or when the threshold set by ctr_pulse_set_callback() is reached.
+ */
+struct ctr_pulse {
+	const struct gpio_dt_spec *spec;
+	enum ctr_pulse_edge edge;
+	int holdoff_us;
+	uint32_t threshold;
+	ctr_pulse_cb_t cb;
+	void *user_data;
+	bool is_running;
+	uint64_t count;
+	uint32_t last_raw;
+	struct k_mutex lock;
+	struct k_work threshold_work;
+	/* Backend state */
+	int slot;
+	int holdoff_slot;
+#if defined(CONFIG_CTR_PULSE_BACKEND_MOCK)
+	uint32_t mock_raw;
+	uint32_t mock_compare;
+	bool mock_compare_enabled;
+#endif /* defined(CONFIG_CTR_PULSE_BACKEND_MOCK) */
+};
+
+/* Hold-off of 0 disables the glitch filter, otherwise edges closer than the hold-off are
+ * counted as a single pulse once the input has settled */
+int ctr_pulse_init(struct ctr_pulse *pulse, const struct gpio_dt_spec *spec,
+		   enum ctr_pulse_edge edge, int holdoff_us);
+
+/* Callback is called from the system work queue every threshold pulses (0 disables it) */
+int ctr_pulse_set_callback(struct ctr_pulse *pulse, uint32_t threshold, ctr_pulse_cb_t cb,
+			   void *user_data);
+
+int ctr_pulse_start(struct ctr_pulse *pulse);
+int ctr_pulse_stop(struct ctr_pulse *pulse);
+
+/* Total pulse count since ctr_pulse_init - the hardware counter is 32-bit, so it has to be read
+ * at least once per 2^32 pulses */
+int ctr_pulse_read(struct ctr_pulse *pulse, uint64_t *count);
+
+#if defined(CONFIG_CTR_PULSE_BACKEND_MOCK)
+void ctr_pulse_mock_inject(struct ctr_pulse *pulse, uint32_t pulses);
+#endif /* defined(CONFIG_CTR_PULSE_BACKEND_MOCK) */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_INCLUDE_CTR_PULSE_H_ */
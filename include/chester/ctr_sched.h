@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_INCLUDE_CTR_SCHED_H_
+#define CHESTER_INCLUDE_CTR_SCHED_H_
+
+/* Zephyr includes */
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup ctr_sched ctr_sched
+ * @{
+ */
+
+/* Tasks of group 0 do not share any resource */
+#define CTR_SCHED_GROUP_NONE 0
+
+struct ctr_sched;
+struct ctr_sched_task;
+
+typedef void (*ctr_sched_task_cb_t)(struct ctr_sched_task *task);
+
+/* Called around the tasks of one group in a batch, e.g. to power up a shared bus only once */
+typedef void (*ctr_sched_group_cb_t)(struct ctr_sched *sched, int group, bool enter);
+
+/* Returns the current time in milliseconds */
+typedef int64_t (*ctr_sched_clock_t)(void);
+
+/**
+ * Periodic (or one-shot with zero period) task - it runs within [deadline, deadline + tolerance],
+ * so due tasks coalesce into a single wakeup as long as their tolerance windows overlap. The
+ * deadlines keep their phase, a late run does not shift the following ones.
+ */
+struct ctr_sched_task {
+	ctr_sched_task_cb_t cb;
+	int group;
+	int64_t period;
+	int64_t tolerance;
+
+	/* Nominal time of the current run - valid in the callback */
+	int64_t deadline;
+	uint32_t runs;
+
+	/* Private */
+	sys_snode_t node;
+	int64_t due;
+	bool is_active;
+	bool is_pending;
+	bool is_urgent;
+};
+
+struct ctr_sched {
+	struct k_mutex lock;
+	sys_slist_t tasks;
+	struct k_work_q *work_q;
+	struct k_work_delayable work;
+	ctr_sched_clock_t clock;
+	ctr_sched_group_cb_t group_cb;
+	/* Number of batches run so far */
+	uint32_t wakeups;
+};
+
+/**
+ * Without a work queue the scheduler does not arm any timer and ctr_sched_process() is called by
+ * the user - the clock defaults to k_uptime_get() and both may be replaced for simulated time.
+ */
+void ctr_sched_init(struct ctr_sched *sched, struct k_work_q *work_q, ctr_sched_clock_t clock,
+		    ctr_sched_group_cb_t group_cb);
+
+/* Registers an inactive task - tasks of a batch run in the registration order within a group */
+void ctr_sched_add(struct ctr_sched *sched, struct ctr_sched_task *task);
+
+/* Changes the interval (ms) of a registered task, effective from its next run */
+void ctr_sched_set_period(struct ctr_sched *sched, struct ctr_sched_task *task, int64_t period,
+			  int64_t tolerance);
+
+/**
+ * (Re)starts the task with the first deadline after the delay (ms) - with zero delay the first run
+ * does not wait for the tolerance, so on-demand requests are served right away
+ */
+void ctr_sched_start(struct ctr_sched *sched, struct ctr_sched_task *task, int64_t delay);
+void ctr_sched_stop(struct ctr_sched *sched, struct ctr_sched_task *task);
+
+/* Runs all due tasks as one batch and returns the next wakeup time (INT64_MAX when idle) - the
+ * callbacks run without the scheduler lock held */
+int64_t ctr_sched_process(struct ctr_sched *sched);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_INCLUDE_CTR_SCHED_H_ */
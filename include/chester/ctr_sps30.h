@@ -8,6 +8,7 @@
 #define CHESTER_INCLUDE_CTR_SPS30_H_
 
 /* Standard includes */
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -18,6 +19,56 @@ extern "C" {
  * @addtogroup ctr_sps30 ctr_sps30
  * @{
  */
+
+/** @brief Measurement averaged over the readings of one sample window */
+struct ctr_sps30_data {
+	float mass_conc_pm_1_0;
+	float mass_conc_pm_2_5;
+	float mass_conc_pm_4_0;
+	float mass_conc_pm_10_0;
+	float num_conc_pm_0_5;
+	float num_conc_pm_1_0;
+	float num_conc_pm_2_5;
+	float num_conc_pm_4_0;
+	float num_conc_pm_10_0;
+	/** Number of averaged readings */
+	int count;
+};
+
+/**
+ * @brief Callback of the asynchronous read, invoked from the system work queue
+ *
+ * @param result 0 on success, negative error code otherwise (data is not valid)
+ */
+typedef void (*ctr_sps30_read_cb)(int result, const struct ctr_sps30_data *data,
+				  void *user_data);
+
+/**
+ * @brief Start an asynchronous measurement
+ *
+ * Powers the sensor and returns immediately. After the fan warm-up, the given number of readings
+ * (one per second) is averaged and passed to the callback. The sensor is powered off afterwards
+ * unless the continuous mode is enabled, in which case the next measurement starts without the
+ * warm-up.
+ *
+ * @retval -EBUSY Another measurement is in progress
+ */
+int ctr_sps30_read_async(int readings, ctr_sps30_read_cb cb, void *user_data);
+
+/**
+ * @brief Keep the sensor running between measurements
+ *
+ * Enabling starts the warm-up right away, disabling powers the sensor off once the measurement
+ * in progress (if any) completes.
+ */
+int ctr_sps30_set_continuous(bool enable);
+
+/**
+ * @brief Blocking single reading, waits for the warm-up unless in continuous mode
+ *
+ * Must not be called from the system work queue (including the read callback), which drives the
+ * measurement - returns -EDEADLK there, use ctr_sps30_read_async instead.
+ */
 int ctr_sps30_read(float *mass_conc_pm_1_0, float *mass_conc_pm_2_5, float *mass_conc_pm_4_0,
 		   float *mass_conc_pm_10_0, float *num_conc_pm_0_5, float *num_conc_pm_1_0,
 		   float *num_conc_pm_2_5, float *num_conc_pm_4_0, float *num_conc_pm_10_0);
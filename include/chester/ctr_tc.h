@@ -25,6 +25,13 @@ enum ctr_tc_channel {
 
 enum ctr_tc_type {
 	CTR_TC_TYPE_K = 0,
+	CTR_TC_TYPE_J = 1,
+	CTR_TC_TYPE_T = 2,
+	CTR_TC_TYPE_E = 3,
+	CTR_TC_TYPE_N = 4,
+	CTR_TC_TYPE_R = 5,
+	CTR_TC_TYPE_S = 6,
+	CTR_TC_TYPE_B = 7,
 };
 
 int ctr_tc_read(enum ctr_tc_channel channel, enum ctr_tc_type type, float *temperature);
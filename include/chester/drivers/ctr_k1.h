@@ -47,17 +47,43 @@ struct ctr_k1_result {
 	float rms;
 };
 
+/* Harmonics 1 (fundamental) up to this order are reported for each mains cycle */
+#define CTR_K1_HARMONIC_COUNT 5
+
+/* Power-quality metrics of a single mains cycle (values in millivolts) */
+struct ctr_k1_cycle {
+	float avg;
+	float rms;
+	float peak;
+	float crest;
+	/* RMS magnitude of the harmonics, index 0 is the fundamental */
+	float harmonics[CTR_K1_HARMONIC_COUNT];
+};
+
+/* Called from the driver thread after every mains cycle, cycles[] follows the order of the
+ * channels passed to ctr_k1_stream_start() */
+typedef void (*ctr_k1_stream_cb_t)(const struct device *dev, const struct ctr_k1_cycle cycles[],
+				   size_t channels_count, void *user_data);
+
 /** @private */
 typedef int (*ctr_k1_api_set_power)(const struct device *dev, enum ctr_k1_channel channel,
 				    bool is_enabled);
 /** @private */
 typedef int (*ctr_k1_api_measure)(const struct device *dev, const enum ctr_k1_channel channels[],
 				  size_t channels_count, struct ctr_k1_result results[]);
+/** @private */
+typedef int (*ctr_k1_api_stream_start)(const struct device *dev,
+				       const enum ctr_k1_channel channels[], size_t channels_count,
+				       int mains_freq, ctr_k1_stream_cb_t cb, void *user_data);
+/** @private */
+typedef int (*ctr_k1_api_stream_stop)(const struct device *dev);
 
 /** @private */
 struct ctr_k1_driver_api {
 	ctr_k1_api_set_power set_power;
 	ctr_k1_api_measure measure;
+	ctr_k1_api_stream_start stream_start;
+	ctr_k1_api_stream_stop stream_stop;
 };
 
 static inline int ctr_k1_set_power(const struct device *dev, enum ctr_k1_channel channel,
@@ -76,6 +102,25 @@ static inline int ctr_k1_measure(const struct device *dev, const enum ctr_k1_cha
 	return api->measure(dev, channels, channels_count, results);
 }
 
+/* Sample the channels continuously, synchronized to the given mains frequency (50 or 60 Hz), and
+ * report per-cycle metrics until ctr_k1_stream_stop() - ctr_k1_measure() is not available in the
+ * meantime */
+static inline int ctr_k1_stream_start(const struct device *dev,
+				      const enum ctr_k1_channel channels[], size_t channels_count,
+				      int mains_freq, ctr_k1_stream_cb_t cb, void *user_data)
+{
+	const struct ctr_k1_driver_api *api = (const struct ctr_k1_driver_api *)dev->api;
+
+	return api->stream_start(dev, channels, channels_count, mains_freq, cb, user_data);
+}
+
+static inline int ctr_k1_stream_stop(const struct device *dev)
+{
+	const struct ctr_k1_driver_api *api = (const struct ctr_k1_driver_api *)dev->api;
+
+	return api->stream_stop(dev);
+}
+
 /** @} */
 
 #ifdef __cplusplus
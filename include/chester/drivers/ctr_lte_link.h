@@ -6,6 +6,7 @@
 #include <zephyr/kernel.h>
 
 /* Standard includes */
+#include <errno.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -22,6 +23,19 @@ enum ctr_lte_link_event {
 	CTR_LTE_LINK_EVENT_RX_LOSS = 4,
 };
 
+struct ctr_lte_link_stats {
+	/* Bytes received from the modem UART */
+	uint32_t rx_bytes;
+	/* Lines stacked for the reader */
+	uint32_t rx_lines;
+	/* Pipe overruns, line buffer overflows and lines lost for lack of memory */
+	uint32_t rx_drops;
+	/* High-water mark of line pool slots in use */
+	uint32_t rx_pool_max;
+	/* High-water mark of heap bytes used by lines not fitting a pool slot */
+	uint32_t rx_heap_max;
+};
+
 typedef void (*ctr_lte_link_user_cb)(const struct device *dev, enum ctr_lte_link_event event,
 				      void *user_data);
 
@@ -46,6 +60,8 @@ typedef int (*ctr_lte_link_api_send_data)(const struct device *dev, k_timeout_t
 					   const void *buf, size_t len);
 typedef int (*ctr_lte_link_api_recv_data)(const struct device *dev, k_timeout_t timeout, void *buf,
 					   size_t size, size_t *len);
+typedef int (*ctr_lte_link_api_get_stats)(const struct device *dev,
+					   struct ctr_lte_link_stats *stats);
 
 struct ctr_lte_link_driver_api {
 	ctr_lte_link_api_set_callback set_callback;
@@ -64,6 +80,7 @@ struct ctr_lte_link_driver_api {
 	ctr_lte_link_api_free_line free_line;
 	ctr_lte_link_api_send_data send_data;
 	ctr_lte_link_api_recv_data recv_data;
+	ctr_lte_link_api_get_stats get_stats;
 };
 
 static inline int ctr_lte_link_set_callback(const struct device *dev,
@@ -206,6 +223,19 @@ static inline int ctr_lte_link_recv_data(const struct device *dev, k_timeout_t t
 	return api->recv_data(dev, timeout, buf, size, len);
 }
 
+static inline int ctr_lte_link_get_stats(const struct device *dev,
+					  struct ctr_lte_link_stats *stats)
+{
+	const struct ctr_lte_link_driver_api *api =
+		(const struct ctr_lte_link_driver_api *)dev->api;
+
+	if (!api->get_stats) {
+		return -ENOSYS;
+	}
+
+	return api->get_stats(dev, stats);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -143,6 +143,30 @@ struct ctr_s1_status {
 	bool button_pressed;
 };
 
+/** @brief Quantities of a batch measurement (bits of the measure register) */
+enum ctr_s1_quantity {
+	CTR_S1_QUANTITY_CO2_CONC = 0x0001,
+	CTR_S1_QUANTITY_TEMPERATURE = 0x0002,
+	CTR_S1_QUANTITY_HUMIDITY = 0x0004,
+	CTR_S1_QUANTITY_ILLUMINANCE = 0x0008,
+	CTR_S1_QUANTITY_PRESSURE = 0x0010,
+	CTR_S1_QUANTITY_ALTITUDE = 0x0020,
+};
+
+#define CTR_S1_QUANTITY_ALL                                                                        \
+	(CTR_S1_QUANTITY_CO2_CONC | CTR_S1_QUANTITY_TEMPERATURE | CTR_S1_QUANTITY_HUMIDITY |       \
+	 CTR_S1_QUANTITY_ILLUMINANCE | CTR_S1_QUANTITY_PRESSURE | CTR_S1_QUANTITY_ALTITUDE)
+
+/** @brief Result of a batch measurement, quantities not measured (or failed) are NAN */
+struct ctr_s1_measurement {
+	float co2_conc;
+	float temperature;
+	float humidity;
+	float illuminance;
+	float pressure;
+	float altitude;
+};
+
 /** @private */
 typedef void (*ctr_s1_user_cb)(const struct device *dev, enum ctr_s1_event event, void *user_data);
 /** @private */
@@ -193,6 +217,9 @@ typedef int (*ctr_s1_api_read_pressure)(const struct device *dev, float *pressur
 /** @private */
 typedef int (*ctr_s1_api_read_co2_conc)(const struct device *dev, float *co2_conc);
 /** @private */
+typedef int (*ctr_s1_api_measure)(const struct device *dev, unsigned int quantities,
+				  struct ctr_s1_measurement *measurement);
+/** @private */
 typedef int (*ctr_s1_api_calib_tgt_co2_conc)(const struct device *dev, float tgt_co2_conc);
 
 /** @private */
@@ -218,6 +245,7 @@ struct ctr_s1_driver_api {
 	ctr_s1_api_read_altitude read_altitude;
 	ctr_s1_api_read_pressure read_pressure;
 	ctr_s1_api_read_co2_conc read_co2_conc;
+	ctr_s1_api_measure measure;
 	ctr_s1_api_calib_tgt_co2_conc calib_tgt_co2_conc;
 };
 
@@ -373,6 +401,24 @@ static inline int ctr_s1_read_co2_conc(const struct device *dev, float *co2_conc
 	return api->read_co2_conc(dev, co2_conc);
 }
 
+/**
+ * @brief Measure several quantities in a single transaction
+ *
+ * Starts all requested conversions at once (quantities is a mask of enum ctr_s1_quantity), waits
+ * for all of their converted interrupts and reads the results in one burst.
+ *
+ * @retval -EINVAL No quantity requested, or a quantity reported a measurement error (the others
+ *                 are still filled in)
+ * @retval -EAGAIN A conversion timed out (the quantities converted before are still filled in)
+ */
+static inline int ctr_s1_measure(const struct device *dev, unsigned int quantities,
+				 struct ctr_s1_measurement *measurement)
+{
+	const struct ctr_s1_driver_api *api = (const struct ctr_s1_driver_api *)dev->api;
+
+	return api->measure(dev, quantities, measurement);
+}
+
 static inline int ctr_s1_calib_tgt_co2_conc(const struct device *dev, float tgt_co2_conc)
 {
 	const struct ctr_s1_driver_api *api = (const struct ctr_s1_driver_api *)dev->api;
@@ -12,6 +12,7 @@
 
 /* Standard includes */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -32,10 +33,13 @@ typedef int (*ctr_x3_api_set_power)(const struct device *dev, enum ctr_x3_channe
 				    bool enabled);
 typedef int (*ctr_x3_api_measure)(const struct device *dev, enum ctr_x3_channel channel,
 				  int32_t *result);
+typedef int (*ctr_x3_api_measure_burst)(const struct device *dev, enum ctr_x3_channel channel,
+					int32_t *samples, size_t count);
 
 struct ctr_x3_driver_api {
 	ctr_x3_api_set_power set_power;
 	ctr_x3_api_measure measure;
+	ctr_x3_api_measure_burst measure_burst;
 };
 
 static inline int ctr_x3_set_power(const struct device *dev, enum ctr_x3_channel channel,
@@ -54,6 +58,16 @@ static inline int ctr_x3_measure(const struct device *dev, enum ctr_x3_channel c
 	return api->measure(dev, channel, result);
 }
 
+/* Back-to-back samples with the converter kept running between them - much faster than calling
+ * ctr_x3_measure() count times */
+static inline int ctr_x3_measure_burst(const struct device *dev, enum ctr_x3_channel channel,
+				       int32_t *samples, size_t count)
+{
+	const struct ctr_x3_driver_api *api = (const struct ctr_x3_driver_api *)dev->api;
+
+	return api->measure_burst(dev, channel, samples, count);
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -29,12 +29,18 @@ typedef int (*m8_api_set_bckp_power)(const struct device *dev, bool on);
 /** @private */
 typedef int (*m8_api_read_buffer)(const struct device *dev, void *buf, size_t buf_size,
 				  size_t *bytes_read);
+/** @private */
+typedef int (*m8_api_write_buffer)(const struct device *dev, const void *buf, size_t len);
+/** @private */
+typedef int (*m8_api_get_tx_ready)(const struct device *dev, bool *ready);
 
 /** @private */
 struct m8_driver_api {
 	m8_api_set_main_power set_main_power;
 	m8_api_set_bckp_power set_bckp_power;
 	m8_api_read_buffer read_buffer;
+	m8_api_write_buffer write_buffer;
+	m8_api_get_tx_ready get_tx_ready;
 };
 
 static inline int m8_set_main_power(const struct device *dev, bool on)
@@ -59,6 +65,21 @@ static inline int m8_read_buffer(const struct device *dev, void *buf, size_t buf
 	return api->read_buffer(dev, buf, buf_size, bytes_read);
 }
 
+static inline int m8_write_buffer(const struct device *dev, const void *buf, size_t len)
+{
+	const struct m8_driver_api *api = (const struct m8_driver_api *)dev->api;
+
+	return api->write_buffer(dev, buf, len);
+}
+
+/** @brief Get the TX-ready pin state, -ENOTSUP when the pin is not wired */
+static inline int m8_get_tx_ready(const struct device *dev, bool *ready)
+{
+	const struct m8_driver_api *api = (const struct m8_driver_api *)dev->api;
+
+	return api->get_tx_ready(dev, ready);
+}
+
 /** @} */
 
 #ifdef __cplusplus
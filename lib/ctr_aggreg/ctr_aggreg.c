@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include <chester/ctr_aggreg.h>
+
+/* Standard includes */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MARKERS 5
+
+/* Desired position increments for the 0.5 quantile */
+static const float m_dn[MARKERS] = {0.0f, 0.25f, 0.5f, 0.75f, 1.0f};
+
+void ctr_aggreg_reset(struct ctr_aggreg *aggreg)
+{
+	memset(aggreg, 0, sizeof(*aggreg));
+}
+
+static float parabolic(const struct ctr_aggreg *aggreg, int i, int d)
+{
+	const float *q = aggreg->q;
+	const int32_t *n = aggreg->n;
+
+	return q[i] + (float)d / (n[i + 1] - n[i - 1]) *
+			      ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+			       (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+static float linear(const struct ctr_aggreg *aggreg, int i, int d)
+{
+	const float *q = aggreg->q;
+	const int32_t *n = aggreg->n;
+
+	return q[i] + d * (q[i + d] - q[i]) / (n[i + d] - n[i]);
+}
+
+void ctr_aggreg_add(struct ctr_aggreg *aggreg, float value)
+{
+	if (aggreg->invalid) {
+		return;
+	}
+
+	if (isnan(value)) {
+		aggreg->invalid = true;
+		return;
+	}
+
+	aggreg->sum += (double)value;
+
+	/* The first samples are kept sorted and become the initial markers */
+	if (aggreg->count < MARKERS) {
+		int i = aggreg->count++;
+
+		for (; i > 0 && aggreg->q[i - 1] > value; i--) {
+			aggreg->q[i] = aggreg->q[i - 1];
+		}
+
+		aggreg->q[i] = value;
+
+		if (aggreg->count == MARKERS) {
+			for (i = 0; i < MARKERS; i++) {
+				aggreg->n[i] = i;
+				aggreg->np[i] = 4 * m_dn[i];
+			}
+		}
+
+		return;
+	}
+
+	aggreg->count++;
+
+	float *q = aggreg->q;
+	int32_t *n = aggreg->n;
+
+	int k;
+
+	if (value < q[0]) {
+		q[0] = value;
+		k = 0;
+	} else if (value >= q[4]) {
+		q[4] = value;
+		k = 3;
+	} else {
+		for (k = 0; value >= q[k + 1]; k++) {
+		}
+	}
+
+	for (int i = k + 1; i < MARKERS; i++) {
+		n[i]++;
+	}
+
+	for (int i = 0; i < MARKERS; i++) {
+		aggreg->np[i] += m_dn[i];
+	}
+
+	for (int i = 1; i < MARKERS - 1; i++) {
+		float d = aggreg->np[i] - n[i];
+
+		if ((d >= 1 && n[i + 1] - n[i] > 1) || (d <= -1 && n[i - 1] - n[i] < -1)) {
+			int s = d >= 0 ? 1 : -1;
+
+			float qp = parabolic(aggreg, i, s);
+			if (q[i - 1] < qp && qp < q[i + 1]) {
+				q[i] = qp;
+			} else {
+				q[i] = linear(aggreg, i, s);
+			}
+
+			n[i] += s;
+		}
+	}
+}
+
+void ctr_aggreg_get(const struct ctr_aggreg *aggreg, float *min, float *max, float *avg,
+		    float *mdn)
+{
+	*min = NAN;
+	*max = NAN;
+	*avg = NAN;
+	*mdn = NAN;
+
+	if (!aggreg->count || aggreg->invalid) {
+		return;
+	}
+
+	if (aggreg->count < MARKERS) {
+		*min = aggreg->q[0];
+		*max = aggreg->q[aggreg->count - 1];
+		*mdn = aggreg->q[aggreg->count / 2];
+	} else {
+		*min = aggreg->q[0];
+		*max = aggreg->q[4];
+		*mdn = aggreg->q[2];
+	}
+
+	*avg = aggreg->sum / aggreg->count;
+}
+
+/* Hoare partitioning quickselect - returns the k-th smallest sample */
+static float select_kth(float *samples, size_t count, size_t k)
+{
+	ptrdiff_t lo = 0;
+	ptrdiff_t hi = count - 1;
+
+	while (lo < hi) {
+		float pivot = samples[lo + (hi - lo) / 2];
+
+		ptrdiff_t i = lo;
+		ptrdiff_t j = hi;
+
+		while (i <= j) {
+			while (samples[i] < pivot) {
+				i++;
+			}
+
+			while (samples[j] > pivot) {
+				j--;
+			}
+
+			if (i <= j) {
+				float tmp = samples[i];
+				samples[i++] = samples[j];
+				samples[j--] = tmp;
+			}
+		}
+
+		if ((ptrdiff_t)k <= j) {
+			hi = j;
+		} else if ((ptrdiff_t)k >= i) {
+			lo = i;
+		} else {
+			break;
+		}
+	}
+
+	return samples[k];
+}
+
+void ctr_aggreg_array(float *samples, size_t count, float *min, float *max, float *avg,
+		      float *mdn)
+{
+	*min = NAN;
+	*max = NAN;
+	*avg = NAN;
+	*mdn = NAN;
+
+	if (!count) {
+		return;
+	}
+
+	float min_ = samples[0];
+	float max_ = samples[0];
+	double avg_ = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		if (isnan(samples[i])) {
+			return;
+		}
+
+		min_ = samples[i] < min_ ? samples[i] : min_;
+		max_ = samples[i] > max_ ? samples[i] : max_;
+		avg_ += (double)samples[i];
+	}
+
+	*min = min_;
+	*max = max_;
+	*avg = avg_ / count;
+
+	/* Upper median as taken from the sorted array by the former qsort based aggregation */
+	*mdn = select_kth(samples, count, count / 2);
+}
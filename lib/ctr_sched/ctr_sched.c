@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include <chester/ctr_sched.h>
+
+/* Zephyr includes */
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Latest time the earliest task may wait for - the batch runs then */
+static int64_t get_next_wakeup(struct ctr_sched *sched)
+{
+	int64_t next = INT64_MAX;
+
+	struct ctr_sched_task *task;
+	SYS_SLIST_FOR_EACH_CONTAINER(&sched->tasks, task, node) {
+		if (task->is_active) {
+			next = MIN(next, task->due + (task->is_urgent ? 0 : task->tolerance));
+		}
+	}
+
+	return next;
+}
+
+static void reschedule(struct ctr_sched *sched, int64_t next)
+{
+	if (!sched->work_q) {
+		return;
+	}
+
+	if (next == INT64_MAX) {
+		k_work_cancel_delayable(&sched->work);
+		return;
+	}
+
+	int64_t delay = MAX(next - sched->clock(), 0);
+
+	k_work_reschedule_for_queue(sched->work_q, &sched->work, K_MSEC(delay));
+}
+
+static void work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ctr_sched *sched = CONTAINER_OF(dwork, struct ctr_sched, work);
+
+	ctr_sched_process(sched);
+}
+
+/* Takes the next pending task (of the group unless is_any) and prepares it to run */
+static struct ctr_sched_task *take_task(struct ctr_sched *sched, bool is_any, int group,
+					int64_t now)
+{
+	struct ctr_sched_task *task;
+	SYS_SLIST_FOR_EACH_CONTAINER(&sched->tasks, task, node) {
+		if (task->is_pending && (is_any || task->group == group)) {
+			break;
+		}
+	}
+
+	if (!task) {
+		return NULL;
+	}
+
+	task->is_pending = false;
+	task->is_urgent = false;
+	task->deadline = task->due;
+
+	/* Advanced before the callback so that it may restart its own task */
+	if (task->period > 0) {
+		do {
+			task->due += task->period;
+		} while (task->due <= now);
+	} else {
+		task->is_active = false;
+	}
+
+	task->runs++;
+
+	return task;
+}
+
+void ctr_sched_init(struct ctr_sched *sched, struct k_work_q *work_q, ctr_sched_clock_t clock,
+		    ctr_sched_group_cb_t group_cb)
+{
+	k_mutex_init(&sched->lock);
+	sys_slist_init(&sched->tasks);
+
+	sched->work_q = work_q;
+	sched->clock = clock ? clock : k_uptime_get;
+	sched->group_cb = group_cb;
+	sched->wakeups = 0;
+
+	k_work_init_delayable(&sched->work, work_handler);
+}
+
+void ctr_sched_add(struct ctr_sched *sched, struct ctr_sched_task *task)
+{
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	task->is_active = false;
+	task->is_pending = false;
+	task->is_urgent = false;
+	task->runs = 0;
+
+	sys_slist_append(&sched->tasks, &task->node);
+
+	k_mutex_unlock(&sched->lock);
+}
+
+void ctr_sched_set_period(struct ctr_sched *sched, struct ctr_sched_task *task, int64_t period,
+			  int64_t tolerance)
+{
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	task->period = period;
+	task->tolerance = tolerance;
+
+	if (task->is_active) {
+		reschedule(sched, get_next_wakeup(sched));
+	}
+
+	k_mutex_unlock(&sched->lock);
+}
+
+void ctr_sched_start(struct ctr_sched *sched, struct ctr_sched_task *task, int64_t delay)
+{
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	task->due = sched->clock() + MAX(delay, 0);
+	task->is_active = true;
+	task->is_pending = false;
+	task->is_urgent = delay <= 0;
+
+	reschedule(sched, get_next_wakeup(sched));
+
+	k_mutex_unlock(&sched->lock);
+}
+
+void ctr_sched_stop(struct ctr_sched *sched, struct ctr_sched_task *task)
+{
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	task->is_active = false;
+	task->is_pending = false;
+
+	reschedule(sched, get_next_wakeup(sched));
+
+	k_mutex_unlock(&sched->lock);
+}
+
+int64_t ctr_sched_process(struct ctr_sched *sched)
+{
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	int64_t now = sched->clock();
+	bool is_batch = false;
+
+	struct ctr_sched_task *task;
+	SYS_SLIST_FOR_EACH_CONTAINER(&sched->tasks, task, node) {
+		task->is_pending = task->is_active && task->due <= now;
+		is_batch |= task->is_pending;
+	}
+
+	if (is_batch) {
+		sched->wakeups++;
+	}
+
+	k_mutex_unlock(&sched->lock);
+
+	/* Group by group in the order of the first pending task of each. The callbacks run without
+	 * the lock held, so they may block on anything that starts or stops tasks itself */
+	bool is_group = false;
+	bool is_shared = false;
+	int group = CTR_SCHED_GROUP_NONE;
+
+	for (;;) {
+		k_mutex_lock(&sched->lock, K_FOREVER);
+
+		task = is_group ? take_task(sched, false, group, now) : NULL;
+
+		if (!task) {
+			task = take_task(sched, true, 0, now);
+		}
+
+		k_mutex_unlock(&sched->lock);
+
+		if (is_group && (!task || task->group != group)) {
+			if (is_shared) {
+				sched->group_cb(sched, group, false);
+			}
+
+			is_group = false;
+		}
+
+		if (!task) {
+			break;
+		}
+
+		if (!is_group) {
+			is_group = true;
+			group = task->group;
+			is_shared = group != CTR_SCHED_GROUP_NONE && sched->group_cb;
+
+			if (is_shared) {
+				sched->group_cb(sched, group, true);
+			}
+		}
+
+		task->cb(task);
+	}
+
+	k_mutex_lock(&sched->lock, K_FOREVER);
+
+	int64_t next = get_next_wakeup(sched);
+
+	reschedule(sched, next);
+
+	k_mutex_unlock(&sched->lock);
+
+	return next;
+}
@@ -129,6 +129,7 @@ int main(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, cmd_config_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	bool state = false;
 
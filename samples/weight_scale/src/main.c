@@ -100,16 +100,14 @@ static int read_weight(const char *id, enum measure_weight_slot slot, enum ctr_x
 	int64_t average = 0;
 	int64_t filtered = 0;
 
-	for (size_t i = 0; i < ARRAY_SIZE(samples); i++) {
-		int32_t sample;
-		ret = ctr_x3_measure(dev, channel, &sample);
-		if (ret) {
-			LOG_ERR("Call `ctr_x3_measure` failed: %d", ret);
-			goto error;
-		}
+	ret = ctr_x3_measure_burst(dev, channel, samples, ARRAY_SIZE(samples));
+	if (ret) {
+		LOG_ERR("Call `ctr_x3_measure_burst` failed: %d", ret);
+		goto error;
+	}
 
-		samples[i] = sample;
-		average += sample;
+	for (size_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		average += samples[i];
 	}
 
 	ret = ctr_x3_set_power(dev, channel, false);
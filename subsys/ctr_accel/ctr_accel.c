@@ -80,6 +80,13 @@ int ctr_accel_read(float *accel_x, float *accel_y, float *accel_z, int *orientat
 {
 	int ret;
 
+#if defined(CONFIG_CTR_ACCEL_STREAM)
+	/* Reading the output registers would pop samples from the FIFO */
+	if (ctr_accel_stream_is_active()) {
+		return -EBUSY;
+	}
+#endif /* defined(CONFIG_CTR_ACCEL_STREAM) */
+
 	k_mutex_lock(&m_mut, K_FOREVER);
 
 	if (!device_is_ready(m_dev)) {
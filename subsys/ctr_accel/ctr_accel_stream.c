@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_accel_vib.h"
+
+/* CHESTER includes */
+#include <chester/ctr_accel.h>
+
+/* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_DECLARE(ctr_accel, CONFIG_CTR_ACCEL_LOG_LEVEL);
+
+#define GRAVITY 9.80665f
+
+#define REG_CTRL_REG1     0x20
+#define REG_CTRL_REG3     0x22
+#define REG_CTRL_REG4     0x23
+#define REG_CTRL_REG5     0x24
+#define REG_OUT_X_L       0x28
+#define REG_FIFO_CTRL_REG 0x2e
+#define REG_FIFO_SRC_REG  0x2f
+
+#define REG_AUTO_INCREMENT 0x80
+
+#define CTRL_REG1_ODR_POS     4
+#define CTRL_REG1_ODR_MSK     0xf0
+#define CTRL_REG3_I1_WTM      BIT(2)
+#define CTRL_REG3_I1_ZYXDA    BIT(4)
+#define CTRL_REG4_FS_POS      4
+#define CTRL_REG4_FS_MSK      0x30
+#define CTRL_REG5_FIFO_EN     BIT(6)
+#define FIFO_CTRL_MODE_BYPASS 0x00
+#define FIFO_CTRL_MODE_STREAM 0x80
+#define FIFO_SRC_OVRN         BIT(6)
+#define FIFO_SRC_FSS_MSK      0x1f
+
+#define FIFO_SIZE 32
+
+/* Interrupt when more than half of the FIFO is filled - leaves the other half as the latency budget
+ * of the driver trigger context */
+#define FIFO_WATERMARK 16
+
+/* The driver enables the data ready interrupt from its trigger context after the trigger is set */
+#define TRIGGER_START_POLL_MS    2
+#define TRIGGER_START_TIMEOUT_MS 100
+
+struct odr {
+	int sample_rate;
+	uint8_t code;
+};
+
+static const struct odr m_odr[] = {
+	{10, 2}, {25, 3}, {50, 4}, {100, 5}, {200, 6}, {400, 7},
+};
+
+static const struct device *m_dev = DEVICE_DT_GET(DT_NODELABEL(lis2dh12));
+static const struct i2c_dt_spec m_i2c = I2C_DT_SPEC_GET(DT_NODELABEL(lis2dh12));
+
+static struct sensor_trigger m_trigger = {
+	.type = SENSOR_TRIG_DATA_READY,
+	.chan = SENSOR_CHAN_ACCEL_XYZ,
+};
+
+static K_MUTEX_DEFINE(m_lock);
+static bool m_is_active;
+static float m_scale;
+static ctr_accel_stream_cb_t m_cb;
+static void *m_user_data;
+static uint8_t m_saved_ctrl_reg1;
+static uint8_t m_saved_ctrl_reg3;
+static uint8_t m_saved_ctrl_reg5;
+static struct ctr_accel_vib_ctx m_ctx;
+static struct ctr_accel_vib m_vib;
+
+static int read_reg(uint8_t reg, uint8_t *val)
+{
+	int ret;
+
+	ret = i2c_reg_read_byte_dt(&m_i2c, reg, val);
+	if (ret) {
+		LOG_ERR("Call `i2c_reg_read_byte_dt` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int write_reg(uint8_t reg, uint8_t val)
+{
+	int ret;
+
+	ret = i2c_reg_write_byte_dt(&m_i2c, reg, val);
+	if (ret) {
+		LOG_ERR("Call `i2c_reg_write_byte_dt` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int wait_trigger_start(void)
+{
+	int ret;
+
+	for (int i = 0; i < TRIGGER_START_TIMEOUT_MS / TRIGGER_START_POLL_MS; i++) {
+		uint8_t ctrl_reg3;
+		ret = read_reg(REG_CTRL_REG3, &ctrl_reg3);
+		if (ret) {
+			return ret;
+		}
+
+		if (ctrl_reg3 & CTRL_REG3_I1_ZYXDA) {
+			return 0;
+		}
+
+		k_sleep(K_MSEC(TRIGGER_START_POLL_MS));
+	}
+
+	return -ETIMEDOUT;
+}
+
+/* Routes only the FIFO watermark to INT1 - must be done once the driver has finished starting the
+ * trigger, which sets the data ready source in the same register */
+static int set_int1_watermark(void)
+{
+	int ret;
+
+	ret = write_reg(REG_CTRL_REG3, CTRL_REG3_I1_WTM);
+	if (ret) {
+		return ret;
+	}
+
+	uint8_t ctrl_reg3;
+	ret = read_reg(REG_CTRL_REG3, &ctrl_reg3);
+	if (ret) {
+		return ret;
+	}
+
+	if (ctrl_reg3 != CTRL_REG3_I1_WTM) {
+		LOG_ERR("Unexpected CTRL_REG3: 0x%02x", ctrl_reg3);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int drain_fifo(void)
+{
+	int ret;
+
+	uint8_t src;
+	ret = read_reg(REG_FIFO_SRC_REG, &src);
+	if (ret) {
+		return ret;
+	}
+
+	if (src & FIFO_SRC_OVRN) {
+		LOG_WRN("FIFO overrun");
+	}
+
+	/* FSS saturates at 31 on a full FIFO, the overrun flag adds the last one */
+	int count = (src & FIFO_SRC_FSS_MSK) + ((src & FIFO_SRC_OVRN) ? 1 : 0);
+	if (!count) {
+		return 0;
+	}
+
+	/* Register address wraps from OUT_Z_H back to OUT_X_L in FIFO mode, so the whole FIFO is
+	 * read in a single transfer */
+	static uint8_t buf[FIFO_SIZE * 6];
+	ret = i2c_burst_read_dt(&m_i2c, REG_OUT_X_L | REG_AUTO_INCREMENT, buf, count * 6);
+	if (ret) {
+		LOG_ERR("Call `i2c_burst_read_dt` failed: %d", ret);
+		return ret;
+	}
+
+	for (int i = 0; i < count; i++) {
+		float xyz[3];
+
+		for (int j = 0; j < 3; j++) {
+			xyz[j] = (int16_t)sys_get_le16(&buf[i * 6 + j * 2]) * m_scale;
+		}
+
+		if (ctr_accel_vib_feed(&m_ctx, xyz, &m_vib) && m_cb) {
+			m_cb(&m_vib, m_user_data);
+		}
+	}
+
+	return 0;
+}
+
+/* The driver calls this on every INT1 assertion and re-arms the level interrupt afterwards */
+static void trigger_handler(const struct device *dev, const struct sensor_trigger *trig)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	if (m_is_active) {
+		ret = drain_fifo();
+		if (ret) {
+			LOG_ERR("Call `drain_fifo` failed: %d", ret);
+		}
+	}
+
+	k_mutex_unlock(&m_lock);
+}
+
+static int restore(void)
+{
+	int ret;
+	int err = 0;
+
+	ret = sensor_trigger_set(m_dev, &m_trigger, NULL);
+	if (ret) {
+		LOG_ERR("Call `sensor_trigger_set` failed: %d", ret);
+		err = ret;
+	}
+
+	ret = write_reg(REG_FIFO_CTRL_REG, FIFO_CTRL_MODE_BYPASS);
+	err = err ? err : ret;
+
+	ret = write_reg(REG_CTRL_REG5, m_saved_ctrl_reg5);
+	err = err ? err : ret;
+
+	ret = write_reg(REG_CTRL_REG3, m_saved_ctrl_reg3);
+	err = err ? err : ret;
+
+	ret = write_reg(REG_CTRL_REG1, m_saved_ctrl_reg1);
+	err = err ? err : ret;
+
+	return err;
+}
+
+int ctr_accel_stream_start(int sample_rate, int window, ctr_accel_stream_cb_t cb,
+			   void *user_data)
+{
+	int ret;
+
+	const struct odr *odr = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_odr); i++) {
+		if (m_odr[i].sample_rate == sample_rate) {
+			odr = &m_odr[i];
+			break;
+		}
+	}
+
+	if (!odr) {
+		LOG_ERR("Unsupported sample rate: %d", sample_rate);
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(m_dev)) {
+		LOG_ERR("Device `LIS2DH12` not ready");
+		return -ENODEV;
+	}
+
+#if defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD)
+	/* The trigger start would never run while this thread waits for it */
+	if (k_current_get() == &k_sys_work_q.thread) {
+		LOG_ERR("Called from the system work queue");
+		return -EDEADLK;
+	}
+#endif /* defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD) */
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	if (m_is_active) {
+		k_mutex_unlock(&m_lock);
+		return -EBUSY;
+	}
+
+	ret = ctr_accel_vib_init(&m_ctx, sample_rate, window);
+	if (ret) {
+		LOG_ERR("Call `ctr_accel_vib_init` failed: %d", ret);
+		k_mutex_unlock(&m_lock);
+		return ret;
+	}
+
+	uint8_t ctrl_reg4;
+	if (read_reg(REG_CTRL_REG1, &m_saved_ctrl_reg1) ||
+	    read_reg(REG_CTRL_REG3, &m_saved_ctrl_reg3) || read_reg(REG_CTRL_REG4, &ctrl_reg4) ||
+	    read_reg(REG_CTRL_REG5, &m_saved_ctrl_reg5)) {
+		k_mutex_unlock(&m_lock);
+		return -EIO;
+	}
+
+	/* Samples are left-justified in 16 bits regardless of the resolution */
+	int full_scale = 2 << ((ctrl_reg4 & CTRL_REG4_FS_MSK) >> CTRL_REG4_FS_POS);
+	m_scale = full_scale * GRAVITY / 32768.f;
+
+	m_cb = cb;
+	m_user_data = user_data;
+
+	/* The driver owns the INT1 line - the data ready trigger keeps its interrupt armed, the
+	 * source is then switched from data ready to the FIFO watermark */
+	ret = sensor_trigger_set(m_dev, &m_trigger, trigger_handler);
+	if (ret) {
+		LOG_ERR("Call `sensor_trigger_set` failed: %d", ret);
+		k_mutex_unlock(&m_lock);
+		return ret;
+	}
+
+	ret = wait_trigger_start();
+	if (ret) {
+		LOG_ERR("Call `wait_trigger_start` failed: %d", ret);
+		restore();
+		k_mutex_unlock(&m_lock);
+		return ret;
+	}
+
+	uint8_t ctrl_reg1 = m_saved_ctrl_reg1 & ~CTRL_REG1_ODR_MSK;
+	ctrl_reg1 |= odr->code << CTRL_REG1_ODR_POS;
+
+	if (write_reg(REG_CTRL_REG3, 0) || write_reg(REG_FIFO_CTRL_REG, FIFO_CTRL_MODE_BYPASS) ||
+	    write_reg(REG_CTRL_REG1, ctrl_reg1) ||
+	    write_reg(REG_CTRL_REG5, m_saved_ctrl_reg5 | CTRL_REG5_FIFO_EN) ||
+	    write_reg(REG_FIFO_CTRL_REG, FIFO_CTRL_MODE_STREAM | FIFO_WATERMARK) ||
+	    set_int1_watermark()) {
+		restore();
+		k_mutex_unlock(&m_lock);
+		return -EIO;
+	}
+
+	m_is_active = true;
+
+	k_mutex_unlock(&m_lock);
+
+	LOG_INF("Streaming at %d Hz, window %d samples", sample_rate, window);
+
+	return 0;
+}
+
+int ctr_accel_stream_stop(void)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	if (!m_is_active) {
+		k_mutex_unlock(&m_lock);
+		return 0;
+	}
+
+	m_is_active = false;
+
+	ret = restore();
+	if (ret) {
+		LOG_ERR("Call `restore` failed: %d", ret);
+		k_mutex_unlock(&m_lock);
+		return ret;
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	return 0;
+}
+
+bool ctr_accel_stream_is_active(void)
+{
+	k_mutex_lock(&m_lock, K_FOREVER);
+	bool is_active = m_is_active;
+	k_mutex_unlock(&m_lock);
+
+	return is_active;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_accel_vib.h"
+
+/* CHESTER includes */
+#include <chester/ctr_accel.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define WINDOW_MIN 16
+
+/* In-place iterative radix-2 FFT */
+static void fft(float *re, float *im, int n)
+{
+	for (int i = 1, j = 0; i < n; i++) {
+		int bit = n >> 1;
+
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+
+		j ^= bit;
+
+		if (i < j) {
+			float t = re[i];
+			re[i] = re[j];
+			re[j] = t;
+			t = im[i];
+			im[i] = im[j];
+			im[j] = t;
+		}
+	}
+
+	for (int len = 2; len <= n; len <<= 1) {
+		float angle = -2.f * (float)M_PI / len;
+		float w_re = cosf(angle);
+		float w_im = sinf(angle);
+
+		for (int i = 0; i < n; i += len) {
+			float u_re = 1.f;
+			float u_im = 0.f;
+
+			for (int j = 0; j < len / 2; j++) {
+				int a = i + j;
+				int b = i + j + len / 2;
+
+				float t_re = re[b] * u_re - im[b] * u_im;
+				float t_im = re[b] * u_im + im[b] * u_re;
+
+				re[b] = re[a] - t_re;
+				im[b] = im[a] - t_im;
+				re[a] += t_re;
+				im[a] += t_im;
+
+				float next = u_re * w_re - u_im * w_im;
+				u_im = u_re * w_im + u_im * w_re;
+				u_re = next;
+			}
+		}
+	}
+}
+
+static void extract(struct ctr_accel_vib_ctx *ctx, const float *x, struct ctr_accel_vib_axis *axis)
+{
+	int n = ctx->window;
+
+	float mean = 0.f;
+	float min = x[0];
+	float max = x[0];
+
+	for (int i = 0; i < n; i++) {
+		mean += x[i];
+		min = fminf(min, x[i]);
+		max = fmaxf(max, x[i]);
+	}
+
+	mean /= n;
+
+	float m2 = 0.f;
+	float m4 = 0.f;
+
+	for (int i = 0; i < n; i++) {
+		float d = x[i] - mean;
+		float d2 = d * d;
+
+		m2 += d2;
+		m4 += d2 * d2;
+
+		ctx->re[i] = d;
+		ctx->im[i] = 0.f;
+	}
+
+	m2 /= n;
+	m4 /= n;
+
+	axis->rms = sqrtf(m2);
+	axis->p2p = max - min;
+	axis->kurtosis = m2 > 0.f ? m4 / (m2 * m2) : 0.f;
+
+	fft(ctx->re, ctx->im, n);
+
+	for (int b = 0; b < CTR_ACCEL_VIB_BAND_COUNT; b++) {
+		axis->band[b] = 0.f;
+	}
+
+	/* One-sided power spectrum scaled so that the bins sum up to the mean square (Parseval) */
+	for (int k = 1; k <= n / 2; k++) {
+		float power = (ctx->re[k] * ctx->re[k] + ctx->im[k] * ctx->im[k]) / ((float)n * n);
+
+		if (k < n / 2) {
+			power *= 2.f;
+		}
+
+		int b = (k - 1) * CTR_ACCEL_VIB_BAND_COUNT / (n / 2);
+		axis->band[b] += power;
+	}
+}
+
+int ctr_accel_vib_init(struct ctr_accel_vib_ctx *ctx, int sample_rate, int window)
+{
+	if (sample_rate <= 0) {
+		return -EINVAL;
+	}
+
+	if (window < WINDOW_MIN || window > CONFIG_CTR_ACCEL_STREAM_WINDOW_MAX ||
+	    (window & (window - 1))) {
+		return -EINVAL;
+	}
+
+	ctx->sample_rate = sample_rate;
+	ctx->window = window;
+	ctx->count = 0;
+
+	return 0;
+}
+
+bool ctr_accel_vib_feed(struct ctr_accel_vib_ctx *ctx, const float xyz[3],
+			struct ctr_accel_vib *vib)
+{
+	for (int i = 0; i < 3; i++) {
+		ctx->samples[i][ctx->count] = xyz[i];
+	}
+
+	if (++ctx->count < ctx->window) {
+		return false;
+	}
+
+	ctx->count = 0;
+
+	vib->sample_rate = ctx->sample_rate;
+	vib->window = ctx->window;
+
+	for (int i = 0; i < 3; i++) {
+		extract(ctx, ctx->samples[i], &vib->axis[i]);
+	}
+
+	return true;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_ACCEL_CTR_ACCEL_VIB_H_
+#define CHESTER_SUBSYS_CTR_ACCEL_CTR_ACCEL_VIB_H_
+
+/* CHESTER includes */
+#include <chester/ctr_accel.h>
+
+/* Standard includes */
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Collects one window of samples and extracts the vibration features when it is full */
+struct ctr_accel_vib_ctx {
+	int sample_rate;
+	int window;
+	int count;
+	float samples[3][CONFIG_CTR_ACCEL_STREAM_WINDOW_MAX];
+	float re[CONFIG_CTR_ACCEL_STREAM_WINDOW_MAX];
+	float im[CONFIG_CTR_ACCEL_STREAM_WINDOW_MAX];
+};
+
+/* Window has to be a power of two from 16 to CONFIG_CTR_ACCEL_STREAM_WINDOW_MAX */
+int ctr_accel_vib_init(struct ctr_accel_vib_ctx *ctx, int sample_rate, int window);
+
+/* Returns true and fills the features when the sample completes the window */
+bool ctr_accel_vib_feed(struct ctr_accel_vib_ctx *ctx, const float xyz[3],
+			struct ctr_accel_vib *vib);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_ACCEL_CTR_ACCEL_VIB_H_ */
@@ -445,6 +445,7 @@ static int init(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, cmd_config_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	ret = bt_enable(NULL);
 	if (ret) {
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_ble_tag_scan.h"
+
 /* CHESTER includes */
 #include <chester/ctr_ble_tag.h>
 #include <chester/ctr_buf.h>
@@ -57,6 +59,56 @@ static struct config m_config_interim = {
 
 static struct config m_config;
 
+#define CONFIG_ITEM_ADDR(_slot)                                                                    \
+	CTR_CONFIG_ITEM_HEX("addr-" #_slot, m_config_interim.addr[_slot],                          \
+			    "tag address (format: <12 hexadecimal digits>)",                       \
+			    ((const uint8_t[BT_ADDR_SIZE]){0}))
+
+/* Only for the structured export and the partial apply - the shell commands stay in use */
+static const struct ctr_config_item m_config_items[] = {
+	CTR_CONFIG_ITEM_BOOL("enabled", m_config_interim.enabled, "tag scanning", false),
+	CTR_CONFIG_ITEM_INT("scan-interval", m_config_interim.scan_interval, 1, 86400,
+			    "scan interval (seconds)", 300),
+	CTR_CONFIG_ITEM_INT("scan-duration", m_config_interim.scan_duration, 1, 86400,
+			    "scan duration (seconds)", 12),
+	CONFIG_ITEM_ADDR(0),
+	CONFIG_ITEM_ADDR(1),
+	CONFIG_ITEM_ADDR(2),
+	CONFIG_ITEM_ADDR(3),
+	CONFIG_ITEM_ADDR(4),
+	CONFIG_ITEM_ADDR(5),
+	CONFIG_ITEM_ADDR(6),
+	CONFIG_ITEM_ADDR(7),
+#if defined(CONFIG_CTR_BLE_TAG_32_SLOTS)
+	CONFIG_ITEM_ADDR(8),
+	CONFIG_ITEM_ADDR(9),
+	CONFIG_ITEM_ADDR(10),
+	CONFIG_ITEM_ADDR(11),
+	CONFIG_ITEM_ADDR(12),
+	CONFIG_ITEM_ADDR(13),
+	CONFIG_ITEM_ADDR(14),
+	CONFIG_ITEM_ADDR(15),
+	CONFIG_ITEM_ADDR(16),
+	CONFIG_ITEM_ADDR(17),
+	CONFIG_ITEM_ADDR(18),
+	CONFIG_ITEM_ADDR(19),
+	CONFIG_ITEM_ADDR(20),
+	CONFIG_ITEM_ADDR(21),
+	CONFIG_ITEM_ADDR(22),
+	CONFIG_ITEM_ADDR(23),
+	CONFIG_ITEM_ADDR(24),
+	CONFIG_ITEM_ADDR(25),
+	CONFIG_ITEM_ADDR(26),
+	CONFIG_ITEM_ADDR(27),
+	CONFIG_ITEM_ADDR(28),
+	CONFIG_ITEM_ADDR(29),
+	CONFIG_ITEM_ADDR(30),
+	CONFIG_ITEM_ADDR(31),
+#endif
+};
+
+#undef CONFIG_ITEM_ADDR
+
 struct ble_tag_data {
 	bool valid;
 	int64_t timestamp;
@@ -76,6 +128,9 @@ struct ble_tag_data {
 static struct ble_tag_data m_tag_data[CTR_BLE_TAG_COUNT];
 static K_MUTEX_DEFINE(m_tag_data_lock);
 
+/* Slot map and periodic scan cycle state, guarded by m_tag_data_lock */
+static struct ctr_ble_tag_scan m_scan;
+
 /* `tag read all` prints each device the moment it is first seen, directly from discover_cb, so
  * no per-device sensor state needs to be retained. Only the address is kept, purely to dedupe
  * repeat adverts from the same tag during the scan window and to report a final unique count. */
@@ -294,29 +349,42 @@ static int16_t parse_data(struct net_buf_simple *buf, float *temperature, float
 	return sensor_mask ? sensor_mask : -EINVAL;
 }
 
-static void update_tag_data(const bt_addr_le_t *addr, int8_t rssi, bool interim,
-			    int16_t sensor_mask, float temperature, float humidity, float voltage,
-			    bool magnet_detected, bool moving, float movement_event_count,
-			    bool low_battery, float roll, float pitch)
+static void stop_scan_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(m_stop_scan_work, stop_scan_work_handler);
+
+static void update_tag_data(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
+			    bool interim, int16_t sensor_mask, float temperature, float humidity,
+			    float voltage, bool magnet_detected, bool moving,
+			    float movement_event_count, bool low_battery, float roll, float pitch)
 {
 	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
 
-	size_t slot = 0;
+	int64_t now = k_uptime_get();
+	int slot = -ENOENT;
 
-	for (; slot < CTR_BLE_TAG_COUNT; slot++) {
-		if (!memcmp(addr->a.val,
-			    interim ? m_config_interim.addr[slot] : m_config.addr[slot],
-			    BT_ADDR_SIZE)) {
-			break;
+	if (interim) {
+		/* Enrollment in progress, the map only knows the committed addresses */
+		for (size_t i = 0; i < CTR_BLE_TAG_COUNT; i++) {
+			if (!memcmp(addr->a.val, m_config_interim.addr[i], BT_ADDR_SIZE)) {
+				slot = i;
+				break;
+			}
 		}
+	} else {
+		slot = ctr_ble_tag_scan_find(&m_scan, addr->a.val);
 	}
 
-	if (slot == CTR_BLE_TAG_COUNT) {
+	if (slot < 0) {
 		k_mutex_unlock(&m_tag_data_lock);
 		return;
 	}
 
-	m_tag_data[slot].timestamp = k_uptime_get();
+	if (!interim && ctr_ble_tag_scan_track(&m_scan, slot, adv_type == BT_GAP_ADV_TYPE_SCAN_RSP,
+						now, m_config.scan_duration * 1000LL)) {
+		k_work_reschedule_for_queue(&m_scan_work_q, &m_stop_scan_work, K_NO_WAIT);
+	}
+
+	m_tag_data[slot].timestamp = now;
 	m_tag_data[slot].sensor_mask = sensor_mask;
 	m_tag_data[slot].rssi = rssi;
 	m_tag_data[slot].temperature = temperature;
@@ -356,7 +424,7 @@ static void scan_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
 		return;
 	}
 
-	update_tag_data(addr, rssi, false, sensor_mask, temperature, humidity, voltage,
+	update_tag_data(addr, rssi, adv_type, false, sensor_mask, temperature, humidity, voltage,
 			magnet_detected, moving, movement_event_count, low_battery, roll, pitch);
 }
 
@@ -417,7 +485,7 @@ static void enroll_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
 		break;
 	}
 
-	update_tag_data(addr, rssi, true, sensor_mask, temperature, humidity, voltage,
+	update_tag_data(addr, rssi, adv_type, true, sensor_mask, temperature, humidity, voltage,
 			magnet_detected, moving, movement_event_count, low_battery, roll, pitch);
 }
 
@@ -506,23 +574,46 @@ static void discover_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
 static void start_scan_work_handler(struct k_work *work);
 static K_WORK_DELAYABLE_DEFINE(m_start_scan_work, start_scan_work_handler);
 
-static void stop_scan_work_handler(struct k_work *work);
-static K_WORK_DELAYABLE_DEFINE(m_stop_scan_work, stop_scan_work_handler);
-
 static void start_scan_work_handler(struct k_work *work)
 {
 	int ret;
 
-	LOG_DBG("Starting scan...");
+	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+	uint32_t enrolled_mask = m_scan.enrolled_mask;
+	bool passive;
+	int64_t window =
+		ctr_ble_tag_scan_get_window(&m_scan, m_config.scan_duration * 1000LL, &passive);
+	k_mutex_unlock(&m_tag_data_lock);
+
+	if (!enrolled_mask) {
+		LOG_DBG("No tags enrolled, scan skipped");
+
+		k_work_schedule_for_queue(&m_scan_work_q, &m_start_scan_work,
+					  K_SECONDS(m_config.scan_interval));
+
+		return;
+	}
+
+	LOG_DBG("Starting scan (%s, window: %lld ms)...", passive ? "passive" : "active",
+		window);
 
 	k_mutex_lock(&m_scan_lock, K_FOREVER);
 
 	struct bt_le_scan_param param = SCAN_PARAMS_DEFAULTS;
+	param.type = passive ? BT_LE_SCAN_TYPE_PASSIVE : BT_LE_SCAN_TYPE_ACTIVE;
+
+	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+	ctr_ble_tag_scan_begin(&m_scan, k_uptime_get());
+	k_mutex_unlock(&m_tag_data_lock);
 
 	ret = bt_le_scan_start(&param, scan_cb);
 	if (ret) {
 		LOG_ERR("Call `bt_le_scan_start` failed: %d", ret);
 
+		k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+		m_scan.cycle_active = false;
+		k_mutex_unlock(&m_tag_data_lock);
+
 		k_work_schedule_for_queue(&m_scan_work_q, &m_start_scan_work,
 					  K_SECONDS(m_config.scan_interval));
 
@@ -531,8 +622,7 @@ static void start_scan_work_handler(struct k_work *work)
 		return;
 	}
 
-	k_work_schedule_for_queue(&m_scan_work_q, &m_stop_scan_work,
-				  K_SECONDS(m_config.scan_duration));
+	k_work_schedule_for_queue(&m_scan_work_q, &m_stop_scan_work, K_MSEC(window));
 
 	LOG_DBG("Scan started");
 }
@@ -548,6 +638,16 @@ static void stop_scan_work_handler(struct k_work *work)
 		LOG_ERR("Call `bt_le_scan_stop` failed: %d", ret);
 	}
 
+	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+
+	bool complete = ctr_ble_tag_scan_end(&m_scan, k_uptime_get());
+
+	LOG_INF("Scan cycle: radio on: %lld ms / heard: %d of %d tags%s",
+		m_scan.stats.last_radio_on, m_scan.stats.last_heard, m_scan.stats.last_enrolled,
+		complete ? " / stopped early" : "");
+
+	k_mutex_unlock(&m_tag_data_lock);
+
 	k_work_schedule_for_queue(&m_scan_work_q, &m_start_scan_work,
 				  K_SECONDS(m_config.scan_interval));
 
@@ -562,6 +662,19 @@ int ctr_ble_tag_is_addr_empty(const uint8_t addr[BT_ADDR_SIZE])
 	return memcmp(addr, empty_addr, BT_ADDR_SIZE) == 0;
 }
 
+int ctr_ble_tag_get_scan_stats(struct ctr_ble_tag_scan_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+	*stats = m_scan.stats;
+	k_mutex_unlock(&m_tag_data_lock);
+
+	return 0;
+}
+
 int ctr_ble_tag_read_cached(size_t slot, uint8_t addr[BT_ADDR_SIZE], int8_t *rssi, float *voltage,
 			    float *temperature, float *humidity, bool *magnet_detected,
 			    bool *moving, int *movement_event_count, float *roll, float *pitch,
@@ -714,6 +827,11 @@ static int h_commit(void)
 {
 	LOG_DBG("Loaded settings in full");
 	memcpy(&m_config, &m_config_interim, sizeof(m_config));
+
+	k_mutex_lock(&m_tag_data_lock, K_FOREVER);
+	ctr_ble_tag_scan_build(&m_scan, m_config.addr);
+	k_mutex_unlock(&m_tag_data_lock);
+
 	return 0;
 }
 
@@ -1772,6 +1890,31 @@ static int print_help(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	int ret;
+
+	struct ctr_ble_tag_scan_stats stats;
+	ret = ctr_ble_tag_get_scan_stats(&stats);
+	if (ret) {
+		LOG_ERR("Call `ctr_ble_tag_get_scan_stats` failed: %d", ret);
+		shell_error(shell, "command failed");
+		return ret;
+	}
+
+	shell_print(shell, "cycles: %u (stopped early: %u)", stats.cycles, stats.early_cycles);
+	shell_print(shell, "radio on total: %lld ms", stats.total_radio_on);
+
+	if (stats.cycles) {
+		shell_print(shell, "radio on last: %lld ms / heard: %d of %d tags",
+			    stats.last_radio_on, stats.last_heard, stats.last_enrolled);
+	}
+
+	shell_print(shell, "command succeeded");
+
+	return 0;
+}
+
 static int cmd_config_show(const struct shell *shell, size_t argc, char **argv)
 {
 	print_enabled(shell);
@@ -1816,6 +1959,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(enroll, NULL, "Enroll a device nearby (12 seconds) <threshold (-128:0)>.", cmd_enroll, 1, 1),
 	SHELL_CMD_ARG(read, NULL, "Read enrolled devices (12s), or all nearby tags: read [all [timeout 1-300s]].", cmd_scan, 1, 2),
 	SHELL_CMD_ARG(show, NULL, "Show cached readings of enrolled devices.", cmd_show, 1, 0),
+	SHELL_CMD_ARG(stats, NULL, "Show radio-on time of the periodic scan.", cmd_stats, 1, 0),
 
 	SHELL_SUBCMD_SET_END
 );
@@ -1852,6 +1996,7 @@ static int init(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, cmd_config_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	ret = settings_load();
 	if (ret) {
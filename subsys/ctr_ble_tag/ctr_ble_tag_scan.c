@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_ble_tag_scan.h"
+#include "ctr_ble_tag_stats.h"
+
+/* CHESTER includes */
+#include <chester/ctr_ble_tag.h>
+
+/* Zephyr includes */
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static size_t hash_addr(const uint8_t addr[BT_ADDR_SIZE])
+{
+	/* The low bytes are the device specific part of a public address */
+	uint32_t hash = sys_get_le24(addr) * 2654435761u;
+
+	return (hash >> 16) & (CTR_BLE_TAG_SCAN_MAP_SIZE - 1);
+}
+
+static bool is_addr_empty(const uint8_t addr[BT_ADDR_SIZE])
+{
+	static const uint8_t empty_addr[BT_ADDR_SIZE] = {0};
+
+	return memcmp(addr, empty_addr, BT_ADDR_SIZE) == 0;
+}
+
+void ctr_ble_tag_scan_build(struct ctr_ble_tag_scan *scan,
+			    uint8_t addr[CTR_BLE_TAG_COUNT][BT_ADDR_SIZE])
+{
+	scan->addr = addr;
+
+	memset(scan->map, 0, sizeof(scan->map));
+	scan->enrolled_mask = 0;
+
+	for (size_t slot = 0; slot < CTR_BLE_TAG_COUNT; slot++) {
+		if (is_addr_empty(addr[slot])) {
+			continue;
+		}
+
+		size_t bucket = hash_addr(addr[slot]);
+
+		while (scan->map[bucket]) {
+			bucket = (bucket + 1) & (CTR_BLE_TAG_SCAN_MAP_SIZE - 1);
+		}
+
+		scan->map[bucket] = slot + 1;
+		scan->enrolled_mask |= BIT(slot);
+	}
+}
+
+int ctr_ble_tag_scan_find(const struct ctr_ble_tag_scan *scan, const uint8_t addr[BT_ADDR_SIZE])
+{
+	size_t bucket = hash_addr(addr);
+
+	for (size_t i = 0; i < CTR_BLE_TAG_SCAN_MAP_SIZE && scan->map[bucket]; i++) {
+		int slot = scan->map[bucket] - 1;
+
+		if (!memcmp(addr, scan->addr[slot], BT_ADDR_SIZE)) {
+			return slot;
+		}
+
+		bucket = (bucket + 1) & (CTR_BLE_TAG_SCAN_MAP_SIZE - 1);
+	}
+
+	return -ENOENT;
+}
+
+int64_t ctr_ble_tag_scan_get_window(const struct ctr_ble_tag_scan *scan, int64_t duration,
+				    bool *passive)
+{
+	int64_t window = 0;
+
+	*passive = true;
+
+	for (size_t slot = 0; slot < CTR_BLE_TAG_COUNT; slot++) {
+		if (!(scan->enrolled_mask & BIT(slot))) {
+			continue;
+		}
+
+		/* Until every period is learned, the whole configured duration is scanned */
+		if (scan->slots[slot].period == 0) {
+			window = INT64_MAX;
+		} else if (window != INT64_MAX) {
+			int64_t span =
+				(int64_t)scan->slots[slot].period * CTR_BLE_TAG_SCAN_WINDOW_PERIODS;
+			window = MAX(window, span);
+		}
+
+		if (!scan->slots[slot].primary) {
+			*passive = false;
+		}
+	}
+
+	return MIN(window, duration);
+}
+
+void ctr_ble_tag_scan_begin(struct ctr_ble_tag_scan *scan, int64_t now)
+{
+	scan->heard_mask = 0;
+	scan->fresh_mask = 0;
+	scan->cycle_start = now;
+	scan->cycle_active = true;
+}
+
+bool ctr_ble_tag_scan_track(struct ctr_ble_tag_scan *scan, int slot, bool scan_rsp, int64_t now,
+			    int64_t duration)
+{
+	struct ctr_ble_tag_scan_slot *state = &scan->slots[slot];
+
+	if (!scan_rsp) {
+		state->primary = true;
+	} else if (state->primary) {
+		/* Response to an advert already counted */
+		return false;
+	}
+
+	if (!scan->cycle_active) {
+		return false;
+	}
+
+	if (scan->heard_mask & BIT(slot)) {
+		int32_t gap = MIN(now - state->last_heard, duration);
+
+		/* Lost adverts give multiples of the period - a shorter gap is taken at once, a
+		 * longer one only drifts the estimate */
+		if (state->period == 0 || gap < state->period) {
+			state->period = gap;
+		} else {
+			state->period += (gap - state->period) / 8;
+		}
+	}
+
+	state->last_heard = now;
+	scan->heard_mask |= BIT(slot);
+
+	if (state->period) {
+		scan->fresh_mask |= BIT(slot);
+	}
+
+	return (scan->fresh_mask & scan->enrolled_mask) == scan->enrolled_mask;
+}
+
+bool ctr_ble_tag_scan_end(struct ctr_ble_tag_scan *scan, int64_t now)
+{
+	scan->cycle_active = false;
+
+	bool complete = (scan->fresh_mask & scan->enrolled_mask) == scan->enrolled_mask;
+
+	if (!complete) {
+		/* Relearn the missed tags from a full active scan */
+		for (size_t slot = 0; slot < CTR_BLE_TAG_COUNT; slot++) {
+			if ((scan->enrolled_mask & BIT(slot)) && !(scan->heard_mask & BIT(slot))) {
+				scan->slots[slot].period = 0;
+				scan->slots[slot].primary = false;
+			}
+		}
+	}
+
+	int heard = POPCOUNT(scan->heard_mask & scan->enrolled_mask);
+	int enrolled = POPCOUNT(scan->enrolled_mask);
+
+	ctr_ble_tag_stats_add(&scan->stats, now - scan->cycle_start, heard, enrolled, complete);
+
+	return complete;
+}
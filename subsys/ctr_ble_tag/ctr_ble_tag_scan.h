@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_BLE_TAG_SCAN_H_
+#define CHESTER_SUBSYS_CTR_BLE_TAG_SCAN_H_
+
+/* CHESTER includes */
+#include <chester/ctr_ble_tag.h>
+
+/* Zephyr includes */
+#include <zephyr/bluetooth/bluetooth.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Open-addressed map of the enrolled addresses to their slot + 1 (0 marks a free bucket) */
+#define CTR_BLE_TAG_SCAN_MAP_SIZE (CTR_BLE_TAG_COUNT * 2)
+
+/* The periodic scan window spans this many learned advertising periods of the slowest tag, so
+ * two lost adverts in a row still fit in */
+#define CTR_BLE_TAG_SCAN_WINDOW_PERIODS 3
+
+struct ctr_ble_tag_scan_slot {
+	int64_t last_heard;
+	/* Learned advertising period in milliseconds, 0 while unknown */
+	int32_t period;
+	/* Data seen in the primary advertisement, the tag needs no scan request */
+	bool primary;
+};
+
+/* Periodic scan cycle state, the slots are marked fresh once heard with their period known */
+struct ctr_ble_tag_scan {
+	uint8_t (*addr)[BT_ADDR_SIZE];
+	uint8_t map[CTR_BLE_TAG_SCAN_MAP_SIZE];
+	uint32_t enrolled_mask;
+	struct ctr_ble_tag_scan_slot slots[CTR_BLE_TAG_COUNT];
+	bool cycle_active;
+	int64_t cycle_start;
+	uint32_t heard_mask;
+	uint32_t fresh_mask;
+	struct ctr_ble_tag_scan_stats stats;
+};
+
+/* Rebuilds the map from the committed addresses (kept referenced, empty ones are skipped) */
+void ctr_ble_tag_scan_build(struct ctr_ble_tag_scan *scan,
+			    uint8_t addr[CTR_BLE_TAG_COUNT][BT_ADDR_SIZE]);
+
+/* Returns the slot of an enrolled address or -ENOENT */
+int ctr_ble_tag_scan_find(const struct ctr_ble_tag_scan *scan, const uint8_t addr[BT_ADDR_SIZE]);
+
+/* Window in milliseconds (at most duration), passive when no tag needs a scan request */
+int64_t ctr_ble_tag_scan_get_window(const struct ctr_ble_tag_scan *scan, int64_t duration,
+				    bool *passive);
+
+void ctr_ble_tag_scan_begin(struct ctr_ble_tag_scan *scan, int64_t now);
+
+/* Learns the advertising period of the slot (gaps capped at duration), returns true once all
+ * enrolled tags are fresh so that the cycle can stop early */
+bool ctr_ble_tag_scan_track(struct ctr_ble_tag_scan *scan, int slot, bool scan_rsp, int64_t now,
+			    int64_t duration);
+
+/* Accounts the cycle, the missed tags are relearned - returns true when it was complete */
+bool ctr_ble_tag_scan_end(struct ctr_ble_tag_scan *scan, int64_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_BLE_TAG_SCAN_H_ */
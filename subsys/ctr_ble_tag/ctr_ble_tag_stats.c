@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_ble_tag_stats.h"
+
+/* CHESTER includes */
+#include <chester/ctr_ble_tag.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+void ctr_ble_tag_stats_add(struct ctr_ble_tag_scan_stats *stats, int64_t radio_on, int heard,
+			   int enrolled, bool early)
+{
+	if (radio_on < 0) {
+		radio_on = 0;
+	}
+
+	stats->last_radio_on = radio_on;
+	stats->last_heard = heard;
+	stats->last_enrolled = enrolled;
+	stats->total_radio_on += radio_on;
+	stats->cycles++;
+
+	if (early) {
+		stats->early_cycles++;
+	}
+}
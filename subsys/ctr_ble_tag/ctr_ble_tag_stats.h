@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_BLE_TAG_STATS_H_
+#define CHESTER_SUBSYS_CTR_BLE_TAG_STATS_H_
+
+/* CHESTER includes */
+#include <chester/ctr_ble_tag.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Accounts one finished periodic scan cycle (radio_on in milliseconds, negative taken as 0) */
+void ctr_ble_tag_stats_add(struct ctr_ble_tag_scan_stats *stats, int64_t radio_on, int heard,
+			   int enrolled, bool early);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_BLE_TAG_STATS_H_ */
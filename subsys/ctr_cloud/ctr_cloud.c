@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_cloud_batch.h"
+#include "ctr_cloud_compress.h"
 #include "ctr_cloud_msg.h"
 #include "ctr_cloud_packet.h"
 #include "ctr_cloud_transfer.h"
@@ -12,9 +14,14 @@
 #include "ctr_cloud_config.h"
 #include "ctr_cloud_spool.h"
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+#include "ctr_cloud_snapshot.h"
+#endif
+
 /* CHESTER includes */
 #include <chester/ctr_buf.h>
 #include <chester/ctr_cloud.h>
+#include <chester/ctr_config.h>
 #include <chester/ctr_info.h>
 #include <chester/ctr_rtc.h>
 
@@ -35,6 +42,8 @@
 #define WORK_Q_STACK_SIZE     4096
 #define WORK_Q_PRIORITY       K_LOWEST_APPLICATION_THREAD_PRIO
 
+#define FRAME_HEADER_SIZE (1 + 8) /* type + decoder hash */
+
 #define POLL_TIMEOUT     K_MINUTES(1)
 #define POLL_RETRY_DELAY K_MINUTES(5)
 
@@ -56,6 +65,12 @@ static k_timeout_t m_poll_period = K_NO_WAIT;
 
 static K_MUTEX_DEFINE(m_lock_state);
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+/* Current configuration and the last one acknowledged by the server (persisted) */
+static struct ctr_cloud_snapshot m_config_snapshot;
+static struct ctr_cloud_snapshot m_config_snapshot_base;
+#endif
+
 static struct ctr_cloud_metrics m_metrics = {
 	.uplink_last_ts = -1,
 	.uplink_error_last_ts = -1,
@@ -63,6 +78,7 @@ static struct ctr_cloud_metrics m_metrics = {
 	.downlink_error_last_ts = -1,
 	.poll_last_ts = -1,
 	.uplink_data_last_ts = -1,
+	.uplink_batch_last_ts = -1,
 	.downlink_data_last_ts = -1,
 	.recv_shell_last_ts = -1,
 };
@@ -103,6 +119,9 @@ static void transfer_cb(enum ctr_cloud_transfer_event event,
 	k_mutex_unlock(&m_lock_metrics);
 }
 
+static void upload_config_work_handler(struct k_work *work);
+static K_WORK_DEFINE(m_upload_config_work, upload_config_work_handler);
+
 static int process_downlink(struct ctr_buf *buf, struct ctr_buf *upbuf)
 {
 	int ret;
@@ -152,6 +171,14 @@ static int process_downlink(struct ctr_buf *buf, struct ctr_buf *upbuf)
 		LOG_INF("Session timestamp %lld", m_session.timestamp);
 		LOG_INF("Session device_id: %s", m_session.device_id);
 		LOG_INF("Session device_name: %s", m_session.device_name);
+		LOG_INF("Session transfer_window: %u", m_session.transfer_window);
+		LOG_INF("Session transfer_binary: %s", m_session.transfer_binary ? "yes" : "no");
+		LOG_INF("Session compression: 0x%02x", m_session.compression);
+		LOG_INF("Session batch_size: %u", m_session.batch_size);
+		LOG_INF("Session config_snapshot: %s", m_session.config_snapshot ? "yes" : "no");
+
+		ctr_cloud_transfer_set_window(m_session.transfer_window);
+		ctr_cloud_transfer_set_binary(m_session.transfer_binary);
 
 		break;
 	case DL_SET_TIMESTAMP: {
@@ -190,6 +217,9 @@ static int process_downlink(struct ctr_buf *buf, struct ctr_buf *upbuf)
 			LOG_ERR("Call `ctr_cloud_process_dlconfig` failed: %d", ret);
 			return ret;
 		}
+
+		/* Applied without reboot, so the new config hash has to be reported now */
+		k_work_submit_to_queue(&m_work_q, &m_upload_config_work);
 		break;
 	case DL_DOWNLOAD_DATA:
 		LOG_DBG("Received data");
@@ -308,6 +338,10 @@ static int create_session(void)
 
 	k_mutex_lock(&m_lock, K_FOREVER);
 
+	/* Transfer options are negotiated again with every new session */
+	ctr_cloud_transfer_set_window(1);
+	ctr_cloud_transfer_set_binary(false);
+
 	ctr_buf_reset(&m_transfer_buf);
 
 	ret = ctr_cloud_msg_pack_create_session(&m_transfer_buf);
@@ -455,6 +489,36 @@ static int upload_encoder(void)
 	return 0;
 }
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+static int pack_config_snapshot(void)
+{
+	int ret;
+
+	ret = ctr_cloud_snapshot_take(&m_config_snapshot);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_snapshot_take` failed: %d", ret);
+		return ret;
+	}
+
+	const struct ctr_cloud_snapshot *base = NULL;
+
+	/* The server applies a delta on top of the snapshot it holds, so only the acknowledged one
+	 * can serve as the base */
+	if (m_config_snapshot_base.hash == m_session.config_hash &&
+	    ctr_cloud_snapshot_is_delta_base(&m_config_snapshot, &m_config_snapshot_base)) {
+		base = &m_config_snapshot_base;
+	}
+
+	ret = ctr_cloud_msg_pack_config_snapshot(&m_transfer_buf, &m_config_snapshot, base);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_msg_pack_config_snapshot` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT) */
+
 static int upload_config(void)
 {
 	int ret;
@@ -471,12 +535,28 @@ static int upload_config(void)
 
 	ctr_buf_reset(&m_transfer_buf);
 
-	ret = ctr_cloud_msg_pack_config(&m_transfer_buf);
+	bool is_snapshot = false;
 
-	if (ret) {
-		LOG_ERR("Call `ctr_cloud_msg_pack_config` failed: %d", ret);
-		k_mutex_unlock(&m_lock);
-		return ret;
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+	/* Modules without a complete item table are only covered by the text upload */
+	if (m_session.config_snapshot && ctr_config_is_items_complete()) {
+		ret = pack_config_snapshot();
+		if (ret) {
+			LOG_WRN("Falling back to text config upload");
+			ctr_buf_reset(&m_transfer_buf);
+		} else {
+			is_snapshot = true;
+		}
+	}
+#endif
+
+	if (!is_snapshot) {
+		ret = ctr_cloud_msg_pack_config(&m_transfer_buf);
+		if (ret) {
+			LOG_ERR("Call `ctr_cloud_msg_pack_config` failed: %d", ret);
+			k_mutex_unlock(&m_lock);
+			return ret;
+		}
 	}
 
 	uint64_t hash;
@@ -500,6 +580,17 @@ static int upload_config(void)
 
 		m_session.config_hash = hash;
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+		if (is_snapshot) {
+			m_config_snapshot_base = m_config_snapshot;
+
+			ret = ctr_cloud_snapshot_save(&m_config_snapshot_base);
+			if (ret) {
+				LOG_WRN("Call `ctr_cloud_snapshot_save` failed: %d", ret);
+			}
+		}
+#endif
+
 		LOG_INF("Uploading config finished");
 	}
 
@@ -508,6 +599,14 @@ static int upload_config(void)
 	return 0;
 }
 
+static void upload_config_work_handler(struct k_work *work)
+{
+	int ret = upload_config();
+	if (ret) {
+		LOG_WRN("Call `upload_config` failed: %d", ret);
+	}
+}
+
 #if defined(CONFIG_MCUBOOT_IMG_MANAGER)
 static int firmware_confirmed(void)
 {
@@ -674,6 +773,14 @@ int ctr_cloud_init(struct ctr_cloud_options *options)
 		return ret;
 	}
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+	/* Without the stored snapshot the first upload is a full one */
+	ret = ctr_cloud_snapshot_load(&m_config_snapshot_base);
+	if (ret) {
+		LOG_WRN("Call `ctr_cloud_snapshot_load` failed: %d", ret);
+	}
+#endif
+
 	k_mutex_init(&m_lock);
 	k_mutex_init(&m_lock_state);
 
@@ -797,6 +904,101 @@ static int frame_reset(void)
 	return 0;
 }
 
+#if defined(CONFIG_CTR_CLOUD_COMPRESSION)
+
+/* Both conversions use the free space behind the frame as scratch memory */
+
+static int frame_compress(void)
+{
+	int ret;
+	uint8_t *mem = ctr_buf_get_mem(&m_transfer_buf);
+	size_t len = ctr_buf_get_used(&m_transfer_buf) - FRAME_HEADER_SIZE;
+	size_t free = ctr_buf_get_free(&m_transfer_buf);
+	uint8_t *out = mem + ctr_buf_get_used(&m_transfer_buf);
+	size_t out_len;
+
+	if (mem[0] != UL_UPLOAD_DATA) {
+		return 0;
+	}
+
+	if (len > UINT16_MAX || free < CTR_CLOUD_COMPRESS_BOUND(len)) {
+		LOG_DBG("Not enough space to compress payload: %zu", len);
+		return 0;
+	}
+
+	ret = ctr_cloud_compress(mem + FRAME_HEADER_SIZE, len, out, free, &out_len);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_compress` failed: %d", ret);
+		return ret;
+	}
+
+	if (out_len + 2 >= len) {
+		LOG_DBG("Payload not compressible: %zu -> %zu", len, out_len);
+		return 0;
+	}
+
+	mem[0] |= UL_UPLOAD_DATA_FLAG_COMPRESSED;
+	sys_put_be16(len, mem + FRAME_HEADER_SIZE);
+	memmove(mem + FRAME_HEADER_SIZE + 2, out, out_len);
+	ctr_buf_seek(&m_transfer_buf, FRAME_HEADER_SIZE + 2 + out_len);
+
+	LOG_INF("Payload compressed: %zu -> %zu bytes", len, out_len);
+
+	return 0;
+}
+
+#if defined(CONFIG_CTR_CLOUD_SPOOL)
+
+/* Decompresses the frame starting at `offset` (it has to be the last one in the buffer) */
+static int frame_decompress(size_t offset)
+{
+	int ret;
+	uint8_t *mem = ctr_buf_get_mem(&m_transfer_buf) + offset;
+	size_t used = ctr_buf_get_used(&m_transfer_buf) - offset;
+	size_t free = ctr_buf_get_free(&m_transfer_buf);
+	uint8_t *out = mem + used;
+	size_t out_len;
+
+	if (used < FRAME_HEADER_SIZE) {
+		return -EBADMSG;
+	}
+
+	if (!(mem[0] & UL_UPLOAD_DATA_FLAG_COMPRESSED)) {
+		return 0;
+	}
+
+	if (used < FRAME_HEADER_SIZE + 2) {
+		return -EBADMSG;
+	}
+
+	size_t len = sys_get_be16(mem + FRAME_HEADER_SIZE);
+	if (free < len) {
+		return -ENOSPC;
+	}
+
+	ret = ctr_cloud_decompress(mem + FRAME_HEADER_SIZE + 2, used - FRAME_HEADER_SIZE - 2, out,
+				   free, &out_len);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_decompress` failed: %d", ret);
+		return ret;
+	}
+
+	if (out_len != len) {
+		LOG_ERR("Decompressed length mismatch: %zu != %zu", out_len, len);
+		return -EBADMSG;
+	}
+
+	mem[0] &= ~UL_UPLOAD_DATA_FLAG_COMPRESSED;
+	memmove(mem + FRAME_HEADER_SIZE, out, out_len);
+	ctr_buf_seek(&m_transfer_buf, offset + FRAME_HEADER_SIZE + out_len);
+
+	return 0;
+}
+
+#endif /* defined(CONFIG_CTR_CLOUD_SPOOL) */
+
+#endif /* defined(CONFIG_CTR_CLOUD_COMPRESSION) */
+
 static int frame_send(k_timeout_t timeout)
 {
 	int ret;
@@ -817,6 +1019,74 @@ static int frame_send(k_timeout_t timeout)
 
 #if defined(CONFIG_CTR_CLOUD_SPOOL)
 
+/* Appends a spooled frame to the transfer buffer - decompressed unless the session accepts
+ * compressed payloads (it may have been spooled during a session that did) */
+static int frame_load(ctr_cloud_spool_id id)
+{
+	int ret;
+	size_t offset = ctr_buf_get_used(&m_transfer_buf);
+
+	ret = ctr_cloud_spool_load(id, &m_transfer_buf);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_spool_load` failed: %d", ret);
+		return ret;
+	}
+
+#if defined(CONFIG_CTR_CLOUD_COMPRESSION)
+	if (!(m_session.compression & CTR_CLOUD_COMPRESS_CODEC_LZSS)) {
+		ret = frame_decompress(offset);
+		if (ret) {
+			LOG_ERR("Call `frame_decompress` failed: %d", ret);
+			return ret;
+		}
+	}
+#else
+	ARG_UNUSED(offset);
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_CTR_CLOUD_SPOOL_BATCH)
+
+static int batch_load(ctr_cloud_spool_id id, struct ctr_buf *buf, void *user_data)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(user_data);
+
+	/* The batch is built in the transfer buffer */
+	return frame_load(id);
+}
+
+static int batch_send(struct ctr_buf *buf, int count, void *user_data)
+{
+	int ret;
+	k_timepoint_t *end = user_data;
+
+	size_t bytes = ctr_buf_get_used(buf);
+
+	ret = uplink(buf, sys_timepoint_timeout(*end));
+	if (ret) {
+		LOG_ERR("Call `uplink` failed: %d", ret);
+		return ret;
+	}
+
+	k_mutex_lock(&m_lock_metrics, K_FOREVER);
+	m_metrics.uplink_data_count += count;
+	ctr_rtc_get_ts(&m_metrics.uplink_data_last_ts);
+	m_metrics.uplink_batch_count++;
+	m_metrics.uplink_batch_messages += count;
+	m_metrics.uplink_batch_bytes += bytes;
+	m_metrics.uplink_batch_last_ts = m_metrics.uplink_data_last_ts;
+	k_mutex_unlock(&m_lock_metrics);
+
+	LOG_INF("Spooled batch sent: %d messages (%zu bytes)", count, bytes);
+
+	return 0;
+}
+
+#endif /* defined(CONFIG_CTR_CLOUD_SPOOL_BATCH) */
+
 /* Uplink works again - drain messages spooled during previous failures */
 static void drain_spool(k_timepoint_t end)
 {
@@ -824,13 +1094,26 @@ static void drain_spool(k_timepoint_t end)
 	ctr_cloud_spool_id id;
 
 	while (!ctr_cloud_spool_peek(&id)) {
+#if defined(CONFIG_CTR_CLOUD_SPOOL_BATCH)
+		if (m_session.batch_size) {
+			size_t budget =
+				MIN(m_session.batch_size, CONFIG_CTR_CLOUD_SPOOL_BATCH_SIZE);
+
+			ret = ctr_cloud_batch_drain(&m_transfer_buf, id, budget, batch_load,
+						    batch_send, &end);
+			if (ret < 0) {
+				return;
+			} else if (ret > 0) {
+				continue;
+			}
+		}
+#endif
+
 		/* Spooled messages hold the complete frame - send as-is */
 		ctr_buf_reset(&m_transfer_buf);
 
-		ret = ctr_cloud_spool_load(id, &m_transfer_buf);
+		ret = frame_load(id);
 		if (ret) {
-			LOG_ERR("Call `ctr_cloud_spool_load` failed: %d", ret);
-
 			/* Unreadable message would block draining forever - drop it */
 			ret = ctr_cloud_spool_delete(id);
 			if (ret) {
@@ -885,6 +1168,15 @@ int ctr_cloud_send_data(const void *buf, size_t len, k_timeout_t timeout)
 		return ret;
 	}
 
+#if defined(CONFIG_CTR_CLOUD_COMPRESSION)
+	if (m_session.compression & CTR_CLOUD_COMPRESS_CODEC_LZSS) {
+		ret = frame_compress();
+		if (ret) {
+			LOG_WRN("Call `frame_compress` failed: %d (sending uncompressed)", ret);
+		}
+	}
+#endif
+
 #if defined(CONFIG_CTR_CLOUD_SPOOL)
 	/* The spool acts as a send buffer - every message is stored first
 	 * (as the complete frame) and removed only once it has been sent */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_cloud_batch.h"
+#include "ctr_cloud_msg.h"
+#include "ctr_cloud_spool.h"
+
+/* CHESTER includes */
+#include <chester/ctr_buf.h>
+
+/* Zephyr includes */
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_REGISTER(ctr_cloud_batch, CONFIG_CTR_CLOUD_LOG_LEVEL);
+
+int ctr_cloud_batch_drain(struct ctr_buf *buf, ctr_cloud_spool_id id, size_t budget,
+			  ctr_cloud_batch_load_cb load, ctr_cloud_batch_send_cb send,
+			  void *user_data)
+{
+	int ret;
+	ctr_cloud_spool_id ids[CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT];
+	int count = 0;
+
+	ctr_buf_reset(buf);
+
+	ret = ctr_buf_append_u8(buf, UL_UPLOAD_BATCH);
+	if (ret) {
+		LOG_ERR("Call `ctr_buf_append_u8` failed: %d", ret);
+		return ret;
+	}
+
+	for (;;) {
+		size_t offset = ctr_buf_get_used(buf);
+
+		ret = ctr_buf_append_u16_be(buf, 0);
+		if (!ret) {
+			ret = load(id, buf, user_data);
+		}
+
+		size_t used = ctr_buf_get_used(buf);
+		size_t len = used - offset - UL_UPLOAD_BATCH_RECORD_HEADER_SIZE;
+
+		/* A completely filled buffer may hold a truncated frame - the message is left for
+		 * the next batch (or sent alone) */
+		if (ret || !ctr_buf_get_free(buf) || len > UINT16_MAX || used > budget) {
+			ctr_buf_seek(buf, offset);
+			break;
+		}
+
+		sys_put_be16(len, ctr_buf_get_mem(buf) + offset);
+
+		ids[count++] = id;
+
+		if (count == ARRAY_SIZE(ids) || ctr_cloud_spool_next(id, &id)) {
+			break;
+		}
+	}
+
+	if (!count) {
+		return 0;
+	}
+
+	ret = send(buf, count, user_data);
+	if (ret) {
+		LOG_ERR("Call `send` failed: %d", ret);
+		return ret;
+	}
+
+	/* The whole batch has been acknowledged - only now remove it from the spool */
+	for (int i = 0; i < count; i++) {
+		ret = ctr_cloud_spool_delete(ids[i]);
+		if (ret) {
+			LOG_ERR("Call `ctr_cloud_spool_delete` failed: %d", ret);
+			return ret;
+		}
+	}
+
+	return count;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_CLOUD_BATCH_H_
+#define CHESTER_SUBSYS_CTR_CLOUD_BATCH_H_
+
+#include "ctr_cloud_spool.h"
+
+/* CHESTER includes */
+#include <chester/ctr_buf.h>
+
+/* Standard includes */
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Appends the spooled frame at the buffer's current position */
+typedef int (*ctr_cloud_batch_load_cb)(ctr_cloud_spool_id id, struct ctr_buf *buf,
+				       void *user_data);
+
+/* Sends the batch frame holding `count` messages, returns 0 once it is acknowledged */
+typedef int (*ctr_cloud_batch_send_cb)(struct ctr_buf *buf, int count, void *user_data);
+
+/* Packs the oldest spooled messages (starting with `id`) into one UL_UPLOAD_BATCH frame of at most
+ * `budget` bytes and CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT messages, sends it and deletes the messages
+ * from the spool once it is acknowledged. A message that fails to load ends the batch before it.
+ * Returns the number of messages sent, 0 when not even the first one fits a batch, negative on
+ * error. */
+int ctr_cloud_batch_drain(struct ctr_buf *buf, ctr_cloud_spool_id id, size_t budget,
+			  ctr_cloud_batch_load_cb load, ctr_cloud_batch_send_cb send,
+			  void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_CLOUD_BATCH_H_ */
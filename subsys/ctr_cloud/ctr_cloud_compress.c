@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_cloud_compress.h"
+
+/* Zephyr includes */
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define WINDOW_SIZE 4096
+#define MIN_MATCH   3
+#define MAX_MATCH   (MIN_MATCH + 15)
+#define HASH_BITS   10
+#define HASH_EMPTY  UINT16_MAX
+
+LOG_MODULE_REGISTER(ctr_cloud_compress, CONFIG_CTR_CLOUD_LOG_LEVEL);
+
+/* Last position of every 3-byte prefix hash (2 KiB) */
+static uint16_t m_hash[1 << HASH_BITS];
+
+static inline uint32_t hash(const uint8_t *p)
+{
+	uint32_t v = (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+
+	return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+int ctr_cloud_compress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_size,
+		       size_t *dst_len)
+{
+	if (src_len >= HASH_EMPTY) {
+		LOG_ERR("Input is too large: %zu", src_len);
+		return -EINVAL;
+	}
+
+	memset(m_hash, 0xff, sizeof(m_hash));
+
+	size_t i = 0;
+	size_t o = 0;
+
+	while (i < src_len) {
+		if (o >= dst_size) {
+			return -ENOSPC;
+		}
+
+		size_t ctrl = o++;
+		dst[ctrl] = 0;
+
+		for (int bit = 0; bit < 8 && i < src_len; bit++) {
+			size_t best_len = 0;
+			size_t best_dist = 0;
+
+			if (i + MIN_MATCH <= src_len) {
+				uint32_t h = hash(&src[i]);
+				uint16_t cand = m_hash[h];
+
+				m_hash[h] = i;
+
+				if (cand != HASH_EMPTY && i - cand <= WINDOW_SIZE) {
+					size_t max = MIN(MAX_MATCH, src_len - i);
+					size_t n = 0;
+
+					while (n < max && src[cand + n] == src[i + n]) {
+						n++;
+					}
+
+					if (n >= MIN_MATCH) {
+						best_len = n;
+						best_dist = i - cand;
+					}
+				}
+			}
+
+			if (best_len) {
+				if (o + 2 > dst_size) {
+					return -ENOSPC;
+				}
+
+				dst[ctrl] |= BIT(bit);
+				dst[o++] = (best_dist - 1) & 0xff;
+				dst[o++] = ((best_dist - 1) >> 8) << 4 | (best_len - MIN_MATCH);
+
+				/* Keep the table current for positions covered by the match */
+				for (size_t k = 1; k < best_len; k++) {
+					if (i + k + MIN_MATCH <= src_len) {
+						m_hash[hash(&src[i + k])] = i + k;
+					}
+				}
+
+				i += best_len;
+			} else {
+				if (o + 1 > dst_size) {
+					return -ENOSPC;
+				}
+
+				dst[o++] = src[i++];
+			}
+		}
+	}
+
+	*dst_len = o;
+
+	return 0;
+}
+
+int ctr_cloud_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_size,
+			 size_t *dst_len)
+{
+	size_t i = 0;
+	size_t o = 0;
+
+	while (i < src_len) {
+		uint8_t ctrl = src[i++];
+
+		for (int bit = 0; bit < 8 && i < src_len; bit++) {
+			if (ctrl & BIT(bit)) {
+				if (i + 2 > src_len) {
+					return -EBADMSG;
+				}
+
+				size_t dist = (src[i] | (src[i + 1] >> 4) << 8) + 1;
+				size_t len = (src[i + 1] & 0x0f) + MIN_MATCH;
+				i += 2;
+
+				if (dist > o) {
+					return -EBADMSG;
+				}
+
+				if (o + len > dst_size) {
+					return -ENOSPC;
+				}
+
+				/* Byte-wise copy - matches may overlap their own output */
+				for (size_t k = 0; k < len; k++, o++) {
+					dst[o] = dst[o - dist];
+				}
+			} else {
+				if (o >= dst_size) {
+					return -ENOSPC;
+				}
+
+				dst[o++] = src[i++];
+			}
+		}
+	}
+
+	*dst_len = o;
+
+	return 0;
+}
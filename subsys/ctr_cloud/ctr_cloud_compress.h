@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_CLOUD_COMPRESS_H_
+#define CHESTER_SUBSYS_CTR_CLOUD_COMPRESS_H_
+
+/* Standard includes */
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * LZSS codec for uplink payloads. Every group of up to 8 items is preceded by a control byte
+ * (LSB first, bit set = match). A literal is one byte, a match is two bytes carrying a 12-bit
+ * back-reference distance (1-4096) and a 4-bit length (3-18).
+ */
+
+#define CTR_CLOUD_COMPRESS_CODEC_LZSS 0x01
+
+/* Worst-case output size for incompressible input */
+#define CTR_CLOUD_COMPRESS_BOUND(len) ((len) + (len) / 8 + 1)
+
+/* Not thread-safe - uses a static match table (caller holds the cloud lock) */
+int ctr_cloud_compress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_size,
+		       size_t *dst_len);
+int ctr_cloud_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_size,
+			 size_t *dst_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_CLOUD_COMPRESS_H_ */
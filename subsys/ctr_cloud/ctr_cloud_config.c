@@ -35,6 +35,12 @@ static struct ctr_config_item m_config_items[] = {
 #endif
 };
 
+/* Read on each spool write, applied without reboot */
+static const char *const m_hot_items[] = {
+	"spool-size",
+	NULL,
+};
+
 int ctr_cloud_config_cmd_show(const struct shell *shell, size_t argc, char **argv)
 {
 	for (int i = 0; i < ARRAY_SIZE(m_config_items); i++) {
@@ -99,6 +105,13 @@ static int init(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, ctr_cloud_config_cmd_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
+
+	ret = ctr_config_set_hot_items(m_config_items, m_hot_items, h_commit);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_set_hot_items` failed: %d", ret);
+		return ret;
+	}
 
 	return 0;
 }
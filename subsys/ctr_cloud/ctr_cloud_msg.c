@@ -4,9 +4,14 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_cloud_compress.h"
 #include "ctr_cloud_msg.h"
 #include "ctr_cloud_util.h"
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+#include "ctr_cloud_snapshot.h"
+#endif
+
 /* Standard includes */
 #include <errno.h>
 #include <math.h>
@@ -51,14 +56,24 @@
 #define UL_SESSION_KEY_CTR_Z_HW_REVISION   0x0d
 #define UL_SESSION_KEY_CTR_Z_HW_VARIANT    0x0e
 #define UL_SESSION_KEY_CTR_Z_FW_VERSION    0x0f
-
-#define DL_SESSION_KEY_ID           0x00
-#define DL_SESSION_KEY_DECODER_HASH 0x01
-#define DL_SESSION_KEY_ENCODER_HASH 0x02
-#define DL_SESSION_KEY_CONFIG_HASH  0x03
-#define DL_SESSION_KEY_TIMESTAMP    0x04
-#define DL_SESSION_KEY_DEVICE_ID    0x05
-#define DL_SESSION_KEY_DEVICE_NAME  0x06
+#define UL_SESSION_KEY_TRANSFER_WINDOW     0x12
+#define UL_SESSION_KEY_TRANSFER_BINARY     0x13
+#define UL_SESSION_KEY_COMPRESSION         0x14
+#define UL_SESSION_KEY_SPOOL_BATCH         0x15
+#define UL_SESSION_KEY_CONFIG_SNAPSHOT     0x16
+
+#define DL_SESSION_KEY_ID              0x00
+#define DL_SESSION_KEY_DECODER_HASH    0x01
+#define DL_SESSION_KEY_ENCODER_HASH    0x02
+#define DL_SESSION_KEY_CONFIG_HASH     0x03
+#define DL_SESSION_KEY_TIMESTAMP       0x04
+#define DL_SESSION_KEY_DEVICE_ID       0x05
+#define DL_SESSION_KEY_DEVICE_NAME     0x06
+#define DL_SESSION_KEY_TRANSFER_WINDOW 0x07
+#define DL_SESSION_KEY_TRANSFER_BINARY 0x08
+#define DL_SESSION_KEY_COMPRESSION     0x09
+#define DL_SESSION_KEY_SPOOL_BATCH     0x0a
+#define DL_SESSION_KEY_CONFIG_SNAPSHOT 0x0b
 
 #define UL_STATS_KEY_UPTIME         0x00
 #define UL_STATS_KEY_NETWORK_EEST   0x01
@@ -73,6 +88,11 @@
 
 #define UL_CONFIG_HEADER_NOCOMPRESSION 0x00
 
+/* Structured snapshot (CBOR map of typed values) instead of the `config show` lines - a delta is
+ * followed by the hash (u64 BE) of the snapshot it applies to */
+#define UL_CONFIG_HEADER_FLAG_SNAPSHOT 0x40
+#define UL_CONFIG_HEADER_FLAG_DELTA    0x20
+
 #define DL_SHELL_KEY_COMMANDS   0x00
 #define DL_SHELL_KEY_MESSAGE_ID 0x01
 
@@ -264,6 +284,33 @@ int ctr_cloud_msg_pack_create_session(struct ctr_buf *buf)
 
 #endif /* defined(CONFIG_SHIELD_CTR_Z) */
 
+#if CONFIG_CTR_CLOUD_TRANSFER_WINDOW > 1
+	/* Servers without windowed transfer support ignore this key and keep
+	 * acknowledging every fragment */
+	zcbor_uint32_put(zs, UL_SESSION_KEY_TRANSFER_WINDOW);
+	zcbor_uint32_put(zs, CONFIG_CTR_CLOUD_TRANSFER_WINDOW);
+#endif
+
+#if defined(CONFIG_CTR_CLOUD_TRANSFER_BINARY)
+	zcbor_uint32_put(zs, UL_SESSION_KEY_TRANSFER_BINARY);
+	zcbor_bool_put(zs, true);
+#endif
+
+#if defined(CONFIG_CTR_CLOUD_COMPRESSION)
+	zcbor_uint32_put(zs, UL_SESSION_KEY_COMPRESSION);
+	zcbor_uint32_put(zs, CTR_CLOUD_COMPRESS_CODEC_LZSS);
+#endif
+
+#if defined(CONFIG_CTR_CLOUD_SPOOL_BATCH)
+	zcbor_uint32_put(zs, UL_SESSION_KEY_SPOOL_BATCH);
+	zcbor_uint32_put(zs, CONFIG_CTR_CLOUD_SPOOL_BATCH_SIZE);
+#endif
+
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+	zcbor_uint32_put(zs, UL_SESSION_KEY_CONFIG_SNAPSHOT);
+	zcbor_bool_put(zs, true);
+#endif
+
 	zcbor_map_end_encode(zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH);
 
 	ctr_buf_seek(buf, 1 + (zs->payload - p));
@@ -330,6 +377,31 @@ int ctr_cloud_msg_unpack_set_session(struct ctr_buf *buf, struct ctr_cloud_sessi
 				TSTRCPY(session->device_name, tstr);
 			}
 			break;
+		case DL_SESSION_KEY_TRANSFER_WINDOW: {
+			uint32_t window;
+			ok = zcbor_uint32_decode(zs, &window);
+			if (ok) {
+				session->transfer_window = MIN(window, UINT8_MAX);
+			}
+			break;
+		}
+		case DL_SESSION_KEY_TRANSFER_BINARY:
+			ok = zcbor_bool_decode(zs, &session->transfer_binary);
+			break;
+		case DL_SESSION_KEY_COMPRESSION: {
+			uint32_t codecs;
+			ok = zcbor_uint32_decode(zs, &codecs);
+			if (ok) {
+				session->compression = codecs & CTR_CLOUD_COMPRESS_CODEC_LZSS;
+			}
+			break;
+		}
+		case DL_SESSION_KEY_SPOOL_BATCH:
+			ok = zcbor_uint32_decode(zs, &session->batch_size);
+			break;
+		case DL_SESSION_KEY_CONFIG_SNAPSHOT:
+			ok = zcbor_bool_decode(zs, &session->config_snapshot);
+			break;
 		}
 		if (!ok) {
 			return -EBADMSG;
@@ -620,6 +692,64 @@ int ctr_cloud_msg_pack_config(struct ctr_buf *buf)
 	return 0;
 }
 
+#if defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT)
+
+int ctr_cloud_msg_pack_config_snapshot(struct ctr_buf *buf,
+				       const struct ctr_cloud_snapshot *snapshot,
+				       const struct ctr_cloud_snapshot *base)
+{
+	int ret;
+
+	ret = ctr_buf_append_u8(buf, UL_UPLOAD_CONFIG);
+	if (ret) {
+		LOG_ERR("Call `ctr_buf_append_u8` failed: %d", ret);
+		return ret;
+	}
+
+	ret = ctr_buf_append_u64_be(buf, snapshot->hash);
+	if (ret) {
+		LOG_ERR("Call `ctr_buf_append_u64_be` failed: %d", ret);
+		return ret;
+	}
+
+	uint8_t header = UL_CONFIG_HEADER_NOCOMPRESSION | UL_CONFIG_HEADER_FLAG_SNAPSHOT;
+
+	if (base) {
+		header |= UL_CONFIG_HEADER_FLAG_DELTA;
+	}
+
+	ret = ctr_buf_append_u8(buf, header);
+	if (ret) {
+		LOG_ERR("Call `ctr_buf_append_u8` failed: %d", ret);
+		return ret;
+	}
+
+	if (base) {
+		ret = ctr_buf_append_u64_be(buf, base->hash);
+		if (ret) {
+			LOG_ERR("Call `ctr_buf_append_u64_be` failed: %d", ret);
+			return ret;
+		}
+	}
+
+	size_t used = ctr_buf_get_used(buf);
+	uint8_t *p = ctr_buf_get_mem(buf) + used;
+
+	ZCBOR_STATE_E(zs, 2, p, ctr_buf_get_free(buf), 1);
+
+	ret = ctr_cloud_snapshot_encode(zs, snapshot, base);
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_snapshot_encode` failed: %d", ret);
+		return ret;
+	}
+
+	ctr_buf_seek(buf, used + (zs->payload - p));
+
+	return 0;
+}
+
+#endif /* defined(CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT) */
+
 int ctr_cloud_msg_unpack_config(struct ctr_buf *buf, struct ctr_cloud_msg_dlconfig *config)
 {
 	if (config == NULL) {
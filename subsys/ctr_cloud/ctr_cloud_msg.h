@@ -32,6 +32,15 @@ extern "C" {
 #define UL_UPLOAD_DATA     0x06
 #define UL_UPLOAD_SHELL    0x07
 #define UL_UPLOAD_FIRMWARE 0x08
+#define UL_UPLOAD_BATCH    0x09
+
+/* Set in the UL_UPLOAD_DATA type byte when the payload is compressed - the hash is then followed
+ * by the uncompressed payload length (u16 BE) and the compressed payload */
+#define UL_UPLOAD_DATA_FLAG_COMPRESSED 0x40
+
+/* UL_UPLOAD_BATCH carries several spooled UL_UPLOAD_DATA frames, each preceded by its length
+ * (u16 BE) */
+#define UL_UPLOAD_BATCH_RECORD_HEADER_SIZE 2
 
 #define DL_SET_SESSION       0x80
 #define DL_SET_TIMESTAMP     0x81
@@ -46,6 +55,8 @@ extern "C" {
 
 typedef uint8_t ctr_cloud_uuid_t[16];
 
+struct ctr_cloud_snapshot;
+
 struct ctr_cloud_msg_dlconfig {
 	int lines;
 	struct ctr_buf *buf;
@@ -98,6 +109,10 @@ int ctr_cloud_msg_pack_encoder(struct ctr_buf *buf, uint64_t hash, const uint8_t
 int ctr_cloud_msg_pack_stats(struct ctr_buf *buf);
 
 int ctr_cloud_msg_pack_config(struct ctr_buf *buf);
+/* Full snapshot without the base, otherwise only the items changed since the base */
+int ctr_cloud_msg_pack_config_snapshot(struct ctr_buf *buf,
+				       const struct ctr_cloud_snapshot *snapshot,
+				       const struct ctr_cloud_snapshot *base);
 int ctr_cloud_msg_unpack_config(struct ctr_buf *buf, struct ctr_cloud_msg_dlconfig *config);
 
 int ctr_cloud_msg_get_hash(struct ctr_buf *buf, uint64_t *hash);
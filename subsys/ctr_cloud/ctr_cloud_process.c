@@ -101,26 +101,21 @@ int ctr_cloud_process_dlconfig(struct ctr_cloud_msg_dlconfig *config)
 		}
 
 		LOG_INF("Shell output: %s", p);
-
-		k_sleep(K_MSEC(10));
 	}
 
-	k_sleep(K_SECONDS(1));
-
-	LOG_INF("Save config and reboot");
-
-#if defined CONFIG_ZTEST
-	return 0;
-#endif
-
-	k_sleep(K_SECONDS(1));
-
-	ret = ctr_config_save(true); // Save config and reboot
+	/*
+	 * Only the changed items are written, the reboot is left out when all of them are hot (the
+	 * settings are saved in full with reboot if any module is not covered by an item table)
+	 */
+	bool is_reboot_needed;
+	ret = ctr_config_apply(!IS_ENABLED(CONFIG_ZTEST), &is_reboot_needed);
 	if (ret) {
-		LOG_ERR("Call `ctr_config_save` failed: %d", ret);
+		LOG_ERR("Call `ctr_config_apply` failed: %d", ret);
 		return ret;
 	}
 
+	LOG_INF("Config applied, reboot needed: %s", is_reboot_needed ? "true" : "false");
+
 	return 0;
 }
 
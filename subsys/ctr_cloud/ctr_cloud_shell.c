@@ -121,6 +121,10 @@ static int cmd_metrics(const struct shell *shell, size_t argc, char **argv)
 	print_ts(shell, "poll last ts", metrics.poll_last_ts, now);
 	shell_print(shell, "uplink data count: %u", metrics.uplink_data_count);
 	print_ts(shell, "uplink data last ts", metrics.uplink_data_last_ts, now);
+	shell_print(shell, "uplink batch count: %u", metrics.uplink_batch_count);
+	shell_print(shell, "uplink batch messages: %u", metrics.uplink_batch_messages);
+	shell_print(shell, "uplink batch bytes: %u", metrics.uplink_batch_bytes);
+	print_ts(shell, "uplink batch last ts", metrics.uplink_batch_last_ts, now);
 	shell_print(shell, "downlink data count: %u", metrics.downlink_data_count);
 	print_ts(shell, "downlink data last ts", metrics.downlink_data_last_ts, now);
 	shell_print(shell, "recv shell count: %u", metrics.recv_shell_count);
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_cloud_snapshot.h"
+#include "ctr_cloud_util.h"
+
+/* CHESTER includes */
+#include <chester/ctr_config.h>
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+/* Zephyr includes */
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(ctr_cloud_snapshot, CONFIG_CTR_CLOUD_LOG_LEVEL);
+
+#define MODULE_MAX_LEN 32
+
+/* Header stored in front of the digests */
+#define SNAPSHOT_HEADER_SIZE offsetof(struct ctr_cloud_snapshot, digests)
+
+/* Same module naming as `config show` - anything after '-' is dropped */
+static void get_module(const struct ctr_config_item *item, char module[MODULE_MAX_LEN])
+{
+	strncpy(module, item->module, MODULE_MAX_LEN - 1);
+	module[MODULE_MAX_LEN - 1] = '\0';
+
+	char *p = strchr(module, '-');
+	if (p) {
+		*p = '\0';
+	}
+}
+
+static uint32_t crc_key(uint32_t crc, const struct ctr_config_item *item)
+{
+	char module[MODULE_MAX_LEN];
+	get_module(item, module);
+
+	uint8_t type = item->type;
+
+	crc = crc32_ieee_update(crc, (const uint8_t *)module, strlen(module) + 1);
+	crc = crc32_ieee_update(crc, (const uint8_t *)item->name, strlen(item->name) + 1);
+	crc = crc32_ieee_update(crc, &type, sizeof(type));
+
+	return crc;
+}
+
+static uint32_t get_digest(const struct ctr_config_item *item)
+{
+	uint32_t digest = ctr_config_get_item_digest(item);
+
+	return crc32_ieee_update(crc_key(0, item), (const uint8_t *)&digest, sizeof(digest));
+}
+
+static int take_cb(const struct ctr_config_item *items, int nitems, void *user_data)
+{
+	struct ctr_cloud_snapshot *snapshot = user_data;
+
+	for (int i = 0; i < nitems; i++) {
+		if (snapshot->count >= ARRAY_SIZE(snapshot->digests)) {
+			return -ENOSPC;
+		}
+
+		snapshot->layout = crc_key(snapshot->layout, &items[i]);
+		snapshot->digests[snapshot->count++] = get_digest(&items[i]);
+	}
+
+	return 0;
+}
+
+int ctr_cloud_snapshot_take(struct ctr_cloud_snapshot *snapshot)
+{
+	int ret;
+
+	memset(snapshot, 0, sizeof(*snapshot));
+
+	ret = ctr_config_foreach_items(take_cb, snapshot);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_foreach_items` failed: %d", ret);
+		return ret;
+	}
+
+	uint8_t hash[8];
+	ret = ctr_cloud_calculate_hash(hash, (const uint8_t *)snapshot->digests,
+				       snapshot->count * sizeof(snapshot->digests[0]));
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_calculate_hash` failed: %d", ret);
+		return ret;
+	}
+
+	snapshot->hash = sys_get_be64(hash);
+
+	return 0;
+}
+
+bool ctr_cloud_snapshot_is_delta_base(const struct ctr_cloud_snapshot *snapshot,
+				      const struct ctr_cloud_snapshot *base)
+{
+	return base->count > 0 && base->count == snapshot->count &&
+	       base->layout == snapshot->layout;
+}
+
+static bool encode_item(zcbor_state_t *zs, const struct ctr_config_item *item)
+{
+	if (!zcbor_tstr_encode_ptr(zs, item->name, strlen(item->name))) {
+		return false;
+	}
+
+	switch (item->type) {
+	case CTR_CONFIG_TYPE_INT:
+		return zcbor_int32_put(zs, *(int *)item->variable);
+
+	case CTR_CONFIG_TYPE_FLOAT:
+		return zcbor_float32_put(zs, *(float *)item->variable);
+
+	case CTR_CONFIG_TYPE_BOOL:
+		return zcbor_bool_put(zs, *(bool *)item->variable);
+
+	case CTR_CONFIG_TYPE_ENUM: {
+		int32_t val = 0;
+		memcpy(&val, item->variable, item->size);
+
+		/* Sparse enums (e.g. the LoRaWAN band) leave the unused values empty */
+		if (val < 0 || val >= item->max || !item->enums[val][0]) {
+			return zcbor_int32_put(zs, val);
+		}
+
+		return zcbor_tstr_encode_ptr(zs, item->enums[val], strlen(item->enums[val]));
+	}
+	case CTR_CONFIG_TYPE_STRING:
+		return zcbor_tstr_encode_ptr(zs, item->variable,
+					     strnlen(item->variable, item->size));
+
+	case CTR_CONFIG_TYPE_HEX:
+		return zcbor_bstr_encode_ptr(zs, item->variable, item->size);
+	}
+
+	return false;
+}
+
+struct encode_ctx {
+	zcbor_state_t *zs;
+	const struct ctr_cloud_snapshot *snapshot;
+	const struct ctr_cloud_snapshot *base;
+	int index;
+	bool is_open;
+	char module[MODULE_MAX_LEN];
+};
+
+static int encode_cb(const struct ctr_config_item *items, int nitems, void *user_data)
+{
+	struct encode_ctx *ctx = user_data;
+
+	for (int i = 0; i < nitems; i++, ctx->index++) {
+		/* Registered after the snapshot was taken */
+		if (ctx->index >= ctx->snapshot->count) {
+			return -EAGAIN;
+		}
+
+		uint32_t digest = ctx->snapshot->digests[ctx->index];
+
+		if (ctx->base && ctx->base->digests[ctx->index] == digest) {
+			continue;
+		}
+
+		char module[MODULE_MAX_LEN];
+		get_module(&items[i], module);
+
+		/* Module maps are opened lazily, so unchanged modules are left out of a delta */
+		if (!ctx->is_open || strcmp(module, ctx->module)) {
+			if (ctx->is_open &&
+			    !zcbor_map_end_encode(ctx->zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH)) {
+				return -ENOSPC;
+			}
+
+			if (!zcbor_tstr_encode_ptr(ctx->zs, module, strlen(module)) ||
+			    !zcbor_map_start_encode(ctx->zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH)) {
+				return -ENOSPC;
+			}
+
+			strcpy(ctx->module, module);
+			ctx->is_open = true;
+		}
+
+		if (!encode_item(ctx->zs, &items[i])) {
+			return -ENOSPC;
+		}
+	}
+
+	return 0;
+}
+
+int ctr_cloud_snapshot_encode(zcbor_state_t *zs, const struct ctr_cloud_snapshot *snapshot,
+			      const struct ctr_cloud_snapshot *base)
+{
+	int ret;
+
+	if (base && !ctr_cloud_snapshot_is_delta_base(snapshot, base)) {
+		LOG_ERR("Incompatible base snapshot");
+		return -EINVAL;
+	}
+
+	struct encode_ctx ctx = {
+		.zs = zs,
+		.snapshot = snapshot,
+		.base = base,
+	};
+
+	if (!zcbor_map_start_encode(zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH)) {
+		return -ENOSPC;
+	}
+
+	ret = ctr_config_foreach_items(encode_cb, &ctx);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_foreach_items` failed: %d", ret);
+		return ret;
+	}
+
+	if (ctx.index != snapshot->count) {
+		LOG_ERR("Items changed since the snapshot was taken");
+		return -EAGAIN;
+	}
+
+	if (ctx.is_open && !zcbor_map_end_encode(zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH)) {
+		return -ENOSPC;
+	}
+
+	if (!zcbor_map_end_encode(zs, ZCBOR_VALUE_IS_INDEFINITE_LENGTH)) {
+		return -ENOSPC;
+	}
+
+	return 0;
+}
+
+struct find_ctx {
+	const struct zcbor_string *module;
+	const struct zcbor_string *name;
+	const struct ctr_config_item *item;
+};
+
+static bool zstr_equal(const struct zcbor_string *zstr, const char *str)
+{
+	return zstr->len == strlen(str) && !memcmp(zstr->value, str, zstr->len);
+}
+
+static int find_cb(const struct ctr_config_item *items, int nitems, void *user_data)
+{
+	struct find_ctx *ctx = user_data;
+
+	for (int i = 0; i < nitems; i++) {
+		char module[MODULE_MAX_LEN];
+		get_module(&items[i], module);
+
+		if (zstr_equal(ctx->module, module) && zstr_equal(ctx->name, items[i].name)) {
+			ctx->item = &items[i];
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int decode_item(zcbor_state_t *zs, const struct ctr_config_item *item)
+{
+	struct zcbor_string zstr;
+
+	switch (item->type) {
+	case CTR_CONFIG_TYPE_INT: {
+		int32_t val;
+		if (!zcbor_int32_decode(zs, &val)) {
+			return -EBADMSG;
+		}
+
+		if (val < item->min || val > item->max) {
+			return -ERANGE;
+		}
+
+		*(int *)item->variable = val;
+		return 0;
+	}
+	case CTR_CONFIG_TYPE_FLOAT: {
+		float val;
+		if (!zcbor_float16_32_decode(zs, &val)) {
+			return -EBADMSG;
+		}
+
+		if (val < item->min || val > item->max) {
+			return -ERANGE;
+		}
+
+		*(float *)item->variable = val;
+		return 0;
+	}
+	case CTR_CONFIG_TYPE_BOOL:
+		if (!zcbor_bool_decode(zs, (bool *)item->variable)) {
+			return -EBADMSG;
+		}
+
+		return 0;
+
+	case CTR_CONFIG_TYPE_ENUM:
+		if (!zcbor_tstr_decode(zs, &zstr)) {
+			return -EBADMSG;
+		}
+
+		for (int32_t i = 0; i < item->max; i++) {
+			if (item->enums[i][0] && zstr_equal(&zstr, item->enums[i])) {
+				memcpy(item->variable, &i, item->size);
+				return 0;
+			}
+		}
+
+		return -EINVAL;
+
+	case CTR_CONFIG_TYPE_STRING: {
+		if (!zcbor_tstr_decode(zs, &zstr)) {
+			return -EBADMSG;
+		}
+
+		if (zstr.len + 1 > item->size) {
+			return -ERANGE;
+		}
+
+		char *str = item->variable;
+
+		/* The parse callbacks validate composite values (e.g. the LTE bands) */
+		if (item->parse_cb) {
+			static char buf[CONFIG_SHELL_CMD_BUFF_SIZE];
+
+			if (zstr.len + 1 > sizeof(buf)) {
+				return -ERANGE;
+			}
+
+			memcpy(buf, zstr.value, zstr.len);
+			buf[zstr.len] = '\0';
+
+			return item->parse_cb(shell_backend_dummy_get_ptr(), buf, item);
+		}
+
+		memcpy(str, zstr.value, zstr.len);
+		str[zstr.len] = '\0';
+		return 0;
+	}
+	case CTR_CONFIG_TYPE_HEX:
+		if (!zcbor_bstr_decode(zs, &zstr)) {
+			return -EBADMSG;
+		}
+
+		if (zstr.len != item->size) {
+			return -ERANGE;
+		}
+
+		memcpy(item->variable, zstr.value, zstr.len);
+		return 0;
+	}
+
+	return -EINVAL;
+}
+
+int ctr_cloud_snapshot_decode(zcbor_state_t *zs)
+{
+	int ret;
+
+	if (!zcbor_map_start_decode(zs)) {
+		return -EBADMSG;
+	}
+
+	struct zcbor_string module;
+	struct zcbor_string name;
+
+	while (1) {
+		if (!zcbor_tstr_decode(zs, &module)) {
+			break;
+		}
+
+		if (!zcbor_map_start_decode(zs)) {
+			return -EBADMSG;
+		}
+
+		while (1) {
+			if (!zcbor_tstr_decode(zs, &name)) {
+				break;
+			}
+
+			struct find_ctx ctx = {
+				.module = &module,
+				.name = &name,
+			};
+
+			ctr_config_foreach_items(find_cb, &ctx);
+
+			if (!ctx.item) {
+				LOG_WRN("Skipping unknown item: %.*s/%.*s", (int)module.len,
+					module.value, (int)name.len, name.value);
+
+				if (!zcbor_any_skip(zs, NULL)) {
+					return -EBADMSG;
+				}
+
+				continue;
+			}
+
+			ret = decode_item(zs, ctx.item);
+			if (ret) {
+				LOG_ERR("Invalid value of item: %s/%s (%d)", ctx.item->module,
+					ctx.item->name, ret);
+				return ret;
+			}
+		}
+
+		if (!zcbor_map_end_decode(zs)) {
+			return -EBADMSG;
+		}
+	}
+
+	if (!zcbor_map_end_decode(zs)) {
+		return -EBADMSG;
+	}
+
+	return 0;
+}
+
+int ctr_cloud_snapshot_load(struct ctr_cloud_snapshot *snapshot)
+{
+	int ret;
+
+	memset(snapshot, 0, sizeof(*snapshot));
+
+	ret = ctr_cloud_util_get_config_snapshot(snapshot, sizeof(*snapshot));
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_util_get_config_snapshot` failed: %d", ret);
+		memset(snapshot, 0, sizeof(*snapshot));
+		return ret;
+	}
+
+	if (snapshot->count > ARRAY_SIZE(snapshot->digests)) {
+		LOG_WRN("Discarding stored snapshot with %u items", snapshot->count);
+		memset(snapshot, 0, sizeof(*snapshot));
+	}
+
+	return 0;
+}
+
+int ctr_cloud_snapshot_save(const struct ctr_cloud_snapshot *snapshot)
+{
+	int ret;
+
+	/* Only the used digests are stored */
+	ret = ctr_cloud_util_save_config_snapshot(
+		snapshot, SNAPSHOT_HEADER_SIZE + snapshot->count * sizeof(snapshot->digests[0]));
+	if (ret) {
+		LOG_ERR("Call `ctr_cloud_util_save_config_snapshot` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_CLOUD_SNAPSHOT_H_
+#define CHESTER_SUBSYS_CTR_CLOUD_SNAPSHOT_H_
+
+/* CHESTER includes */
+#include <zcbor_common.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Typed copy of the registered ctr_config item tables - one CRC32 digest per item (module, name,
+ * type and value) is kept instead of the values, so the snapshot of the last acknowledged upload
+ * can be persisted and compared against the current configuration to find the changed keys.
+ */
+struct ctr_cloud_snapshot {
+	/* Folded SHA-256 of the digests, identifies the snapshot on the server */
+	uint64_t hash;
+	/* CRC32 of the item keys and types - deltas are only valid within the same layout */
+	uint32_t layout;
+	uint16_t count;
+	uint32_t digests[CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT_ITEMS];
+};
+
+/* Returns -ENOSPC when the items do not fit into CONFIG_CTR_CLOUD_CONFIG_SNAPSHOT_ITEMS */
+int ctr_cloud_snapshot_take(struct ctr_cloud_snapshot *snapshot);
+
+/* True when the snapshot can be sent as a delta against the base */
+bool ctr_cloud_snapshot_is_delta_base(const struct ctr_cloud_snapshot *snapshot,
+				      const struct ctr_cloud_snapshot *base);
+
+/**
+ * Encodes the configuration as a map of modules, each a map of item names to typed values (INT as
+ * integer, FLOAT as float32, BOOL as boolean, ENUM as its name, STRING as text and HEX as bytes).
+ * With the base set, only the items whose digest differs from it are encoded.
+ */
+int ctr_cloud_snapshot_encode(zcbor_state_t *zs, const struct ctr_cloud_snapshot *snapshot,
+			      const struct ctr_cloud_snapshot *base);
+
+/**
+ * Decodes a (partial) map produced by ctr_cloud_snapshot_encode() and writes the values into the
+ * item variables - unknown keys are skipped, values out of the item range are rejected
+ */
+int ctr_cloud_snapshot_decode(zcbor_state_t *zs);
+
+/* Persistence of the last acknowledged snapshot, a missing one loads with zero count */
+int ctr_cloud_snapshot_load(struct ctr_cloud_snapshot *snapshot);
+int ctr_cloud_snapshot_save(const struct ctr_cloud_snapshot *snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_CLOUD_SNAPSHOT_H_ */
@@ -25,8 +25,8 @@ extern "C" {
  */
 
 /* Backend-specific message identifier, opaque to the caller (LittleFS
- * backend: UTC timestamp in milliseconds; a future flash backend may use
- * e.g. a record address). */
+ * backend: UTC timestamp in milliseconds; log backend: message sequence
+ * number). */
 typedef uint64_t ctr_cloud_spool_id;
 
 /* Store one message frame (incl. the protocol header). Drops the oldest
@@ -39,6 +39,10 @@ int ctr_cloud_spool_save(const void *buf, size_t len, ctr_cloud_spool_id *id);
  * is empty, negative on error. */
 int ctr_cloud_spool_peek(ctr_cloud_spool_id *id);
 
+/* Find the oldest stored message newer than `id`. Returns 0 when found, 1
+ * when there is none, negative on error. */
+int ctr_cloud_spool_next(ctr_cloud_spool_id id, ctr_cloud_spool_id *next);
+
 /* Append the message content at the buffer's current position (the buffer
  * is NOT reset - the caller may pre-fill it, e.g. with a frame header). */
 int ctr_cloud_spool_load(ctr_cloud_spool_id id, struct ctr_buf *buf);
@@ -46,6 +50,12 @@ int ctr_cloud_spool_delete(ctr_cloud_spool_id id);
 int ctr_cloud_spool_count(int *count);
 int ctr_cloud_spool_clear(void);
 
+#if defined(CONFIG_ZTEST)
+/* Drop the in-RAM state as on reset, the next call rebuilds it from storage
+ * (log backend only). */
+void ctr_cloud_spool_reload(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
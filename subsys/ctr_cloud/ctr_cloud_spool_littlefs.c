@@ -172,7 +172,8 @@ int ctr_cloud_spool_save(const void *buf, size_t len, ctr_cloud_spool_id *id)
 	return 0;
 }
 
-int ctr_cloud_spool_peek(ctr_cloud_spool_id *id)
+/* Finds the oldest message newer than `after` (NULL = any message) */
+static int find_oldest(const char *after, ctr_cloud_spool_id *id)
 {
 	int ret;
 	struct fs_dir_t dir;
@@ -201,6 +202,10 @@ int ctr_cloud_spool_peek(ctr_cloud_spool_id *id)
 			continue;
 		}
 
+		if (after && strcmp(entry.name, after) <= 0) {
+			continue;
+		}
+
 		/* Names are timestamps - lexicographic minimum is the oldest
 		 * message (readdir order is not sorted) */
 		if (!found || strcmp(entry.name, oldest) < 0) {
@@ -219,6 +224,19 @@ int ctr_cloud_spool_peek(ctr_cloud_spool_id *id)
 	return 1;
 }
 
+int ctr_cloud_spool_peek(ctr_cloud_spool_id *id)
+{
+	return find_oldest(NULL, id);
+}
+
+int ctr_cloud_spool_next(ctr_cloud_spool_id id, ctr_cloud_spool_id *next)
+{
+	char name[FILENAME_SIZE];
+	make_filename(id, name, sizeof(name));
+
+	return find_oldest(name, next);
+}
+
 int ctr_cloud_spool_load(ctr_cloud_spool_id id, struct ctr_buf *buf)
 {
 	int ret;
@@ -0,0 +1,1019 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_cloud_config.h"
+#include "ctr_cloud_spool.h"
+
+/* CHESTER includes */
+#include <chester/ctr_buf.h>
+
+/* Zephyr includes */
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(ctr_cloud_spool, CONFIG_CTR_CLOUD_LOG_LEVEL);
+
+/*
+ * Log-structured spool backend. Messages are appended to segment files
+ * named by a hexadecimal sequence number. Every record starts with a header:
+ *
+ *   type (u8) | reserved (u8) | length (u16 le) | id (u32 le) | crc (u32 le)
+ *
+ * The CRC-32 covers the header fields before it and the payload. On replay,
+ * a segment is truncated at the first record that does not fit into the file
+ * or fails the CRC check (e.g. a write torn by power loss).
+ *
+ * A data record carries the message as payload, a delete record carries a
+ * batch of deleted message identifiers (u32 le each). The message identifier
+ * is a sequence number. Segments are only removed oldest-first, so a delete
+ * record never outlives the data record it refers to.
+ *
+ * The index is rebuilt from the segments on first use and kept in RAM; a
+ * message is stored in the slot given by its identifier modulo the index
+ * size (identifiers of occupied slots are skipped on save).
+ */
+
+#define DIR_SPOOL "/lfs1/spool-log"
+
+#define RECORD_TYPE_DATA   0xd1
+#define RECORD_TYPE_DELETE 0xd2
+
+#define HEADER_SIZE 12
+
+#define INDEX_SIZE   CONFIG_CTR_CLOUD_SPOOL_LOG_INDEX_SIZE
+#define SEGMENTS     CONFIG_CTR_CLOUD_SPOOL_LOG_SEGMENTS
+#define SEGMENT_SIZE CONFIG_CTR_CLOUD_SPOOL_LOG_SEGMENT_SIZE
+#define DELETE_BATCH CONFIG_CTR_CLOUD_SPOOL_LOG_DELETE_BATCH
+
+struct segment {
+	uint32_t seq;
+	uint32_t size;
+	int live;
+};
+
+struct slot {
+	uint32_t id;
+	uint32_t seq;
+	uint32_t offset;
+	uint16_t len;
+	bool live;
+};
+
+static K_MUTEX_DEFINE(m_lock);
+
+static bool m_ready;
+
+/* Ordered oldest to newest - the last one is the active (appended) segment */
+static struct segment m_segments[SEGMENTS];
+static int m_segment_count;
+
+static struct fs_file_t m_file;
+static bool m_file_open;
+
+static struct slot m_index[INDEX_SIZE];
+static uint32_t m_head_id;
+static uint32_t m_next_id;
+static int m_count;
+
+static uint32_t m_pending[DELETE_BATCH];
+static int m_pending_count;
+
+static void make_path(uint32_t seq, char *path, size_t path_size)
+{
+	snprintf(path, path_size, DIR_SPOOL "/%08x", seq);
+}
+
+static struct slot *get_slot(uint32_t id)
+{
+	struct slot *slot = &m_index[id % INDEX_SIZE];
+
+	return slot->live && slot->id == id ? slot : NULL;
+}
+
+static struct segment *get_segment(uint32_t seq)
+{
+	for (int i = 0; i < m_segment_count; i++) {
+		if (m_segments[i].seq == seq) {
+			return &m_segments[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void drop_slot(struct slot *slot)
+{
+	struct segment *segment = get_segment(slot->seq);
+	if (segment) {
+		segment->live--;
+	}
+
+	slot->live = false;
+	m_count--;
+}
+
+static int ensure_dir(void)
+{
+	int ret;
+	struct fs_dirent entry;
+
+	ret = fs_stat(DIR_SPOOL, &entry);
+	if (!ret && entry.type == FS_DIR_ENTRY_DIR) {
+		return 0;
+	}
+
+	ret = fs_mkdir(DIR_SPOOL);
+	if (ret) {
+		LOG_ERR("Call `fs_mkdir` failed: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Created directory " DIR_SPOOL);
+
+	return 0;
+}
+
+static int write_all(const void *buf, size_t len)
+{
+	ssize_t ret = fs_write(&m_file, buf, len);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_write` failed: %d", (int)ret);
+		return ret;
+	}
+
+	if ((size_t)ret < len) {
+		LOG_ERR("Incomplete write (%d of %u bytes)", (int)ret, (unsigned int)len);
+		return -ENOSPC;
+	}
+
+	m_segments[m_segment_count - 1].size += len;
+
+	return 0;
+}
+
+static int write_record(uint8_t type, uint32_t id, const void *payload, uint16_t len)
+{
+	int ret;
+
+	uint8_t header[HEADER_SIZE] = {type, 0};
+
+	sys_put_le16(len, &header[2]);
+	sys_put_le32(id, &header[4]);
+
+	uint32_t crc = crc32_ieee(header, HEADER_SIZE - sizeof(uint32_t));
+	crc = crc32_ieee_update(crc, payload, len);
+	sys_put_le32(crc, &header[8]);
+
+	ret = write_all(header, sizeof(header));
+	if (ret) {
+		return ret;
+	}
+
+	return write_all(payload, len);
+}
+
+/* Appends the pending deletions to the active segment (not synced) */
+static int write_pending(void)
+{
+	int ret;
+
+	if (!m_pending_count) {
+		return 0;
+	}
+
+	uint8_t ids[DELETE_BATCH * sizeof(uint32_t)];
+
+	for (int i = 0; i < m_pending_count; i++) {
+		sys_put_le32(m_pending[i], &ids[i * sizeof(uint32_t)]);
+	}
+
+	size_t len = m_pending_count * sizeof(uint32_t);
+
+	ret = write_record(RECORD_TYPE_DELETE, 0, ids, len);
+	if (ret) {
+		return ret;
+	}
+
+	m_pending_count = 0;
+
+	return 0;
+}
+
+static void close_active(void)
+{
+	if (m_file_open) {
+		fs_close(&m_file);
+		m_file_open = false;
+	}
+}
+
+static int remove_segment(void)
+{
+	int ret;
+
+	char path[32];
+	make_path(m_segments[0].seq, path, sizeof(path));
+
+	if (m_segment_count == 1) {
+		close_active();
+	}
+
+	ret = fs_unlink(path);
+	if (ret && ret != -ENOENT) {
+		LOG_ERR("Call `fs_unlink` failed: %d", ret);
+		return ret;
+	}
+
+	memmove(&m_segments[0], &m_segments[1], (m_segment_count - 1) * sizeof(m_segments[0]));
+	m_segment_count--;
+
+	/* No data record left that a pending deletion could refer to */
+	if (!m_segment_count) {
+		m_pending_count = 0;
+	}
+
+	LOG_DBG("Removed segment %s", path);
+
+	return 0;
+}
+
+/* Removes emptied segments oldest-first; the active segment is kept until it is full */
+static int remove_empty_segments(void)
+{
+	int ret;
+
+	while (m_segment_count && !m_segments[0].live) {
+		if (m_segment_count == 1 && m_file_open && m_segments[0].size < SEGMENT_SIZE) {
+			break;
+		}
+
+		ret = remove_segment();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int open_segment(void)
+{
+	int ret;
+
+	if (m_segment_count == SEGMENTS) {
+		uint32_t seq = m_segments[0].seq;
+
+		for (int i = 0; i < INDEX_SIZE; i++) {
+			if (m_index[i].live && m_index[i].seq == seq) {
+				LOG_WRN("Spool full - dropped oldest message: %u", m_index[i].id);
+				drop_slot(&m_index[i]);
+			}
+		}
+
+		ret = remove_segment();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	uint32_t seq = m_segment_count ? m_segments[m_segment_count - 1].seq + 1 : 0;
+
+	char path[32];
+	make_path(seq, path, sizeof(path));
+
+	fs_file_t_init(&m_file);
+
+	ret = fs_open(&m_file, path, FS_O_CREATE | FS_O_WRITE | FS_O_APPEND);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_open` failed: %d", ret);
+		return ret;
+	}
+
+	m_file_open = true;
+
+	m_segments[m_segment_count++] = (struct segment){.seq = seq};
+
+	LOG_DBG("Opened segment %s", path);
+
+	return 0;
+}
+
+static int replay_delete(struct fs_file_t *file, size_t len)
+{
+	int ret;
+
+	uint8_t buf[4 * sizeof(uint32_t)];
+
+	while (len >= sizeof(uint32_t)) {
+		size_t chunk = MIN(len, sizeof(buf)) & ~(sizeof(uint32_t) - 1);
+
+		ret = fs_read(file, buf, chunk);
+		if (ret != chunk) {
+			return ret < 0 ? ret : -EIO;
+		}
+
+		for (size_t i = 0; i < chunk; i += sizeof(uint32_t)) {
+			uint32_t id = sys_get_le32(&buf[i]);
+
+			struct slot *slot = get_slot(id);
+			if (slot) {
+				drop_slot(slot);
+			}
+
+			m_next_id = MAX(m_next_id, id + 1);
+		}
+
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+/* Checks the payload against the record CRC and rewinds to its start */
+static int check_payload(struct fs_file_t *file, const uint8_t *header, size_t len)
+{
+	int ret;
+
+	uint8_t buf[64];
+	uint32_t crc = crc32_ieee(header, HEADER_SIZE - sizeof(uint32_t));
+
+	for (size_t pos = 0; pos < len;) {
+		size_t chunk = MIN(len - pos, sizeof(buf));
+
+		ret = fs_read(file, buf, chunk);
+		if (ret != chunk) {
+			return ret < 0 ? ret : -EIO;
+		}
+
+		crc = crc32_ieee_update(crc, buf, chunk);
+		pos += chunk;
+	}
+
+	if (crc != sys_get_le32(&header[8])) {
+		return -EBADMSG;
+	}
+
+	return fs_seek(file, -(off_t)len, FS_SEEK_CUR);
+}
+
+static int truncate_segment(const char *path, uint32_t size)
+{
+	int ret;
+	struct fs_file_t file;
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_WRITE);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_open` failed: %d", ret);
+		return ret;
+	}
+
+	ret = fs_truncate(&file, size);
+	if (ret) {
+		LOG_ERR("Call `fs_truncate` failed: %d", ret);
+	}
+
+	fs_close(&file);
+
+	return ret;
+}
+
+static int replay_segment(struct segment *segment)
+{
+	int ret;
+	struct fs_file_t file;
+	struct fs_dirent entry;
+
+	char path[32];
+	make_path(segment->seq, path, sizeof(path));
+
+	ret = fs_stat(path, &entry);
+	if (ret) {
+		LOG_ERR("Call `fs_stat` failed: %d", ret);
+		return ret;
+	}
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_READ);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_open` failed: %d", ret);
+		return ret;
+	}
+
+	for (;;) {
+		uint8_t header[HEADER_SIZE];
+
+		ret = fs_read(&file, header, sizeof(header));
+		if (ret != sizeof(header)) {
+			break;
+		}
+
+		uint8_t type = header[0];
+		uint16_t len = sys_get_le16(&header[2]);
+		uint32_t id = sys_get_le32(&header[4]);
+
+		if (segment->size + HEADER_SIZE + len > entry.size) {
+			LOG_WRN("Incomplete record in %s", path);
+			break;
+		}
+
+		ret = check_payload(&file, header, len);
+		if (ret) {
+			LOG_WRN("Corrupted record in %s: %d", path, ret);
+			break;
+		}
+
+		if (type == RECORD_TYPE_DATA) {
+			struct slot *slot = &m_index[id % INDEX_SIZE];
+			if (slot->live) {
+				LOG_WRN("Index collision - dropped message: %u", slot->id);
+				drop_slot(slot);
+			}
+
+			*slot = (struct slot){
+				.id = id,
+				.seq = segment->seq,
+				.offset = segment->size + HEADER_SIZE,
+				.len = len,
+				.live = true,
+			};
+
+			segment->live++;
+			m_count++;
+			m_next_id = MAX(m_next_id, id + 1);
+
+			ret = fs_seek(&file, len, FS_SEEK_CUR);
+		} else if (type == RECORD_TYPE_DELETE) {
+			ret = replay_delete(&file, len);
+		} else {
+			LOG_WRN("Unknown record type 0x%02x in %s", type, path);
+			break;
+		}
+
+		if (ret) {
+			LOG_WRN("Unreadable record in %s: %d", path, ret);
+			break;
+		}
+
+		segment->size += HEADER_SIZE + len;
+	}
+
+	fs_close(&file);
+
+	/* Drop everything behind the last valid record */
+	if (segment->size < entry.size) {
+		LOG_WRN("Truncating %s to %u bytes (was %u)", path, segment->size,
+			(unsigned int)entry.size);
+
+		/* Not fatal - replayed segments are never appended to */
+		truncate_segment(path, segment->size);
+	}
+
+	return 0;
+}
+
+static int compare_segments(const void *a, const void *b)
+{
+	uint32_t seq_a = ((const struct segment *)a)->seq;
+	uint32_t seq_b = ((const struct segment *)b)->seq;
+
+	return seq_a < seq_b ? -1 : seq_a > seq_b;
+}
+
+static int clear_dir(void)
+{
+	int ret;
+	struct fs_dir_t dir;
+	struct fs_dirent entry;
+
+	fs_dir_t_init(&dir);
+
+	ret = fs_opendir(&dir, DIR_SPOOL);
+	if (ret == -ENOENT) {
+		return 0;
+	} else if (ret < 0) {
+		LOG_ERR("Call `fs_opendir` failed: %d", ret);
+		return ret;
+	}
+
+	while (!fs_readdir(&dir, &entry) && entry.name[0]) {
+		if (entry.type != FS_DIR_ENTRY_FILE) {
+			continue;
+		}
+
+		char path[64];
+		snprintf(path, sizeof(path), DIR_SPOOL "/%.48s", entry.name);
+
+		ret = fs_unlink(path);
+		if (ret < 0) {
+			LOG_ERR("Call `fs_unlink` failed: %d", ret);
+			fs_closedir(&dir);
+			return ret;
+		}
+	}
+
+	fs_closedir(&dir);
+
+	return 0;
+}
+
+static int scan_dir(void)
+{
+	int ret;
+	struct fs_dir_t dir;
+	struct fs_dirent entry;
+	bool overflow = false;
+
+	fs_dir_t_init(&dir);
+
+	ret = fs_opendir(&dir, DIR_SPOOL);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_opendir` failed: %d", ret);
+		return ret;
+	}
+
+	while (!fs_readdir(&dir, &entry) && entry.name[0]) {
+		if (entry.type != FS_DIR_ENTRY_FILE) {
+			continue;
+		}
+
+		char *end;
+		unsigned long seq = strtoul(entry.name, &end, 16);
+		if (*end || end == entry.name) {
+			LOG_WRN("Skipping foreign file: %s", entry.name);
+			continue;
+		}
+
+		if (m_segment_count == SEGMENTS) {
+			overflow = true;
+			break;
+		}
+
+		m_segments[m_segment_count++] = (struct segment){.seq = seq};
+	}
+
+	fs_closedir(&dir);
+
+	if (overflow) {
+		LOG_WRN("Too many segments - clearing spool");
+		m_segment_count = 0;
+		return clear_dir();
+	}
+
+	qsort(m_segments, m_segment_count, sizeof(m_segments[0]), compare_segments);
+
+	return 0;
+}
+
+static int ensure_ready(void)
+{
+	int ret;
+
+	if (m_ready) {
+		return 0;
+	}
+
+	ret = ensure_dir();
+	if (ret) {
+		return ret;
+	}
+
+	ret = scan_dir();
+	if (ret) {
+		return ret;
+	}
+
+	for (int i = 0; i < m_segment_count; i++) {
+		ret = replay_segment(&m_segments[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	m_head_id = m_next_id;
+
+	for (int i = 0; i < INDEX_SIZE; i++) {
+		if (m_index[i].live && m_next_id - m_index[i].id > m_next_id - m_head_id) {
+			m_head_id = m_index[i].id;
+		}
+	}
+
+	/* Segments replayed at boot are never appended to - a new one is opened on save */
+	ret = remove_empty_segments();
+	if (ret) {
+		return ret;
+	}
+
+	m_ready = true;
+
+	LOG_INF("Spool ready (messages: %d segments: %d)", m_count, m_segment_count);
+
+	return 0;
+}
+
+static int peek(uint32_t *id)
+{
+	while (m_head_id != m_next_id && !get_slot(m_head_id)) {
+		m_head_id++;
+	}
+
+	if (m_head_id == m_next_id) {
+		return 1;
+	}
+
+	*id = m_head_id;
+
+	return 0;
+}
+
+static int next(uint32_t id, uint32_t *next_id)
+{
+	if (!m_count) {
+		return 1;
+	}
+
+	/* Nothing older than the head is stored - start from there when behind it */
+	if (m_next_id - id > m_next_id - m_head_id) {
+		id = m_head_id - 1;
+	}
+
+	while (++id != m_next_id) {
+		if (get_slot(id)) {
+			*next_id = id;
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int delete(uint32_t id)
+{
+	int ret;
+
+	struct slot *slot = get_slot(id);
+	if (!slot) {
+		return -ENOENT;
+	}
+
+	drop_slot(slot);
+
+	m_pending[m_pending_count++] = id;
+
+	if (m_pending_count == DELETE_BATCH) {
+		if (!m_file_open) {
+			ret = open_segment();
+			if (ret) {
+				return ret;
+			}
+		}
+
+		ret = write_pending();
+		if (!ret) {
+			ret = fs_sync(&m_file);
+			if (ret) {
+				LOG_ERR("Call `fs_sync` failed: %d", ret);
+			}
+		}
+
+		if (ret) {
+			/* Deleted in RAM anyway - the message may only come back after reset */
+			m_pending_count = 0;
+			close_active();
+			return ret;
+		}
+	}
+
+	return remove_empty_segments();
+}
+
+static int save(const void *buf, size_t len, uint32_t *id)
+{
+	int ret;
+
+	if (len > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	/* Spool full - drop the oldest message(s) to make room for the newest */
+	while (m_count >= MIN(g_ctr_cloud_config.spool_size, INDEX_SIZE)) {
+		uint32_t oldest;
+		ret = peek(&oldest);
+		if (ret) {
+			break;
+		}
+
+		ret = delete(oldest);
+		if (ret) {
+			return ret;
+		}
+
+		LOG_WRN("Spool full - dropped oldest message: %u", oldest);
+	}
+
+	if (m_file_open && m_segments[m_segment_count - 1].size >= SEGMENT_SIZE) {
+		close_active();
+
+		ret = remove_empty_segments();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (!m_file_open) {
+		ret = open_segment();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	while (m_index[m_next_id % INDEX_SIZE].live) {
+		m_next_id++;
+	}
+
+	struct segment *segment = &m_segments[m_segment_count - 1];
+
+	ret = write_pending();
+
+	uint32_t offset = segment->size + HEADER_SIZE;
+
+	if (!ret) {
+		ret = write_record(RECORD_TYPE_DATA, m_next_id, buf, len);
+	}
+
+	if (!ret) {
+		ret = fs_sync(&m_file);
+		if (ret) {
+			LOG_ERR("Call `fs_sync` failed: %d", ret);
+		}
+	}
+
+	if (ret) {
+		/* Never append behind a partially written record */
+		close_active();
+		return ret;
+	}
+
+	m_index[m_next_id % INDEX_SIZE] = (struct slot){
+		.id = m_next_id,
+		.seq = segment->seq,
+		.offset = offset,
+		.len = len,
+		.live = true,
+	};
+
+	if (!m_count) {
+		m_head_id = m_next_id;
+	}
+
+	segment->live++;
+	m_count++;
+
+	*id = m_next_id++;
+
+	return 0;
+}
+
+static int load(uint32_t id, struct ctr_buf *buf)
+{
+	int ret;
+	struct fs_file_t file;
+
+	struct slot *slot = get_slot(id);
+	if (!slot) {
+		return -ENOENT;
+	}
+
+	if (ctr_buf_get_free(buf) < slot->len) {
+		return -ENOSPC;
+	}
+
+	char path[32];
+	make_path(slot->seq, path, sizeof(path));
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_READ);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_open` failed: %d", ret);
+		return ret;
+	}
+
+	ret = fs_seek(&file, slot->offset, FS_SEEK_SET);
+	if (ret) {
+		LOG_ERR("Call `fs_seek` failed: %d", ret);
+		fs_close(&file);
+		return ret;
+	}
+
+	size_t used = ctr_buf_get_used(buf);
+
+	ret = fs_read(&file, ctr_buf_get_mem(buf) + used, slot->len);
+	fs_close(&file);
+	if (ret < 0) {
+		LOG_ERR("Call `fs_read` failed: %d", ret);
+		return ret;
+	}
+
+	if (ret != slot->len) {
+		LOG_ERR("Incomplete read (%d of %u bytes)", ret, slot->len);
+		return -EIO;
+	}
+
+	return ctr_buf_seek(buf, used + slot->len);
+}
+
+int ctr_cloud_spool_save(const void *buf, size_t len, ctr_cloud_spool_id *id)
+{
+	int ret;
+
+	if (g_ctr_cloud_config.spool_size <= 0) {
+		LOG_DBG("Spool is disabled (spool-size is 0)");
+		return -ENOSPC;
+	}
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	uint32_t saved_id;
+
+	ret = ensure_ready();
+	if (!ret) {
+		ret = save(buf, len, &saved_id);
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	if (ret) {
+		LOG_ERR("Call `save` failed: %d", ret);
+		return ret;
+	}
+
+	if (id) {
+		*id = saved_id;
+	}
+
+	LOG_INF("Stored %u bytes as message %u", (unsigned int)len, saved_id);
+
+	return 0;
+}
+
+int ctr_cloud_spool_peek(ctr_cloud_spool_id *id)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	uint32_t oldest;
+
+	ret = ensure_ready();
+	if (!ret) {
+		ret = peek(&oldest);
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	if (!ret) {
+		*id = oldest;
+	}
+
+	return ret;
+}
+
+int ctr_cloud_spool_next(ctr_cloud_spool_id id, ctr_cloud_spool_id *next_id)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	uint32_t newer;
+
+	ret = ensure_ready();
+	if (!ret) {
+		ret = next(id, &newer);
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	if (!ret) {
+		*next_id = newer;
+	}
+
+	return ret;
+}
+
+int ctr_cloud_spool_load(ctr_cloud_spool_id id, struct ctr_buf *buf)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	ret = ensure_ready();
+	if (!ret) {
+		ret = load(id, buf);
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	if (ret) {
+		LOG_ERR("Call `load` failed: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Loaded message %llu", id);
+
+	return 0;
+}
+
+int ctr_cloud_spool_delete(ctr_cloud_spool_id id)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	ret = ensure_ready();
+	if (!ret) {
+		ret = delete(id);
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	if (ret) {
+		LOG_ERR("Call `delete` failed: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Deleted message %llu", id);
+
+	return 0;
+}
+
+int ctr_cloud_spool_count(int *count)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	ret = ensure_ready();
+	*count = ret ? 0 : m_count;
+
+	k_mutex_unlock(&m_lock);
+
+	return ret;
+}
+
+#if defined(CONFIG_ZTEST)
+void ctr_cloud_spool_reload(void)
+{
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	close_active();
+
+	memset(m_index, 0, sizeof(m_index));
+	m_segment_count = 0;
+	m_pending_count = 0;
+	m_count = 0;
+	m_head_id = 0;
+	m_next_id = 0;
+	m_ready = false;
+
+	k_mutex_unlock(&m_lock);
+}
+#endif /* defined(CONFIG_ZTEST) */
+
+int ctr_cloud_spool_clear(void)
+{
+	int ret;
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	close_active();
+
+	ret = clear_dir();
+
+	memset(m_index, 0, sizeof(m_index));
+	m_segment_count = 0;
+	m_pending_count = 0;
+	m_count = 0;
+	m_head_id = m_next_id;
+
+	k_mutex_unlock(&m_lock);
+
+	return ret;
+}
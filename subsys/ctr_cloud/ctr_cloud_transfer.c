@@ -39,6 +39,8 @@ CTR_BUF_DEFINE_STATIC(m_buf_1, CTR_CLOUD_PACKET_MAX_SIZE);
 
 static uint16_t m_sequence;
 static uint16_t m_last_recv_sequence;
+static int m_window = 1;
+static bool m_binary;
 
 static uint8_t m_token[16];
 static struct ctr_cloud_packet m_pck_send;
@@ -64,14 +66,21 @@ static int transfer(struct ctr_cloud_packet *pck_send, struct ctr_cloud_packet *
 		return ret;
 	}
 
-	ctr_buf_reset(send_buf);
-	ret = base64_encode(ctr_buf_get_mem(send_buf), ctr_buf_get_free(send_buf), &len,
-			    ctr_buf_get_mem(pck_buf), ctr_buf_get_used(pck_buf));
-	if (ret) {
-		LOG_ERR("Call `base64_encode` failed: %d", ret);
-		return ret;
+	if (m_binary) {
+		/* Packed packet goes to the modem as-is and the response lands directly in the
+		 * other buffer - no encode/decode step */
+		send_buf = pck_buf;
+		recv_buf = &m_buf_1;
+	} else {
+		ctr_buf_reset(send_buf);
+		ret = base64_encode(ctr_buf_get_mem(send_buf), ctr_buf_get_free(send_buf), &len,
+				    ctr_buf_get_mem(pck_buf), ctr_buf_get_used(pck_buf));
+		if (ret) {
+			LOG_ERR("Call `base64_encode` failed: %d", ret);
+			return ret;
+		}
+		ctr_buf_seek(send_buf, len);
 	}
-	ctr_buf_seek(send_buf, len);
 	len = 0;
 
 	LOG_HEXDUMP_INF(ctr_buf_get_mem(send_buf), ctr_buf_get_used(send_buf),
@@ -79,7 +88,7 @@ static int transfer(struct ctr_cloud_packet *pck_send, struct ctr_cloud_packet *
 
 	struct ctr_lte_v2_send_recv_param param = {
 		.rai = rai,
-		.send_as_string = true,
+		.send_as_string = !m_binary,
 		.send_buf = ctr_buf_get_mem(send_buf),
 		.send_len = ctr_buf_get_used(send_buf),
 		.recv_buf = NULL,
@@ -115,17 +124,22 @@ static int transfer(struct ctr_cloud_packet *pck_send, struct ctr_cloud_packet *
 		// LOG_HEXDUMP_INF(ctr_buf_get_mem(recv_buf), ctr_buf_get_used(recv_buf),
 		// 		"Received packet:");
 
-		pck_buf = &m_buf_1;
-		len = 0;
+		if (m_binary) {
+			pck_buf = recv_buf;
+		} else {
+			pck_buf = &m_buf_1;
+			len = 0;
 
-		ctr_buf_reset(pck_buf);
-		ret = base64_decode(ctr_buf_get_mem(pck_buf), ctr_buf_get_free(pck_buf), &len,
-				    ctr_buf_get_mem(recv_buf), ctr_buf_get_used(recv_buf));
-		if (ret) {
-			LOG_ERR("Call `base64_decode` failed: %d", ret);
-			return ret;
+			ctr_buf_reset(pck_buf);
+			ret = base64_decode(ctr_buf_get_mem(pck_buf), ctr_buf_get_free(pck_buf),
+					    &len, ctr_buf_get_mem(recv_buf),
+					    ctr_buf_get_used(recv_buf));
+			if (ret) {
+				LOG_ERR("Call `base64_decode` failed: %d", ret);
+				return ret;
+			}
+			ctr_buf_seek(pck_buf, len);
 		}
-		ctr_buf_seek(pck_buf, len);
 
 		ret = ctr_cloud_packet_unpack(pck_recv, m_token, pck_buf);
 		if (ret) {
@@ -140,6 +154,11 @@ static int transfer(struct ctr_cloud_packet *pck_send, struct ctr_cloud_packet *
 	return 0;
 }
 
+static size_t fragment_size(void)
+{
+	return m_binary ? MAX_DATA_SIZE : MAX_BASE64_DATA_SIZE;
+}
+
 int ctr_cloud_transfer_init(uint32_t serial_number, uint8_t token[16], ctr_cloud_transfer_cb cb)
 {
 	memset(&m_pck_send, 0, sizeof(m_pck_send));
@@ -150,6 +169,8 @@ int ctr_cloud_transfer_init(uint32_t serial_number, uint8_t token[16], ctr_cloud
 
 	m_sequence = 0;
 	m_last_recv_sequence = 0;
+	m_window = 1;
+	m_binary = false;
 
 	m_cb = cb;
 
@@ -158,6 +179,28 @@ int ctr_cloud_transfer_init(uint32_t serial_number, uint8_t token[16], ctr_cloud
 	return 0;
 }
 
+int ctr_cloud_transfer_set_window(int window)
+{
+	if (window < 1) {
+		window = 1;
+	}
+
+	m_window = MIN(window, CONFIG_CTR_CLOUD_TRANSFER_WINDOW);
+
+	LOG_INF("Uplink window: %d", m_window);
+
+	return 0;
+}
+
+int ctr_cloud_transfer_set_binary(bool binary)
+{
+	m_binary = binary;
+
+	LOG_INF("Binary transfer: %s", m_binary ? "yes" : "no");
+
+	return 0;
+}
+
 int ctr_cloud_transfer_wait_for_ready(k_timeout_t timeout)
 {
 	int ret;
@@ -171,6 +214,130 @@ int ctr_cloud_transfer_wait_for_ready(k_timeout_t timeout)
 	return 0;
 }
 
+#if CONFIG_CTR_CLOUD_TRANSFER_WINDOW > 1
+
+/*
+ * Windowed uplink: up to `m_window` fragments are sent back-to-back and only the last one in the
+ * window waits for a response. The server answers with the sequence it expects next - if that
+ * points past the window, everything was received; if it points at a fragment inside the window,
+ * the transfer goes back to that fragment and resends from there.
+ */
+static int uplink_windowed(uint8_t *mem, size_t len, int fragments, bool *has_downlink,
+			   k_timeout_t timeout)
+{
+	int ret;
+	int base = 0;
+	int retries = 0;
+	uint16_t base_sequence = m_sequence;
+	uint16_t sequences[CONFIG_CTR_CLOUD_TRANSFER_WINDOW];
+
+	while (base < fragments) {
+		int count = MIN(m_window, fragments - base);
+		uint16_t sequence = base_sequence;
+
+		LOG_INF("Processing window: %d-%d (%d left)", base, base + count - 1,
+			fragments - base - count);
+
+		for (int i = 0; i < count; i++) {
+			int part = base + i;
+			size_t offset = part * fragment_size();
+			bool last_in_window = i == count - 1;
+
+			m_pck_send.data = mem + offset;
+			m_pck_send.data_len = MIN(len - offset, fragment_size());
+			m_pck_send.sequence = sequence;
+			sequences[i] = sequence;
+			sequence = ctr_cloud_packet_sequence_inc(sequence);
+
+			m_pck_send.flags = 0;
+			if (part == 0) {
+				m_pck_send.flags |= CTR_CLOUD_PACKET_FLAG_FIRST;
+			}
+			if (part == fragments - 1) {
+				m_pck_send.flags |= CTR_CLOUD_PACKET_FLAG_LAST;
+			}
+
+			bool rai = last_in_window && (m_pck_send.flags & CTR_CLOUD_PACKET_FLAG_LAST);
+			ret = transfer(&m_pck_send, last_in_window ? &m_pck_recv : NULL, rai,
+				       timeout);
+			if (ret) {
+				LOG_ERR("Call `transfer` failed: %d", ret);
+				return ret;
+			}
+		}
+
+		if (m_pck_recv.serial_number != m_pck_send.serial_number) {
+			LOG_ERR("Serial number mismatch");
+			return -EREMCHG;
+		}
+
+		if (has_downlink) {
+			*has_downlink = m_pck_recv.flags & CTR_CLOUD_PACKET_FLAG_POLL;
+		}
+
+		if (m_pck_recv.flags & (CTR_CLOUD_PACKET_FLAG_FIRST | CTR_CLOUD_PACKET_FLAG_LAST)) {
+			LOG_ERR("Received unexpected flags");
+			return -EIO;
+		}
+
+		if (m_pck_recv.data_len) {
+			LOG_ERR("Received unexpected data length");
+			return -EIO;
+		}
+
+		if (m_pck_recv.sequence == sequence) {
+			m_last_recv_sequence = m_pck_recv.sequence;
+			base_sequence = ctr_cloud_packet_sequence_inc(sequence);
+			base += count;
+			continue;
+		}
+
+		if (++retries > CONFIG_CTR_CLOUD_TRANSFER_WINDOW_RETRIES) {
+			LOG_ERR("Too many retransmissions");
+			return -EIO;
+		}
+
+		if (m_pck_recv.sequence == 0) {
+			LOG_WRN("Received sequence reset request");
+			base = 0;
+			base_sequence = 0;
+			continue;
+		}
+
+		/* Acknowledgement of the previous window - the window is sent again */
+		if (m_pck_recv.sequence == m_last_recv_sequence) {
+			LOG_WRN("Received repeat response");
+			continue;
+		}
+
+		int gap = -1;
+		for (int i = 0; i < count; i++) {
+			if (sequences[i] == m_pck_recv.sequence) {
+				gap = i;
+				break;
+			}
+		}
+
+		if (gap < 0) {
+			LOG_WRN("Received unexpected sequence expect: %u", sequence);
+			base = 0;
+			base_sequence = 0;
+			continue;
+		}
+
+		LOG_WRN("Received gap at part: %d - retransmitting", base + gap);
+
+		base += gap;
+		base_sequence = sequences[gap];
+	}
+
+	m_sequence = base_sequence;
+
+	return 0;
+}
+
+#endif /* CONFIG_CTR_CLOUD_TRANSFER_WINDOW > 1 */
+
 int ctr_cloud_transfer_uplink(struct ctr_buf *buf, bool *has_downlink, k_timeout_t timeout)
 {
 	int ret = 0;
@@ -184,6 +351,20 @@ int ctr_cloud_transfer_uplink(struct ctr_buf *buf, bool *has_downlink, k_timeout
 		*has_downlink = false;
 	}
 
+#if CONFIG_CTR_CLOUD_TRANSFER_WINDOW > 1
+	if (buf && m_window > 1) {
+		len = ctr_buf_get_used(buf);
+
+		fragments = DIV_ROUND_UP(len, fragment_size());
+
+		if (fragments > 1) {
+			res = uplink_windowed(ctr_buf_get_mem(buf), len, fragments, has_downlink,
+					      timeout);
+			goto exit;
+		}
+	}
+#endif /* CONFIG_CTR_CLOUD_TRANSFER_WINDOW > 1 */
+
 restart:
 	part = 0;
 
@@ -192,17 +373,14 @@ restart:
 		len = ctr_buf_get_used(buf);
 
 		/* calculate number of fragments */
-		fragments = len / MAX_BASE64_DATA_SIZE;
-		if (len % MAX_BASE64_DATA_SIZE) {
-			fragments++;
-		}
+		fragments = DIV_ROUND_UP(len, fragment_size());
 	}
 
 	do {
 		LOG_INF("Processing part: %d (%d left)", part, fragments - part - 1);
 
 		m_pck_send.data = p;
-		m_pck_send.data_len = MIN(len, MAX_BASE64_DATA_SIZE);
+		m_pck_send.data_len = MIN(len, fragment_size());
 		m_pck_send.sequence = m_sequence;
 		m_sequence = ctr_cloud_packet_sequence_inc(m_sequence);
 
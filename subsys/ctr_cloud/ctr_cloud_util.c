@@ -191,6 +191,21 @@ int ctr_cloud_util_delete_firmware_update_id(void)
 	return settings_delete("cloud/firmware/update_id");
 }
 
+int ctr_cloud_util_save_config_snapshot(const void *data, size_t len)
+{
+	return settings_save_one("cloud/config/snapshot", data, len);
+}
+
+int ctr_cloud_util_get_config_snapshot(void *data, size_t len)
+{
+	struct settings_read_callback_params params = {
+		.data = data,
+		.len = len,
+	};
+	return settings_load_subtree_direct("cloud/config/snapshot", settings_read_callback,
+					    &params);
+}
+
 void ctr_cloud_util_adjust_metrics_ts(struct ctr_cloud_metrics *metrics, int64_t offset)
 {
 	if (metrics->uplink_last_ts > 0) {
@@ -211,6 +226,9 @@ void ctr_cloud_util_adjust_metrics_ts(struct ctr_cloud_metrics *metrics, int64_t
 	if (metrics->uplink_data_last_ts > 0) {
 		metrics->uplink_data_last_ts += offset;
 	}
+	if (metrics->uplink_batch_last_ts > 0) {
+		metrics->uplink_batch_last_ts += offset;
+	}
 	if (metrics->downlink_data_last_ts > 0) {
 		metrics->downlink_data_last_ts += offset;
 	}
@@ -35,6 +35,10 @@ int ctr_cloud_util_get_firmware_update_id(ctr_cloud_uuid_t uuid);
 
 int ctr_cloud_util_delete_firmware_update_id(void);
 
+int ctr_cloud_util_save_config_snapshot(const void *data, size_t len);
+
+int ctr_cloud_util_get_config_snapshot(void *data, size_t len);
+
 void ctr_cloud_util_adjust_metrics_ts(struct ctr_cloud_metrics *metrics, int64_t offset);
 
 #ifdef __cplusplus
@@ -24,6 +24,7 @@
 #include <zephyr/settings/settings.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/sys/reboot.h>
 
 /* Standard includes */
@@ -32,6 +33,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(ctr_config, CONFIG_CTR_CONFIG_LOG_LEVEL);
 
@@ -41,7 +43,33 @@ struct show_item {
 	sys_snode_t node;
 };
 
+struct items_item {
+	const struct ctr_config_item *items;
+	int nitems;
+	const char *const *hot;
+	ctr_config_commit_cb commit_cb;
+	bool is_dirty;
+	bool is_partial;
+	sys_snode_t node;
+	/* Digests of the stored values, an item is dirty when its value differs */
+	uint32_t digests[];
+};
+
 static sys_slist_t m_show_list = SYS_SLIST_STATIC_INIT(&m_show_list);
+static sys_slist_t m_items_list = SYS_SLIST_STATIC_INIT(&m_items_list);
+
+/* A cold item was saved, so further hot changes must not be committed before the reboot */
+static bool m_is_reboot_pending;
+
+static void sync_digests(void)
+{
+	struct items_item *item;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		for (int i = 0; i < item->nitems; i++) {
+			item->digests[i] = ctr_config_get_item_digest(&item->items[i]);
+		}
+	}
+}
 
 static int save(bool reboot)
 {
@@ -53,6 +81,8 @@ static int save(bool reboot)
 		return ret;
 	}
 
+	sync_digests();
+
 	if (reboot) {
 		sys_reboot(SYS_REBOOT_COLD);
 	}
@@ -149,6 +179,220 @@ void ctr_config_append_show(const char *name, ctr_config_show_cb cb)
 	sys_slist_append(&m_show_list, &item->node);
 }
 
+void ctr_config_append_items(const struct ctr_config_item *items, int nitems)
+{
+	struct items_item *item = k_malloc(sizeof(*item) + nitems * sizeof(item->digests[0]));
+	if (item == NULL) {
+		LOG_ERR("Call `k_malloc` failed");
+		return;
+	}
+
+	item->items = items;
+	item->nitems = nitems;
+	item->hot = NULL;
+	item->commit_cb = NULL;
+	item->is_dirty = false;
+	item->is_partial = false;
+
+	/* Registered after the settings are loaded, so the values match the storage */
+	for (int i = 0; i < nitems; i++) {
+		item->digests[i] = ctr_config_get_item_digest(&items[i]);
+	}
+
+	sys_slist_append(&m_items_list, &item->node);
+}
+
+int ctr_config_set_hot_items(const struct ctr_config_item *items, const char *const *names,
+			     ctr_config_commit_cb commit_cb)
+{
+	struct items_item *item;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		if (item->items == items) {
+			item->hot = names;
+			item->commit_cb = commit_cb;
+			return 0;
+		}
+	}
+
+	LOG_ERR("Item table not registered");
+
+	return -ENOENT;
+}
+
+int ctr_config_set_items_partial(const struct ctr_config_item *items)
+{
+	struct items_item *item;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		if (item->items == items) {
+			item->is_partial = true;
+			return 0;
+		}
+	}
+
+	LOG_ERR("Item table not registered");
+
+	return -ENOENT;
+}
+
+bool ctr_config_is_items_complete(void)
+{
+	struct show_item *show;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_show_list, show, node) {
+		bool is_found = false;
+
+		struct items_item *item;
+		SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+			if (item->nitems > 0 && strcmp(item->items[0].module, show->name) == 0) {
+				is_found = !item->is_partial;
+				break;
+			}
+		}
+
+		if (!is_found) {
+			LOG_DBG("Module without complete item table: %s", show->name);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool is_hot(const struct items_item *item, const struct ctr_config_item *config_item)
+{
+	if (item->hot == NULL || item->commit_cb == NULL) {
+		return false;
+	}
+
+	for (const char *const *name = item->hot; *name != NULL; name++) {
+		if (strcmp(*name, config_item->name) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int ctr_config_apply(bool reboot, bool *is_reboot_needed)
+{
+	int ret;
+
+	static char key[64];
+	bool is_cold = m_is_reboot_pending;
+
+	/* Changes outside the item tables cannot be detected, so everything is saved for reboot */
+	if (!ctr_config_is_items_complete()) {
+		ret = save(false);
+		if (ret) {
+			LOG_ERR("Call `save` failed: %d", ret);
+			return ret;
+		}
+
+		LOG_INF("Saved all settings (module without complete item table)");
+
+		if (is_reboot_needed) {
+			*is_reboot_needed = true;
+		}
+
+		m_is_reboot_pending = true;
+
+		if (reboot) {
+			sys_reboot(SYS_REBOOT_COLD);
+		}
+
+		return 0;
+	}
+
+	struct items_item *item;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		item->is_dirty = false;
+
+		for (int i = 0; i < item->nitems; i++) {
+			const struct ctr_config_item *config_item = &item->items[i];
+
+			uint32_t digest = ctr_config_get_item_digest(config_item);
+			if (digest == item->digests[i]) {
+				continue;
+			}
+
+			/* Same key and value layout as ctr_config_h_export */
+			snprintf(key, sizeof(key), "%s/%s", config_item->module, config_item->name);
+
+			ret = settings_save_one(key, config_item->variable, config_item->size);
+			if (ret) {
+				LOG_ERR("Call `settings_save_one` failed: %d", ret);
+				return ret;
+			}
+
+			bool hot = is_hot(item, config_item);
+
+			LOG_INF("Saved item: %s (%s)", key, hot ? "hot" : "cold");
+
+			item->digests[i] = digest;
+			item->is_dirty = true;
+
+			if (!hot) {
+				is_cold = true;
+			}
+		}
+	}
+
+	if (is_reboot_needed) {
+		*is_reboot_needed = is_cold;
+	}
+
+	if (is_cold) {
+		m_is_reboot_pending = true;
+
+		if (reboot) {
+			sys_reboot(SYS_REBOOT_COLD);
+		}
+
+		return 0;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		if (!item->is_dirty) {
+			continue;
+		}
+
+		ret = item->commit_cb();
+		if (ret) {
+			LOG_ERR("Call `commit_cb` failed: %d", ret);
+			return ret;
+		}
+
+		item->is_dirty = false;
+	}
+
+	return 0;
+}
+
+uint32_t ctr_config_get_item_digest(const struct ctr_config_item *item)
+{
+	size_t len = item->size;
+
+	if (item->type == CTR_CONFIG_TYPE_STRING) {
+		len = strnlen(item->variable, item->size);
+	}
+
+	return crc32_ieee(item->variable, len);
+}
+
+int ctr_config_foreach_items(ctr_config_items_cb cb, void *user_data)
+{
+	int ret;
+
+	struct items_item *item;
+	SYS_SLIST_FOR_EACH_CONTAINER(&m_items_list, item, node) {
+		ret = cb(item->items, item->nitems, user_data);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 int ctr_config_show_item(const struct shell *shell, const struct ctr_config_item *item)
 {
 	char mod[32];
@@ -559,6 +803,23 @@ static int cmd_save(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_apply(const struct shell *shell, size_t argc, char **argv)
+{
+	int ret;
+
+	bool is_reboot_needed;
+	ret = ctr_config_apply(true, &is_reboot_needed);
+	if (ret) {
+		LOG_ERR("Call `ctr_config_apply` failed: %d", ret);
+		shell_error(shell, "command failed");
+		return ret;
+	}
+
+	shell_print(shell, "applied without reboot");
+
+	return 0;
+}
+
 static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
 {
 	int ret;
@@ -603,6 +864,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	              "Save all configuration.",
 	              cmd_save, 1, 0),
 
+	SHELL_CMD_ARG(apply, NULL,
+	              "Save changed configuration (reboot only if needed).",
+	              cmd_apply, 1, 0),
+
 	SHELL_CMD_ARG(reset, NULL,
 	              "Reset all configuration.",
 	              cmd_reset, 1, 0),
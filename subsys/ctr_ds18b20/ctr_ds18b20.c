@@ -19,13 +19,23 @@
 #include <zephyr/sys/byteorder.h>
 
 /* Standard includes */
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 
 LOG_MODULE_REGISTER(ctr_ds18b20, CONFIG_CTR_DS18B20_LOG_LEVEL);
 
+#define CMD_CONVERT_T       0x44
+#define CMD_READ_SCRATCHPAD 0xbe
+
+#define SCRATCHPAD_SIZE 9
+
+/* Worst case for 12-bit resolution */
+#define CONVERSION_TIME K_MSEC(750)
+
 struct sensor {
 	uint64_t serial_number;
+	struct w1_rom rom;
 	const struct device *dev;
 };
 
@@ -77,6 +87,7 @@ static int scan_callback(struct w1_rom rom, void *user_data)
 		return ret;
 	}
 
+	m_sensors[m_count].rom = rom;
 	m_sensors[m_count++].serial_number = serial_number;
 
 	LOG_DBG("Registered serial number: %llu", serial_number);
@@ -215,3 +226,120 @@ error:
 
 	return res;
 }
+
+static int read_scratchpad(const struct device *dev, int index, float *temperature)
+{
+	int ret;
+
+	const struct w1_slave_config config = {.rom = m_sensors[index].rom};
+
+	ret = w1_reset_select(dev, &config);
+	if (ret) {
+		LOG_WRN("Call `w1_reset_select` failed: %d", ret);
+		return ret;
+	}
+
+	ret = w1_write_byte(dev, CMD_READ_SCRATCHPAD);
+	if (ret) {
+		LOG_WRN("Call `w1_write_byte` failed: %d", ret);
+		return ret;
+	}
+
+	uint8_t buf[SCRATCHPAD_SIZE];
+	ret = w1_read_block(dev, buf, sizeof(buf));
+	if (ret) {
+		LOG_WRN("Call `w1_read_block` failed: %d", ret);
+		return ret;
+	}
+
+	if (w1_crc8(buf, SCRATCHPAD_SIZE - 1) != buf[SCRATCHPAD_SIZE - 1]) {
+		LOG_WRN("CRC mismatch (serial number: %llu)", m_sensors[index].serial_number);
+		return -EIO;
+	}
+
+	/* Bits below the configured resolution are undefined */
+	int resolution = 9 + ((buf[4] >> 5) & 0x03);
+	int16_t raw = sys_get_le16(buf) & ~((1 << (12 - resolution)) - 1);
+
+	*temperature = raw / 16.f;
+
+	return 0;
+}
+
+int ctr_ds18b20_read_all(struct ctr_ds18b20_sample *samples, int max_count)
+{
+	int ret;
+	int res = 0;
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	k_mutex_lock(&m_lock, K_FOREVER);
+
+	static const struct device *dev = DEVICE_DT_GET(DT_NODELABEL(ds2484));
+
+	if (!device_is_ready(dev)) {
+		LOG_ERR("Device not ready");
+		k_mutex_unlock(&m_lock);
+		return -ENODEV;
+	}
+
+	int count = MIN(m_count, max_count);
+
+	if (!count) {
+		k_mutex_unlock(&m_lock);
+		return 0;
+	}
+
+	ret = ctr_w1_acquire(&m_w1, dev);
+	if (ret) {
+		LOG_ERR("Call `ctr_w1_acquire` failed: %d", ret);
+		k_mutex_unlock(&m_lock);
+		return ret;
+	}
+
+	/* All sensors on the bus convert at once */
+	const struct w1_slave_config config = {.overdrive = 0};
+	ret = w1_skip_rom(dev, &config);
+	if (ret) {
+		LOG_ERR("Call `w1_skip_rom` failed: %d", ret);
+		res = ret;
+		goto error;
+	}
+
+	ret = w1_write_byte(dev, CMD_CONVERT_T);
+	if (ret) {
+		LOG_ERR("Call `w1_write_byte` failed: %d", ret);
+		res = ret;
+		goto error;
+	}
+
+	k_sleep(CONVERSION_TIME);
+
+	for (int i = 0; i < count; i++) {
+		samples[i].serial_number = m_sensors[i].serial_number;
+
+		ret = read_scratchpad(dev, i, &samples[i].temperature);
+		if (ret) {
+			samples[i].temperature = NAN;
+			continue;
+		}
+
+		LOG_DBG("Serial number: %llu / Temperature: %.2f C", samples[i].serial_number,
+			(double)samples[i].temperature);
+	}
+
+	res = count;
+
+error:
+	ret = ctr_w1_release(&m_w1, dev);
+	if (ret) {
+		LOG_ERR("Call `ctr_w1_release` failed: %d", ret);
+		res = res < 0 ? res : ret;
+	}
+
+	k_mutex_unlock(&m_lock);
+
+	return res;
+}
@@ -6,6 +6,7 @@
 
 #include "minmea.h"
 #include "ctr_gnss_m8.h"
+#include "ctr_gnss_session.h"
 
 /* CHESTER includes */
 #include <chester/ctr_gnss.h>
@@ -14,6 +15,7 @@
 #include <chester/drivers/m8.h>
 
 /* Zephyr includes */
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/shell/shell.h>
@@ -36,6 +38,7 @@ LOG_MODULE_REGISTER(ctr_gnss, CONFIG_CTR_GNSS_LOG_LEVEL);
 enum cmd_msgq_req {
 	CMD_MSGQ_REQ_START = 0,
 	CMD_MSGQ_REQ_STOP = 1,
+	CMD_MSGQ_REQ_SESSION = 2,
 };
 
 struct cmd_msgq_data_stop {
@@ -44,6 +47,7 @@ struct cmd_msgq_data_stop {
 
 union cmd_msgq_data {
 	struct cmd_msgq_data_stop stop;
+	struct ctr_gnss_session_config session;
 };
 
 struct cmd_msgq_item {
@@ -63,8 +67,14 @@ static struct ctr_gnss_data_update m_last_data_update = {
 	.latitude = NAN,
 	.longitude = NAN,
 	.altitude = NAN,
+	.h_acc = NAN,
+	.v_acc = NAN,
 };
 
+/* Protected by m_data_mutex */
+static struct ctr_gnss_session m_session;
+static bool m_session_fix;
+
 K_MUTEX_DEFINE(m_data_mutex);
 
 K_MSGQ_DEFINE_STATIC(m_cmd_msgq, sizeof(struct cmd_msgq_item), CMD_MSGQ_MAX_ITEMS, 4);
@@ -85,6 +95,12 @@ static void gnss_update_cb(enum ctr_gnss_event event, union ctr_gnss_event_data
 	if (event == CTR_GNSS_EVENT_UPDATE) {
 		k_mutex_lock(&m_data_mutex, K_FOREVER);
 		memcpy(&m_last_data_update, &data->update, sizeof(m_last_data_update));
+
+		if (ctr_gnss_session_feed(&m_session, &data->update, k_uptime_get())) {
+			/* The receiver is stopped by the dispatcher once the data are processed */
+			m_session_fix = true;
+		}
+
 		k_mutex_unlock(&m_data_mutex);
 	}
 	if (m_user_cb) {
@@ -139,6 +155,92 @@ static int process_req_stop(const struct cmd_msgq_item *item)
 	return ret;
 }
 
+static void process_req_session(const struct cmd_msgq_item *item)
+{
+	int ret;
+
+	union ctr_gnss_event_data data = {0};
+
+	if (!m_running) {
+		ret = process_req_start(item);
+		if (ret) {
+			LOG_ERR("Call `process_req_start` failed: %d", ret);
+
+			if (m_user_cb) {
+				data.start_err.corr_id = item->corr_id;
+
+				m_user_cb(CTR_GNSS_EVENT_START_ERR, &data, m_user_data);
+			}
+
+			return;
+		}
+
+		m_running = true;
+
+		if (m_user_cb) {
+			data.start_ok.corr_id = item->corr_id;
+
+			m_user_cb(CTR_GNSS_EVENT_START_OK, &data, m_user_data);
+		}
+	}
+
+	k_mutex_lock(&m_data_mutex, K_FOREVER);
+	ctr_gnss_session_begin(&m_session, &item->data.session, item->corr_id, k_uptime_get());
+	m_session_fix = false;
+	k_mutex_unlock(&m_data_mutex);
+}
+
+static void check_session(void)
+{
+	int ret;
+
+	int64_t now = k_uptime_get();
+
+	k_mutex_lock(&m_data_mutex, K_FOREVER);
+
+	bool fix = m_session_fix;
+
+	if (!m_session.active || (!fix && !ctr_gnss_session_is_expired(&m_session, now))) {
+		k_mutex_unlock(&m_data_mutex);
+		return;
+	}
+
+	union ctr_gnss_event_data data = {0};
+	ctr_gnss_session_end(&m_session, fix, now, &data.session_end);
+	m_session_fix = false;
+
+	k_mutex_unlock(&m_data_mutex);
+
+	LOG_INF("Session ended (fix: %s, ttff: %d ms, duration: %d ms)", fix ? "yes" : "no",
+		data.session_end.ttff, data.session_end.duration);
+
+	/* Keep the backup domain so that the next session starts hot */
+	struct cmd_msgq_item item = {
+		.corr_id = data.session_end.corr_id,
+		.req = CMD_MSGQ_REQ_STOP,
+		.data.stop.keep_bckp_domain = true,
+	};
+
+	ret = process_req_stop(&item);
+	if (ret) {
+		LOG_ERR("Call `process_req_stop` failed: %d", ret);
+
+		if (m_user_cb) {
+			union ctr_gnss_event_data stop_data = {0};
+			stop_data.stop_err.corr_id = item.corr_id;
+
+			m_user_cb(CTR_GNSS_EVENT_STOP_ERR, &stop_data, m_user_data);
+		}
+
+	} else {
+		m_running = false;
+	}
+
+	if (m_user_cb) {
+		m_user_cb(CTR_GNSS_EVENT_SESSION_END, &data, m_user_data);
+	}
+}
+
 static void process_cmd_msgq(void)
 {
 	int ret;
@@ -191,6 +293,10 @@ static void process_cmd_msgq(void)
 			LOG_WRN("No reason for STOP operation - ignoring");
 
 		} else {
+			k_mutex_lock(&m_data_mutex, K_FOREVER);
+			ctr_gnss_session_cancel(&m_session);
+			k_mutex_unlock(&m_data_mutex);
+
 			ret = process_req_stop(&item);
 
 			union ctr_gnss_event_data data = {0};
@@ -214,6 +320,11 @@ static void process_cmd_msgq(void)
 				}
 			}
 		}
+
+	} else if (item.req == CMD_MSGQ_REQ_SESSION) {
+		LOG_INF("Dequeued SESSION command (correlation id: %d)", item.corr_id);
+
+		process_req_session(&item);
 	}
 }
 
@@ -243,10 +354,14 @@ static void dispatcher_thread(void)
 					data.update.latitude = update.latitude;
 					data.update.longitude = update.longitude;
 					data.update.altitude = update.altitude;
+					data.update.h_acc = update.accuracy;
+					data.update.v_acc = NAN;
 					gnss_update_cb(CTR_GNSS_EVENT_UPDATE, &data, NULL);
 				}
 			}
 #endif
+
+			check_session();
 		}
 
 		process_cmd_msgq();
@@ -313,6 +428,49 @@ int ctr_gnss_stop(bool keep_bckp_domain, int *corr_id)
 	return 0;
 }
 
+int ctr_gnss_start_session(const struct ctr_gnss_session_config *config, int *corr_id)
+{
+	int ret;
+
+	if (!config || config->accuracy < 0 || config->min_satellites < 0 ||
+	    config->max_duration <= 0) {
+		return -EINVAL;
+	}
+
+	struct cmd_msgq_item item = {
+		.corr_id = (int)atomic_inc(&m_corr_id),
+		.req = CMD_MSGQ_REQ_SESSION,
+		.data.session = *config,
+	};
+
+	LOG_INF("Enqueing SESSION command (correlation id: %d)", item.corr_id);
+
+	if (corr_id) {
+		*corr_id = item.corr_id;
+	}
+
+	ret = k_msgq_put(&m_cmd_msgq, &item, K_NO_WAIT);
+	if (ret) {
+		LOG_ERR("Call `k_msgq_put` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int ctr_gnss_get_session_stats(struct ctr_gnss_session_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&m_data_mutex, K_FOREVER);
+	memcpy(stats, &m_session.stats, sizeof(*stats));
+	k_mutex_unlock(&m_data_mutex);
+
+	return 0;
+}
+
 int ctr_gnss_is_running(bool *running)
 {
 	if (!running) {
@@ -336,3 +494,14 @@ int ctr_gnss_get_last_data_update(struct ctr_gnss_data_update *data_update)
 
 	return 0;
 }
+
+static int init(void)
+{
+	LOG_INF("System initialization");
+
+	ctr_gnss_session_init(&m_session);
+
+	return 0;
+}
+
+SYS_INIT(init, APPLICATION, CONFIG_CTR_GNSS_INIT_PRIORITY);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_gnss_ubx.h"
 #include "minmea.h"
 
 /* CHESTER includes */
@@ -14,20 +15,40 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/sys/byteorder.h>
 
 /* Standard includes */
+#include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 LOG_MODULE_REGISTER(ctr_gnss_m8, CONFIG_CTR_GNSS_LOG_LEVEL);
 
+/* The receiver buffers up to 4 kB, read it in bursts instead of small chunks */
+#define READ_BUF_SIZE 512
+
+/* DDC (I2C) port of the receiver */
+#define UBX_PORT_DDC      0
+#define UBX_DDC_ADDRESS   0x42
+#define UBX_PROTO_UBX     BIT(0)
+/* TX-ready threshold in 8-byte units, one NAV-PVT frame */
+#define UBX_TXREADY_THRES ((CTR_GNSS_UBX_NAV_PVT_LEN + CTR_GNSS_UBX_OVERHEAD) / 8)
+
 static const struct device *m_m8_dev = DEVICE_DT_GET(DT_NODELABEL(m8));
+static uint8_t m_read_buf[READ_BUF_SIZE];
+static ctr_gnss_user_cb m_user_cb;
+static void *m_user_data;
+
+#if defined(CONFIG_CTR_GNSS_M8_UBX)
+static struct ctr_gnss_ubx_parser m_ubx_parser;
+#else
 static char m_line_buf[256];
 static size_t m_line_len;
 static bool m_line_clipped;
-static ctr_gnss_user_cb m_user_cb;
-static void *m_user_data;
+#endif /* defined(CONFIG_CTR_GNSS_M8_UBX) */
+
+#if !defined(CONFIG_CTR_GNSS_M8_UBX)
 
 static void parse_nmea(const char *line)
 {
@@ -44,6 +65,8 @@ static void parse_nmea(const char *line)
 			data.update.latitude = minmea_tocoord(&frame.latitude);
 			data.update.longitude = minmea_tocoord(&frame.longitude);
 			data.update.altitude = minmea_tofloat(&frame.altitude);
+			data.update.h_acc = NAN;
+			data.update.v_acc = NAN;
 
 			LOG_DBG("Fix quality: %d", data.update.fix_quality);
 			LOG_DBG("Satellites tracked: %d", data.update.satellites_tracked);
@@ -88,6 +111,108 @@ static void ingest_nmea(uint8_t *buf, size_t len)
 	}
 }
 
+#else
+
+static void ubx_frame_cb(uint8_t cls, uint8_t id, const uint8_t *payload, size_t len,
+			 void *user_data)
+{
+	int ret;
+
+	if (cls == CTR_GNSS_UBX_CLASS_ACK && id == CTR_GNSS_UBX_ID_ACK_NAK && len == 2) {
+		LOG_WRN("Message 0x%02x 0x%02x not acknowledged", payload[0], payload[1]);
+		return;
+	}
+
+	if (cls != CTR_GNSS_UBX_CLASS_NAV || id != CTR_GNSS_UBX_ID_NAV_PVT) {
+		return;
+	}
+
+	struct ctr_gnss_ubx_nav_pvt pvt;
+	ret = ctr_gnss_ubx_decode_nav_pvt(payload, len, &pvt);
+	if (ret) {
+		LOG_WRN("Call `ctr_gnss_ubx_decode_nav_pvt` failed: %d", ret);
+		return;
+	}
+
+	union ctr_gnss_event_data data = {0};
+	ctr_gnss_ubx_nav_pvt_to_update(&pvt, &data.update);
+
+	LOG_DBG("Fix quality: %d", data.update.fix_quality);
+	LOG_DBG("Satellites tracked: %d", data.update.satellites_tracked);
+	LOG_DBG("Latitude: %.7f", (double)data.update.latitude);
+	LOG_DBG("Longitude: %.7f", (double)data.update.longitude);
+	LOG_DBG("Altitude: %.1f", (double)data.update.altitude);
+	LOG_DBG("Accuracy: %.1f / %.1f", (double)data.update.h_acc, (double)data.update.v_acc);
+
+	if (m_user_cb) {
+		m_user_cb(CTR_GNSS_EVENT_UPDATE, &data, m_user_data);
+	}
+}
+
+static int send_ubx(uint8_t cls, uint8_t id, const void *payload, size_t len)
+{
+	int ret;
+
+	uint8_t buf[32];
+	ret = ctr_gnss_ubx_encode(buf, sizeof(buf), cls, id, payload, len);
+	if (ret < 0) {
+		LOG_ERR("Call `ctr_gnss_ubx_encode` failed: %d", ret);
+		return ret;
+	}
+
+	ret = m8_write_buffer(m_m8_dev, buf, ret);
+	if (ret) {
+		LOG_ERR("Call `m8_write_buffer` failed: %d", ret);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int configure_ubx(void)
+{
+	int ret;
+
+	/* CFG-PRT: UBX only on the DDC port */
+	uint8_t prt[20] = {UBX_PORT_DDC};
+
+	uint16_t txready = 0;
+
+#if defined(CONFIG_CTR_GNSS_M8_UBX_TXREADY)
+	bool ready;
+	if (m8_get_tx_ready(m_m8_dev, &ready) == -ENOTSUP) {
+		LOG_WRN("Pin `TX READY` not wired (polling)");
+	} else {
+		txready = BIT(0) | (CONFIG_CTR_GNSS_M8_UBX_TXREADY_PIO << 2) |
+			  (UBX_TXREADY_THRES << 7);
+	}
+#endif /* defined(CONFIG_CTR_GNSS_M8_UBX_TXREADY) */
+
+	sys_put_le16(txready, &prt[2]);
+	sys_put_le32(UBX_DDC_ADDRESS << 1, &prt[4]);
+	sys_put_le16(UBX_PROTO_UBX, &prt[12]);
+	sys_put_le16(UBX_PROTO_UBX, &prt[14]);
+
+	ret = send_ubx(CTR_GNSS_UBX_CLASS_CFG, CTR_GNSS_UBX_ID_CFG_PRT, prt, sizeof(prt));
+	if (ret) {
+		LOG_ERR("Call `send_ubx` failed: %d", ret);
+		return ret;
+	}
+
+	/* CFG-MSG: NAV-PVT every navigation epoch on the current port */
+	uint8_t msg[] = {CTR_GNSS_UBX_CLASS_NAV, CTR_GNSS_UBX_ID_NAV_PVT, 1};
+
+	ret = send_ubx(CTR_GNSS_UBX_CLASS_CFG, CTR_GNSS_UBX_ID_CFG_MSG, msg, sizeof(msg));
+	if (ret) {
+		LOG_ERR("Call `send_ubx` failed: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+#endif /* !defined(CONFIG_CTR_GNSS_M8_UBX) */
+
 int ctr_gnss_m8_start(void)
 {
 	int ret;
@@ -109,10 +234,20 @@ int ctr_gnss_m8_start(void)
 		return -EIO;
 	}
 
+	k_sleep(K_SECONDS(1));
+
+#if defined(CONFIG_CTR_GNSS_M8_UBX)
+	ctr_gnss_ubx_parser_init(&m_ubx_parser, ubx_frame_cb, NULL);
+
+	ret = configure_ubx();
+	if (ret) {
+		LOG_ERR("Call `configure_ubx` failed: %d", ret);
+		return ret;
+	}
+#else
 	m_line_len = 0;
 	m_line_clipped = false;
-
-	k_sleep(K_SECONDS(1));
+#endif /* defined(CONFIG_CTR_GNSS_M8_UBX) */
 
 	return 0;
 }
@@ -161,15 +296,23 @@ int ctr_gnss_m8_process_data(void)
 	}
 
 	int ret;
-	uint8_t buf[64];
 	size_t bytes_read;
 
+#if defined(CONFIG_CTR_GNSS_M8_UBX_TXREADY)
+	bool ready;
+	ret = m8_get_tx_ready(m_m8_dev, &ready);
+	if (!ret && !ready) {
+		/* Nothing buffered, skip the I2C transaction */
+		return 0;
+	}
+#endif /* defined(CONFIG_CTR_GNSS_M8_UBX_TXREADY) */
+
 	/* Limit for number of read attempts to avoid infinite loop */
 	const int max_attempts = 50;
 	int attempt = 0;
 
 	while (attempt++ < max_attempts) {
-		ret = m8_read_buffer(m_m8_dev, buf, sizeof(buf), &bytes_read);
+		ret = m8_read_buffer(m_m8_dev, m_read_buf, sizeof(m_read_buf), &bytes_read);
 		if (ret) {
 			LOG_ERR("Call `m8_read_buffer` failed: %d", ret);
 
@@ -187,10 +330,14 @@ int ctr_gnss_m8_process_data(void)
 			break;
 		}
 
-		ingest_nmea(buf, bytes_read);
+#if defined(CONFIG_CTR_GNSS_M8_UBX)
+		ctr_gnss_ubx_parser_feed(&m_ubx_parser, m_read_buf, bytes_read);
+#else
+		ingest_nmea(m_read_buf, bytes_read);
 
 		/* Optional delay to prevent tight polling loop */
 		k_sleep(K_MSEC(20));
+#endif /* defined(CONFIG_CTR_GNSS_M8_UBX) */
 	}
 
 	if (attempt >= max_attempts) {
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_gnss_session.h"
+
+/* CHESTER includes */
+#include <chester/ctr_gnss.h>
+
+/* Zephyr includes */
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+static bool has_fix(const struct ctr_gnss_data_update *update)
+{
+	/* The nRF9160 backend reports no fix quality, only positions of valid fixes */
+	if (update->fix_quality < 0) {
+		return !isnan(update->latitude) && !isnan(update->longitude);
+	}
+
+	return update->fix_quality > 0;
+}
+
+static bool is_better(const struct ctr_gnss_data_update *update,
+		      const struct ctr_gnss_data_update *best)
+{
+	if (!has_fix(best)) {
+		return true;
+	}
+
+	/* Without accuracy estimates the latest fix wins */
+	if (isnan(update->h_acc) || isnan(best->h_acc)) {
+		return true;
+	}
+
+	return update->h_acc <= best->h_acc;
+}
+
+static bool meets_target(const struct ctr_gnss_session_config *config,
+			 const struct ctr_gnss_data_update *update)
+{
+	if (config->accuracy > 0 && !isnan(update->h_acc) && update->h_acc > config->accuracy) {
+		return false;
+	}
+
+	if (config->min_satellites > 0 && update->satellites_tracked >= 0 &&
+	    update->satellites_tracked < config->min_satellites) {
+		return false;
+	}
+
+	return true;
+}
+
+void ctr_gnss_session_init(struct ctr_gnss_session *session)
+{
+	memset(session, 0, sizeof(*session));
+
+	session->stats.last_ttff = -1;
+	session->stats.min_ttff = -1;
+	session->stats.max_ttff = -1;
+	session->stats.avg_ttff = -1;
+}
+
+void ctr_gnss_session_begin(struct ctr_gnss_session *session,
+			    const struct ctr_gnss_session_config *config, int corr_id, int64_t now)
+{
+	session->active = true;
+	session->corr_id = corr_id;
+	session->config = *config;
+	session->start = now;
+	session->first_fix = -1;
+
+	memset(&session->best, 0, sizeof(session->best));
+	session->best.fix_quality = -1;
+	session->best.satellites_tracked = -1;
+	session->best.latitude = NAN;
+	session->best.longitude = NAN;
+	session->best.altitude = NAN;
+	session->best.h_acc = NAN;
+	session->best.v_acc = NAN;
+}
+
+bool ctr_gnss_session_feed(struct ctr_gnss_session *session,
+			   const struct ctr_gnss_data_update *update, int64_t now)
+{
+	if (!session->active || !has_fix(update)) {
+		return false;
+	}
+
+	if (session->first_fix < 0) {
+		session->first_fix = now;
+	}
+
+	/* The fix meeting the target is reported, otherwise the most accurate one */
+	if (meets_target(&session->config, update)) {
+		session->best = *update;
+		return true;
+	}
+
+	if (is_better(update, &session->best)) {
+		session->best = *update;
+	}
+
+	return false;
+}
+
+bool ctr_gnss_session_is_expired(const struct ctr_gnss_session *session, int64_t now)
+{
+	return session->active && now - session->start >= session->config.max_duration * 1000LL;
+}
+
+void ctr_gnss_session_end(struct ctr_gnss_session *session, bool fix, int64_t now,
+			  struct ctr_gnss_data_session_end *data)
+{
+	struct ctr_gnss_session_stats *stats = &session->stats;
+
+	int ttff = session->first_fix < 0 ? -1 : (int)(session->first_fix - session->start);
+
+	memset(data, 0, sizeof(*data));
+	data->corr_id = session->corr_id;
+	data->fix = fix;
+	data->ttff = ttff;
+	data->duration = (int)(now - session->start);
+	data->update = session->best;
+
+	session->active = false;
+
+	stats->sessions++;
+
+	if (fix) {
+		stats->fixes++;
+	} else {
+		stats->timeouts++;
+	}
+
+	if (ttff >= 0) {
+		/* Timed-out sessions count too when they acquired a fix below the target */
+		session->ttff_sum += ttff;
+		session->ttff_count++;
+
+		stats->last_ttff = ttff;
+		stats->min_ttff = stats->min_ttff < 0 ? ttff : MIN(stats->min_ttff, ttff);
+		stats->max_ttff = MAX(stats->max_ttff, ttff);
+		stats->avg_ttff = (int)(session->ttff_sum / session->ttff_count);
+	}
+}
+
+void ctr_gnss_session_cancel(struct ctr_gnss_session *session)
+{
+	session->active = false;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_GNSS_SESSION_H_
+#define CHESTER_SUBSYS_CTR_GNSS_SESSION_H_
+
+/* CHESTER includes */
+#include <chester/ctr_gnss.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Termination logic of a GNSS session, timestamps are uptime in milliseconds */
+struct ctr_gnss_session {
+	bool active;
+	int corr_id;
+	struct ctr_gnss_session_config config;
+	int64_t start;
+	int64_t first_fix;
+	struct ctr_gnss_data_update best;
+	/* Time to first fix accumulated over the sessions with a fix */
+	int64_t ttff_sum;
+	int ttff_count;
+	struct ctr_gnss_session_stats stats;
+};
+
+void ctr_gnss_session_init(struct ctr_gnss_session *session);
+void ctr_gnss_session_begin(struct ctr_gnss_session *session,
+			    const struct ctr_gnss_session_config *config, int corr_id, int64_t now);
+
+/* Returns true once the update meets the target */
+bool ctr_gnss_session_feed(struct ctr_gnss_session *session,
+			   const struct ctr_gnss_data_update *update, int64_t now);
+
+bool ctr_gnss_session_is_expired(const struct ctr_gnss_session *session, int64_t now);
+
+/* Closes the session and updates the statistics */
+void ctr_gnss_session_end(struct ctr_gnss_session *session, bool fix, int64_t now,
+			  struct ctr_gnss_data_session_end *data);
+
+/* Closes the session without counting it */
+void ctr_gnss_session_cancel(struct ctr_gnss_session *session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_GNSS_SESSION_H_ */
@@ -16,6 +16,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 LOG_MODULE_REGISTER(ctr_gnss_shell, CONFIG_CTR_GNSS_LOG_LEVEL);
 
@@ -65,6 +66,43 @@ static int cmd_stop(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_session(const struct shell *shell, size_t argc, char **argv)
+{
+	int ret;
+
+	if (argc > 4) {
+		shell_error(shell, "command not found: %s", argv[4]);
+		shell_help(shell);
+		return -EINVAL;
+	}
+
+	struct ctr_gnss_session_config config = CTR_GNSS_SESSION_CONFIG_DEFAULTS;
+
+	if (argc > 1) {
+		config.accuracy = strtof(argv[1], NULL);
+	}
+
+	if (argc > 2) {
+		config.min_satellites = atoi(argv[2]);
+	}
+
+	if (argc > 3) {
+		config.max_duration = atoi(argv[3]);
+	}
+
+	int corr_id;
+	ret = ctr_gnss_start_session(&config, &corr_id);
+	if (ret) {
+		LOG_ERR("Call `ctr_gnss_start_session` failed: %d", ret);
+		shell_error(shell, "command failed");
+		return ret;
+	}
+
+	shell_print(shell, "correlation id: %d", corr_id);
+
+	return 0;
+}
+
 static int cmd_state(const struct shell *shell, size_t argc, char **argv)
 {
 	if (argc > 1) {
@@ -91,6 +129,16 @@ static int cmd_state(const struct shell *shell, size_t argc, char **argv)
 	shell_print(shell, "latitude: %.7f", (double)data_update.latitude);
 	shell_print(shell, "longitude: %.7f", (double)data_update.longitude);
 	shell_print(shell, "altitude: %.1f", (double)data_update.altitude);
+	shell_print(shell, "horizontal accuracy: %.1f", (double)data_update.h_acc);
+	shell_print(shell, "vertical accuracy: %.1f", (double)data_update.v_acc);
+
+	struct ctr_gnss_session_stats stats;
+	ctr_gnss_get_session_stats(&stats);
+
+	shell_print(shell, "sessions: %d (fixes: %d, timeouts: %d)", stats.sessions, stats.fixes,
+		    stats.timeouts);
+	shell_print(shell, "ttff: %d ms (min: %d ms, max: %d ms, avg: %d ms)", stats.last_ttff,
+		    stats.min_ttff, stats.max_ttff, stats.avg_ttff);
 
 	return 0;
 }
@@ -121,6 +169,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	              "Stop receiver.",
 	              cmd_stop, 1, 0),
 
+	SHELL_CMD_ARG(session, NULL,
+	              "Start session until fix "
+	              "([accuracy] [min satellites] [max duration]).",
+	              cmd_session, 1, 3),
+
 	SHELL_CMD_ARG(state, NULL,
 	              "Get receiver state.",
 	              cmd_state, 1, 0),
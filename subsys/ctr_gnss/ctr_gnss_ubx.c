@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_gnss_ubx.h"
+
+/* CHESTER includes */
+#include <chester/ctr_gnss.h>
+
+/* Zephyr includes */
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SYNC_1 0xb5
+#define SYNC_2 0x62
+
+/* NAV-PVT flags */
+#define PVT_FLAGS_GNSS_FIX_OK BIT(0)
+#define PVT_FLAGS_DIFF_SOLN   BIT(1)
+
+/* NAV-PVT fix types */
+#define PVT_FIX_TYPE_DEAD_RECKONING 1
+#define PVT_FIX_TYPE_2D             2
+#define PVT_FIX_TYPE_3D             3
+#define PVT_FIX_TYPE_GNSS_DR        4
+
+enum state {
+	STATE_SYNC_1 = 0,
+	STATE_SYNC_2,
+	STATE_CLASS,
+	STATE_ID,
+	STATE_LEN_1,
+	STATE_LEN_2,
+	STATE_PAYLOAD,
+	STATE_CK_A,
+	STATE_CK_B,
+};
+
+static void checksum(struct ctr_gnss_ubx_parser *parser, uint8_t c)
+{
+	parser->ck_a += c;
+	parser->ck_b += parser->ck_a;
+}
+
+void ctr_gnss_ubx_parser_init(struct ctr_gnss_ubx_parser *parser, ctr_gnss_ubx_frame_cb cb,
+			      void *user_data)
+{
+	memset(parser, 0, sizeof(*parser));
+
+	parser->state = STATE_SYNC_1;
+	parser->cb = cb;
+	parser->user_data = user_data;
+}
+
+void ctr_gnss_ubx_parser_feed(struct ctr_gnss_ubx_parser *parser, const uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		uint8_t c = buf[i];
+
+		switch (parser->state) {
+		case STATE_SYNC_1:
+			if (c == SYNC_1) {
+				parser->state = STATE_SYNC_2;
+			}
+			break;
+
+		case STATE_SYNC_2:
+			if (c == SYNC_2) {
+				parser->ck_a = 0;
+				parser->ck_b = 0;
+				parser->state = STATE_CLASS;
+			} else if (c != SYNC_1) {
+				parser->state = STATE_SYNC_1;
+			}
+			break;
+
+		case STATE_CLASS:
+			checksum(parser, c);
+			parser->cls = c;
+			parser->state = STATE_ID;
+			break;
+
+		case STATE_ID:
+			checksum(parser, c);
+			parser->id = c;
+			parser->state = STATE_LEN_1;
+			break;
+
+		case STATE_LEN_1:
+			checksum(parser, c);
+			parser->len = c;
+			parser->state = STATE_LEN_2;
+			break;
+
+		case STATE_LEN_2:
+			checksum(parser, c);
+			parser->len |= c << 8;
+			parser->pos = 0;
+
+			if (parser->len > sizeof(parser->payload)) {
+				/* Resynchronize, the checksum protects against false sync inside */
+				parser->oversized++;
+				parser->state = STATE_SYNC_1;
+			} else {
+				parser->state = parser->len ? STATE_PAYLOAD : STATE_CK_A;
+			}
+			break;
+
+		case STATE_PAYLOAD:
+			checksum(parser, c);
+			parser->payload[parser->pos++] = c;
+
+			if (parser->pos == parser->len) {
+				parser->state = STATE_CK_A;
+			}
+			break;
+
+		case STATE_CK_A:
+			if (c == parser->ck_a) {
+				parser->state = STATE_CK_B;
+			} else {
+				parser->checksum_errors++;
+				parser->state = c == SYNC_1 ? STATE_SYNC_2 : STATE_SYNC_1;
+			}
+			break;
+
+		case STATE_CK_B:
+			parser->state = STATE_SYNC_1;
+
+			if (c != parser->ck_b) {
+				parser->checksum_errors++;
+				if (c == SYNC_1) {
+					parser->state = STATE_SYNC_2;
+				}
+				break;
+			}
+
+			parser->frames++;
+
+			if (parser->cb) {
+				parser->cb(parser->cls, parser->id, parser->payload, parser->len,
+					   parser->user_data);
+			}
+			break;
+
+		default:
+			parser->state = STATE_SYNC_1;
+			break;
+		}
+	}
+}
+
+int ctr_gnss_ubx_encode(uint8_t *buf, size_t size, uint8_t cls, uint8_t id, const void *payload,
+			size_t len)
+{
+	if (len > UINT16_MAX || size < len + CTR_GNSS_UBX_OVERHEAD) {
+		return -ENOBUFS;
+	}
+
+	buf[0] = SYNC_1;
+	buf[1] = SYNC_2;
+	buf[2] = cls;
+	buf[3] = id;
+	sys_put_le16(len, &buf[4]);
+
+	if (len) {
+		memcpy(&buf[6], payload, len);
+	}
+
+	uint8_t ck_a = 0;
+	uint8_t ck_b = 0;
+
+	for (size_t i = 2; i < len + 6; i++) {
+		ck_a += buf[i];
+		ck_b += ck_a;
+	}
+
+	buf[len + 6] = ck_a;
+	buf[len + 7] = ck_b;
+
+	return len + CTR_GNSS_UBX_OVERHEAD;
+}
+
+int ctr_gnss_ubx_decode_nav_pvt(const uint8_t *payload, size_t len,
+				struct ctr_gnss_ubx_nav_pvt *pvt)
+{
+	if (len != CTR_GNSS_UBX_NAV_PVT_LEN) {
+		return -EINVAL;
+	}
+
+	pvt->itow = sys_get_le32(&payload[0]);
+	pvt->year = sys_get_le16(&payload[4]);
+	pvt->month = payload[6];
+	pvt->day = payload[7];
+	pvt->hour = payload[8];
+	pvt->min = payload[9];
+	pvt->sec = payload[10];
+	pvt->valid = payload[11];
+	pvt->fix_type = payload[20];
+	pvt->flags = payload[21];
+	pvt->num_sv = payload[23];
+	pvt->lon = (int32_t)sys_get_le32(&payload[24]);
+	pvt->lat = (int32_t)sys_get_le32(&payload[28]);
+	pvt->height = (int32_t)sys_get_le32(&payload[32]);
+	pvt->h_msl = (int32_t)sys_get_le32(&payload[36]);
+	pvt->h_acc = sys_get_le32(&payload[40]);
+	pvt->v_acc = sys_get_le32(&payload[44]);
+	pvt->g_speed = (int32_t)sys_get_le32(&payload[60]);
+	pvt->head_mot = (int32_t)sys_get_le32(&payload[64]);
+	pvt->p_dop = sys_get_le16(&payload[76]);
+
+	return 0;
+}
+
+void ctr_gnss_ubx_nav_pvt_to_update(const struct ctr_gnss_ubx_nav_pvt *pvt,
+				    struct ctr_gnss_data_update *update)
+{
+	memset(update, 0, sizeof(*update));
+
+	if (!(pvt->flags & PVT_FLAGS_GNSS_FIX_OK)) {
+		update->fix_quality = 0;
+	} else if (pvt->fix_type == PVT_FIX_TYPE_DEAD_RECKONING) {
+		update->fix_quality = 6;
+	} else if (pvt->fix_type >= PVT_FIX_TYPE_2D && pvt->fix_type <= PVT_FIX_TYPE_GNSS_DR) {
+		update->fix_quality = pvt->flags & PVT_FLAGS_DIFF_SOLN ? 2 : 1;
+	} else {
+		update->fix_quality = 0;
+	}
+
+	update->satellites_tracked = pvt->num_sv;
+
+	if (update->fix_quality) {
+		update->latitude = (float)(pvt->lat / 1e7);
+		update->longitude = (float)(pvt->lon / 1e7);
+		update->altitude = pvt->fix_type == PVT_FIX_TYPE_2D ? NAN : pvt->h_msl / 1e3f;
+		update->h_acc = pvt->h_acc / 1e3f;
+		update->v_acc = pvt->fix_type == PVT_FIX_TYPE_2D ? NAN : pvt->v_acc / 1e3f;
+	} else {
+		update->latitude = NAN;
+		update->longitude = NAN;
+		update->altitude = NAN;
+		update->h_acc = NAN;
+		update->v_acc = NAN;
+	}
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_GNSS_UBX_H_
+#define CHESTER_SUBSYS_CTR_GNSS_UBX_H_
+
+/* CHESTER includes */
+#include <chester/ctr_gnss.h>
+
+/* Standard includes */
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CTR_GNSS_UBX_CLASS_NAV 0x01
+#define CTR_GNSS_UBX_CLASS_ACK 0x05
+#define CTR_GNSS_UBX_CLASS_CFG 0x06
+
+#define CTR_GNSS_UBX_ID_NAV_PVT 0x07
+#define CTR_GNSS_UBX_ID_ACK_NAK 0x00
+#define CTR_GNSS_UBX_ID_ACK_ACK 0x01
+#define CTR_GNSS_UBX_ID_CFG_PRT 0x00
+#define CTR_GNSS_UBX_ID_CFG_MSG 0x01
+
+#define CTR_GNSS_UBX_NAV_PVT_LEN 92
+
+/* Sync characters, class, id, length and checksum */
+#define CTR_GNSS_UBX_OVERHEAD 8
+
+/* Large enough for NAV-PVT, longer frames are skipped */
+#define CTR_GNSS_UBX_MAX_PAYLOAD 128
+
+typedef void (*ctr_gnss_ubx_frame_cb)(uint8_t cls, uint8_t id, const uint8_t *payload, size_t len,
+				      void *user_data);
+
+/* Streaming frame parser, bytes between frames (e.g. NMEA before reconfiguration) are ignored */
+struct ctr_gnss_ubx_parser {
+	int state;
+	uint8_t cls;
+	uint8_t id;
+	uint16_t len;
+	uint16_t pos;
+	uint8_t ck_a;
+	uint8_t ck_b;
+	uint8_t payload[CTR_GNSS_UBX_MAX_PAYLOAD];
+	ctr_gnss_ubx_frame_cb cb;
+	void *user_data;
+
+	/* Statistics */
+	uint32_t frames;
+	uint32_t checksum_errors;
+	uint32_t oversized;
+};
+
+struct ctr_gnss_ubx_nav_pvt {
+	uint32_t itow;
+	uint16_t year;
+	uint8_t month;
+	uint8_t day;
+	uint8_t hour;
+	uint8_t min;
+	uint8_t sec;
+	uint8_t valid;
+	uint8_t fix_type;
+	uint8_t flags;
+	uint8_t num_sv;
+	/* Degrees scaled by 1e7 */
+	int32_t lon;
+	int32_t lat;
+	/* Millimetres */
+	int32_t height;
+	int32_t h_msl;
+	uint32_t h_acc;
+	uint32_t v_acc;
+	/* Millimetres per second and degrees scaled by 1e5 */
+	int32_t g_speed;
+	int32_t head_mot;
+	/* Scaled by 100 */
+	uint16_t p_dop;
+};
+
+void ctr_gnss_ubx_parser_init(struct ctr_gnss_ubx_parser *parser, ctr_gnss_ubx_frame_cb cb,
+			      void *user_data);
+void ctr_gnss_ubx_parser_feed(struct ctr_gnss_ubx_parser *parser, const uint8_t *buf, size_t len);
+
+/* Returns the frame length, or -ENOBUFS when it does not fit into the buffer */
+int ctr_gnss_ubx_encode(uint8_t *buf, size_t size, uint8_t cls, uint8_t id, const void *payload,
+			size_t len);
+
+int ctr_gnss_ubx_decode_nav_pvt(const uint8_t *payload, size_t len,
+				struct ctr_gnss_ubx_nav_pvt *pvt);
+
+/* Fills the subsystem update, fix quality follows the GGA convention (0 no fix, 1 GNSS, 2 DGNSS,
+ * 6 dead reckoning) */
+void ctr_gnss_ubx_nav_pvt_to_update(const struct ctr_gnss_ubx_nav_pvt *pvt,
+				    struct ctr_gnss_data_update *update);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_GNSS_UBX_H_ */
@@ -1357,6 +1357,7 @@ static int init(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, cmd_config_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	ret = ctr_lrw_talk_init(talk_handler);
 	if (ret) {
@@ -39,13 +39,9 @@ LOG_MODULE_REGISTER(ctr_lrw_v2, CONFIG_CTR_LRW_V2_LOG_LEVEL);
 #define JOIN_TIMEOUT         K_SECONDS(120)
 #define JOIN_RETRY_COUNT     3
 #define JOIN_RETRY_DELAY     K_SECONDS(30)
-#define SEND_TIMEOUT         K_SECONDS(120)
 #define SEND_RETRY_COUNT     3
-#define SEND_RETRY_DELAY     K_SECONDS(30)
-#define REQ_INTRA_DELAY_MSEC 8000
 
-#define CMD_MSGQ_MAX_ITEMS  16
-#define SEND_MSGQ_MAX_ITEMS 16
+#define CMD_MSGQ_MAX_ITEMS 16
 
 int ctr_lrw_v2_init(ctr_lrw_v2_recv_cb recv_cb)
 {
@@ -102,13 +98,14 @@ int ctr_lrw_v2_send(const struct ctr_lrw_send_opts *opts, const void *buf, size_
 
 	struct send_msgq_data msg = {
 		.ttl = opts->ttl,
+		.priority = opts->priority,
 		.confirmed = opts->confirmed,
 		.port = opts->port,
 		.buf = (void *)buf,
 		.len = len,
 	};
 
-	ret = ctr_lrw_v2_flow_send(SEND_RETRY_COUNT, SEND_RETRY_DELAY, &msg);
+	ret = ctr_lrw_v2_flow_send(SEND_RETRY_COUNT, &msg);
 	if (ret) {
 		LOG_ERR("Call `ctr_lrw_v2_flow_send` failed: %d", ret);
 		return ret;
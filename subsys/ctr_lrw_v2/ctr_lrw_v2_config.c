@@ -36,6 +36,46 @@ struct ctr_lrw_v2_config m_config = {
 	.dutycycle = true,
 };
 
+static const char *m_enum_antenna_items[] = {"int", "ext"};
+static const char *m_enum_band_items[] = {
+	"as923", "au915", "", "", "", "eu868", "kr920", "in865", "us915",
+};
+static const char *m_enum_class_items[] = {"a", "", "c"};
+static const char *m_enum_mode_items[] = {"abp", "otaa"};
+static const char *m_enum_nwk_items[] = {"private", "public"};
+
+/* Only for the structured export and the partial apply - the shell commands above stay in use */
+static const struct ctr_config_item m_config_items[] = {
+	CTR_CONFIG_ITEM_BOOL("test", m_config.test, "LRW test mode", false),
+	CTR_CONFIG_ITEM_ENUM("antenna", m_config.antenna, m_enum_antenna_items, "antenna mode",
+			     CTR_LRW_V2_CONFIG_ANTENNA_INT),
+	CTR_CONFIG_ITEM_ENUM("band", m_config.band, m_enum_band_items, "radio band",
+			     CTR_LRW_V2_CONFIG_BAND_EU868),
+	CTR_CONFIG_ITEM_STRING("chmask", m_config.chmask,
+			       "channel mask (format: <N hexadecimal digits>)", ""),
+	CTR_CONFIG_ITEM_ENUM("class", m_config.class, m_enum_class_items, "device class",
+			     CTR_LRW_V2_CONFIG_CLASS_A),
+	CTR_CONFIG_ITEM_ENUM("mode", m_config.mode, m_enum_mode_items, "operation mode",
+			     CTR_LRW_V2_CONFIG_MODE_OTAA),
+	CTR_CONFIG_ITEM_ENUM("nwk", m_config.nwk, m_enum_nwk_items, "network type",
+			     CTR_LRW_V2_CONFIG_NETWORK_PUBLIC),
+	CTR_CONFIG_ITEM_BOOL("adr", m_config.adr, "adaptive data rate", true),
+	CTR_CONFIG_ITEM_INT("datarate", m_config.datarate, 0, 15, "data rate", 0),
+	CTR_CONFIG_ITEM_BOOL("dutycycle", m_config.dutycycle, "duty cycle", true),
+	CTR_CONFIG_ITEM_HEX("devaddr", m_config.devaddr, "DevAddr (format: <8 hexadecimal digits>)",
+			    ((const uint8_t[4]){0})),
+	CTR_CONFIG_ITEM_HEX("deveui", m_config.deveui, "DevEUI (format: <16 hexadecimal digits>)",
+			    ((const uint8_t[8]){0})),
+	CTR_CONFIG_ITEM_HEX("joineui", m_config.joineui,
+			    "JoinEUI (format: <16 hexadecimal digits>)", ((const uint8_t[8]){0})),
+	CTR_CONFIG_ITEM_HEX("appkey", m_config.appkey, "AppKey (format: <32 hexadecimal digits>)",
+			    ((const uint8_t[16]){0})),
+	CTR_CONFIG_ITEM_HEX("nwkskey", m_config.nwkskey,
+			    "NwkSKey (format: <32 hexadecimal digits>)", ((const uint8_t[16]){0})),
+	CTR_CONFIG_ITEM_HEX("appskey", m_config.appskey,
+			    "AppSKey (format: <32 hexadecimal digits>)", ((const uint8_t[16]){0})),
+};
+
 static void print_test(const struct shell *shell)
 {
 	shell_print(shell, SETTINGS_PFX " config test %s", m_config.test ? "true" : "false");
@@ -728,6 +768,7 @@ static int init()
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, ctr_lrw_v2_config_cmd_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	return 0;
 }
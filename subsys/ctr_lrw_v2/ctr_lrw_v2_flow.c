@@ -33,15 +33,54 @@ LOG_MODULE_REGISTER(ctr_lrw_v2_flow, CONFIG_CTR_LRW_V2_LOG_LEVEL);
 #define JOIN_TIMEOUT         K_SECONDS(120)
 #define JOIN_RETRY_COUNT     3
 #define JOIN_RETRY_DELAY     K_SECONDS(30)
-#define SEND_TIMEOUT         K_SECONDS(120)
-#define SEND_RETRY_COUNT     3
-#define SEND_RETRY_DELAY     K_SECONDS(30)
-#define REQ_INTRA_DELAY_MSEC 8000
+
+/* Safety net for a confirmed uplink whose +ACK/+NOACK never arrives */
+#define SEND_CONFIRM_TIMEOUT    K_SECONDS(30)
+#define SEND_BACKOFF_BASE_MSEC  5000
+#define SEND_BACKOFF_MAX_MSEC   (4 * 60 * 1000)
+#define SEND_PAYLOAD_MAX_SIZE   242
+#define SEND_WORK_Q_PRIORITY    K_PRIO_PREEMPT(CONFIG_CTR_LRW_V2_THREAD_PRIORITY)
+/* MHDR, FHDR without options, FPort and MIC */
+#define LORAWAN_FRAME_OVERHEAD  13
+#define EU868_DUTYCYCLE_PERCENT 1
+
+struct send_item {
+	bool used;
+	uint32_t seq;
+	int attempt;
+	int retries;
+	struct send_msgq_data data;
+	uint8_t buf[SEND_PAYLOAD_MAX_SIZE];
+};
 
 static struct ctr_lrw_v2_talk m_talk;
 
+/* Serializes the modem dialogs of the send work queue and the callers of the flow */
+static K_MUTEX_DEFINE(m_talk_lock);
+
+static K_MUTEX_DEFINE(m_send_lock);
+static struct send_item m_send_items[CONFIG_CTR_LRW_V2_SEND_QUEUE_SIZE];
+/* Item handed to the modem, owned by the send work until confirmed */
+static struct send_item *m_send_current;
+static k_timepoint_t m_send_confirm_end;
+static int64_t m_send_hold_until;
+static uint32_t m_send_seq;
+
+static K_THREAD_STACK_DEFINE(m_send_work_q_stack, CONFIG_CTR_LRW_V2_THREAD_STACK_SIZE);
+static struct k_work_q m_send_work_q;
+
+static void send_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(m_send_work, send_work_handler);
+
 static ctr_lrw_v2_recv_cb m_recv_cb;
 
+/* Completions collected under m_send_lock, notified once it is released so the callback may queue
+ * further messages - at most one per queue slot as nothing is queued while the lock is held */
+struct send_done {
+	size_t count;
+	enum ctr_lrw_v2_event events[CONFIG_CTR_LRW_V2_SEND_QUEUE_SIZE];
+};
+
 static const struct device *dev_lrw_link = DEVICE_DT_GET(DT_CHOSEN(ctr_lrw_link));
 static const struct device *dev_rfmux = DEVICE_DT_GET(DT_NODELABEL(ctr_rfmux));
 
@@ -93,6 +132,13 @@ static int disable(void)
 	return ret;
 }
 
+static void notify(enum ctr_lrw_v2_event event)
+{
+	if (m_recv_cb) {
+		m_recv_cb(event, NULL, NULL);
+	}
+}
+
 static void process_urc(const char *line)
 {
 	int ret;
@@ -121,21 +167,22 @@ static void process_urc(const char *line)
 		return;
 	}
 
+	/* Send events are reported to the user once the send work completes the message */
 	if (!strcmp(line, "+ACK")) {
 		k_event_post(&m_flow_events, EVENT_SEND_OK);
-		m_recv_cb(CTR_LRW_V2_EVENT_SEND_OK, NULL, NULL);
+		k_work_reschedule_for_queue(&m_send_work_q, &m_send_work, K_NO_WAIT);
 	} else if (!strcmp(line, "+NOACK")) {
 		k_event_post(&m_flow_events, EVENT_SEND_ERR);
-		m_recv_cb(CTR_LRW_V2_EVENT_SEND_ERR, NULL, NULL);
+		k_work_reschedule_for_queue(&m_send_work_q, &m_send_work, K_NO_WAIT);
 	} else if (!strcmp(line, "+EVENT=1,1")) {
 		k_event_post(&m_flow_events, EVENT_JOIN_OK);
-		m_recv_cb(CTR_LRW_V2_EVENT_JOIN_OK, NULL, NULL);
+		notify(CTR_LRW_V2_EVENT_JOIN_OK);
 	} else if (!strcmp(line, "+EVENT=1,0")) {
 		k_event_post(&m_flow_events, EVENT_JOIN_ERR);
-		m_recv_cb(CTR_LRW_V2_EVENT_JOIN_ERR, NULL, NULL);
+		notify(CTR_LRW_V2_EVENT_JOIN_ERR);
 	} else if (!strcmp(line, "+EVENT=0,0")) {
 		k_event_post(&m_flow_events, EVENT_START_OK);
-		m_recv_cb(CTR_LRW_V2_EVENT_START_OK, NULL, NULL);
+		notify(CTR_LRW_V2_EVENT_START_OK);
 	} else if (!strncmp(line, "+RECV=", 6)) {
 		m_recv_incoming = true;
 	}
@@ -501,8 +548,6 @@ static int send_once(const struct send_msgq_data *data)
 {
 	int ret;
 
-	k_event_clear(&m_flow_events, EVENT_SEND_OK | EVENT_SEND_ERR);
-
 	if (!data->confirmed && data->port < 0) {
 		ret = ctr_lrw_v2_talk_at_utx(&m_talk, data->buf, data->len);
 		if (ret) {
@@ -532,54 +577,247 @@ static int send_once(const struct send_msgq_data *data)
 		}
 	}
 
-	if (data->confirmed) {
-		for (int i = 0; i < 5; i++) {
-			poll_urc();
+	return 0;
+}
+
+/*
+ * LoRa time on air in milliseconds of an uplink with the given application payload - 125 kHz
+ * bandwidth, coding rate 4/5, 8 symbol preamble, explicit header and CRC (data rates 0 to 5 of
+ * the EU868 band, where SF = 12 - DR)
+ */
+static int64_t get_time_on_air(int datarate, size_t len)
+{
+	int sf = 12 - CLAMP(datarate, 0, 5);
+	int de = sf >= 11 ? 1 : 0;
+	int num = 8 * (int)(len + LORAWAN_FRAME_OVERHEAD) - 4 * sf + 28 + 16;
+	int den = 4 * (sf - 2 * de);
+	int n = 8 + MAX(DIV_ROUND_UP(num, den), 0) * 5;
 
-			if (k_event_test(&m_flow_events, EVENT_SEND_OK)) {
-				return 0;
-			} else if (k_event_test(&m_flow_events, EVENT_SEND_ERR)) {
-				LOG_ERR("Sending failed");
-				return -EIO;
-			}
+	/* Symbol time is 2^SF / 125 kHz, the preamble takes 12.25 symbols */
+	int64_t tsym_us = 8LL << sf;
+
+	return ((49 + 4 * n) * tsym_us / 4 + 999) / 1000;
+}
+
+/* Time the sub-band stays closed after an uplink when the duty cycle is enforced */
+static int64_t get_off_time(size_t len)
+{
+	if (g_ctr_lrw_v2_config.band != CTR_LRW_V2_CONFIG_BAND_EU868 ||
+	    !g_ctr_lrw_v2_config.dutycycle) {
+		return 0;
+	}
+
+	/* The data rate picked by ADR is not known, assume the fastest one as a lower bound */
+	int datarate = g_ctr_lrw_v2_config.adr ? 5 : g_ctr_lrw_v2_config.datarate;
+
+	return get_time_on_air(datarate, len) * (100 / EU868_DUTYCYCLE_PERCENT - 1);
+}
+
+static int64_t get_backoff(int attempt, size_t len)
+{
+	int64_t backoff = (int64_t)SEND_BACKOFF_BASE_MSEC << MIN(attempt - 1, 16);
+
+	return MAX(MIN(backoff, SEND_BACKOFF_MAX_MSEC), get_off_time(len));
+}
+
+static void hold_send(int64_t delay)
+{
+	m_send_hold_until = MAX(m_send_hold_until, k_uptime_get() + delay);
+}
 
-			k_sleep(K_SECONDS(1));
+static void complete_send(struct send_item *item, int err, struct send_done *done)
+{
+	item->used = false;
+
+	if (err) {
+		LOG_ERR("Operation SEND failed: %d", err);
+	} else {
+		LOG_INF("Operation SEND completed");
+	}
+
+	if (done->count < ARRAY_SIZE(done->events)) {
+		done->events[done->count++] =
+			err ? CTR_LRW_V2_EVENT_SEND_ERR : CTR_LRW_V2_EVENT_SEND_OK;
+	}
+}
+
+/* Called with m_send_lock released */
+static void notify_done(const struct send_done *done)
+{
+	for (size_t i = 0; i < done->count; i++) {
+		notify(done->events[i]);
+	}
+}
+
+static void retry_send(struct send_item *item, int err, struct send_done *done)
+{
+	hold_send(get_backoff(item->attempt, item->data.len));
+
+	if (item->attempt >= item->retries) {
+		complete_send(item, err, done);
+		return;
+	}
+
+	LOG_WRN("Repeating SEND operation in %lld ms (retries left: %d)",
+		m_send_hold_until - k_uptime_get(), item->retries - item->attempt);
+}
+
+static void drop_expired(struct send_done *done)
+{
+	int64_t now = k_uptime_get();
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_send_items); i++) {
+		struct send_item *item = &m_send_items[i];
+
+		if (!item->used || item == m_send_current || !item->data.ttl) {
+			continue;
 		}
 
-		return -ENOMSG;
+		if (now > item->data.ttl) {
+			LOG_WRN("Message TTL expired (seq: %u)", item->seq);
+			complete_send(item, -ETIME, done);
+		}
 	}
+}
 
-	return 0;
+/* Highest priority first, in order of submission within the same priority */
+static struct send_item *get_next(void)
+{
+	struct send_item *next = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_send_items); i++) {
+		struct send_item *item = &m_send_items[i];
+
+		if (!item->used) {
+			continue;
+		}
+
+		if (!next || item->data.priority > next->data.priority ||
+		    (item->data.priority == next->data.priority &&
+		     (int32_t)(item->seq - next->seq) < 0)) {
+			next = item;
+		}
+	}
+
+	return next;
 }
 
-static int send(int retries, k_timeout_t delay, const struct send_msgq_data *data)
+/* Oldest of the lowest priority messages still waiting in the queue */
+static struct send_item *get_victim(void)
+{
+	struct send_item *victim = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_send_items); i++) {
+		struct send_item *item = &m_send_items[i];
+
+		if (!item->used || item == m_send_current) {
+			continue;
+		}
+
+		if (!victim || item->data.priority < victim->data.priority ||
+		    (item->data.priority == victim->data.priority &&
+		     (int32_t)(item->seq - victim->seq) < 0)) {
+			victim = item;
+		}
+	}
+
+	return victim;
+}
+
+static void check_confirmation(struct send_done *done)
+{
+	struct send_item *item = m_send_current;
+
+	uint32_t events = k_event_test(&m_flow_events, EVENT_SEND_OK | EVENT_SEND_ERR);
+
+	if (events & EVENT_SEND_OK) {
+		m_send_current = NULL;
+		complete_send(item, 0, done);
+	} else if (events & EVENT_SEND_ERR) {
+		LOG_WRN("Confirmation not received (seq: %u)", item->seq);
+		m_send_current = NULL;
+		retry_send(item, -EIO, done);
+	} else if (sys_timepoint_expired(m_send_confirm_end)) {
+		LOG_WRN("Confirmation timed out (seq: %u)", item->seq);
+		m_send_current = NULL;
+		retry_send(item, -ETIMEDOUT, done);
+	}
+}
+
+static void send_work_handler(struct k_work *work)
 {
 	int ret;
-	int err = 0;
 
-	LOG_INF("Operation SEND started");
+	struct send_done done = {0};
 
-	while (retries-- > 0) {
-		ret = send_once(data);
-		err = ret;
+	k_mutex_lock(&m_send_lock, K_FOREVER);
 
-		if (ret == 0) {
-			LOG_INF("Operation SEND completed");
+	if (m_send_current) {
+		check_confirmation(&done);
 
-			return 0;
+		if (m_send_current) {
+			k_work_reschedule_for_queue(&m_send_work_q, &m_send_work,
+						    sys_timepoint_timeout(m_send_confirm_end));
+			k_mutex_unlock(&m_send_lock);
+			notify_done(&done);
+			return;
 		}
+	}
 
-		LOG_WRN("Call `send_once` failed: %d", ret);
+	drop_expired(&done);
 
-		if (retries > 0) {
-			k_sleep(delay);
-			LOG_WRN("Repeating SEND operation (retries left: %d)", retries);
-		}
+	struct send_item *item = get_next();
+	if (!item) {
+		k_mutex_unlock(&m_send_lock);
+		notify_done(&done);
+		return;
+	}
+
+	int64_t now = k_uptime_get();
+	if (now < m_send_hold_until) {
+		k_work_reschedule_for_queue(&m_send_work_q, &m_send_work,
+					    K_MSEC(m_send_hold_until - now));
+		k_mutex_unlock(&m_send_lock);
+		notify_done(&done);
+		return;
 	}
 
-	LOG_ERR("Operation SEND failed");
+	item->attempt++;
+	m_send_current = item;
+
+	k_mutex_unlock(&m_send_lock);
+
+	notify_done(&done);
+	done.count = 0;
+
+	LOG_INF("Operation SEND started (seq: %u attempt: %d)", item->seq, item->attempt);
+
+	k_mutex_lock(&m_talk_lock, K_FOREVER);
+	k_event_clear(&m_flow_events, EVENT_SEND_OK | EVENT_SEND_ERR);
+	ret = send_once(&item->data);
+	k_mutex_unlock(&m_talk_lock);
+
+	k_mutex_lock(&m_send_lock, K_FOREVER);
 
-	return err;
+	hold_send(get_off_time(item->data.len));
+
+	if (ret) {
+		LOG_WRN("Call `send_once` failed: %d", ret);
+		m_send_current = NULL;
+		retry_send(item, ret, &done);
+	} else if (item->data.confirmed) {
+		/* Completed by the +ACK/+NOACK URC which reschedules this work */
+		m_send_confirm_end = sys_timepoint_calc(SEND_CONFIRM_TIMEOUT);
+	} else {
+		m_send_current = NULL;
+		complete_send(item, 0, &done);
+	}
+
+	k_work_reschedule_for_queue(&m_send_work_q, &m_send_work, K_NO_WAIT);
+
+	k_mutex_unlock(&m_send_lock);
+
+	notify_done(&done);
 }
 
 int ctr_lrw_v2_flow_set_recv_cb(ctr_lrw_v2_recv_cb callback)
@@ -635,18 +873,24 @@ int ctr_lrw_v2_flow_setup(void)
 		initialized = true;
 	}
 
+	k_mutex_lock(&m_talk_lock, K_FOREVER);
+
 	ret = boot(BOOT_RETRY_COUNT, BOOT_RETRY_DELAY);
 	if (ret) {
 		LOG_ERR("Call `boot` failed: %d", ret);
+		k_mutex_unlock(&m_talk_lock);
 		return ret;
 	}
 
 	ret = setup(SETUP_RETRY_COUNT, SETUP_RETRY_DELAY);
 	if (ret) {
 		LOG_ERR("Call `setup` failed: %d", ret);
+		k_mutex_unlock(&m_talk_lock);
 		return ret;
 	}
 
+	k_mutex_unlock(&m_talk_lock);
+
 	return 0;
 }
 
@@ -654,7 +898,10 @@ int ctr_lrw_v2_flow_join(int retries, k_timeout_t delay)
 {
 	int ret;
 
+	k_mutex_lock(&m_talk_lock, K_FOREVER);
 	ret = join(retries, delay);
+	k_mutex_unlock(&m_talk_lock);
+
 	if (ret) {
 		LOG_ERR("Call `join` failed: %d", ret);
 		return ret;
@@ -663,22 +910,64 @@ int ctr_lrw_v2_flow_join(int retries, k_timeout_t delay)
 	return 0;
 }
 
-int ctr_lrw_v2_flow_send(int retries, k_timeout_t delay, const struct send_msgq_data *data)
+int ctr_lrw_v2_flow_send(int retries, const struct send_msgq_data *data)
 {
-	int ret;
+	if (retries < 1 || data->len < 1 || data->len > SEND_PAYLOAD_MAX_SIZE) {
+		return -EINVAL;
+	}
 
-	ret = send(retries, delay, data);
-	if (ret) {
-		LOG_ERR("Call `send` failed: %d", ret);
-		return ret;
+	struct send_done done = {0};
+
+	k_mutex_lock(&m_send_lock, K_FOREVER);
+
+	struct send_item *item = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_send_items); i++) {
+		if (!m_send_items[i].used) {
+			item = &m_send_items[i];
+			break;
+		}
+	}
+
+	if (!item) {
+		item = get_victim();
+		if (!item || item->data.priority >= data->priority) {
+			LOG_WRN("Send queue full");
+			k_mutex_unlock(&m_send_lock);
+			return -ENOBUFS;
+		}
+
+		LOG_WRN("Evicting message (seq: %u priority: %d)", item->seq, item->data.priority);
+		complete_send(item, -ENOBUFS, &done);
 	}
 
+	item->used = true;
+	item->seq = m_send_seq++;
+	item->attempt = 0;
+	item->retries = retries;
+	item->data = *data;
+	item->data.buf = item->buf;
+	memcpy(item->buf, data->buf, data->len);
+
+	LOG_DBG("Queued message (seq: %u priority: %d len: %u)", item->seq, data->priority,
+		data->len);
+
+	/* Keeps the pending backoff or confirmation deadline if the work is already scheduled */
+	k_work_schedule_for_queue(&m_send_work_q, &m_send_work, K_NO_WAIT);
+
+	k_mutex_unlock(&m_send_lock);
+
+	notify_done(&done);
+
 	return 0;
 }
 
 int ctr_lrw_v2_flow_poll(void)
 {
+	k_mutex_lock(&m_talk_lock, K_FOREVER);
 	int ret = poll_urc();
+	k_mutex_unlock(&m_talk_lock);
+
 	if (ret) {
 		LOG_ERR("Call `poll_urc` failed: %d", ret);
 		return ret;
@@ -757,7 +1046,10 @@ int ctr_lrw_v2_flow_cmd_test_cmd(const struct shell *shell, size_t argc, char **
 		return -EINVAL;
 	}
 
+	k_mutex_lock(&m_talk_lock, K_FOREVER);
 	ret = ctr_lrw_v2_talk_(&m_talk, argv[1]);
+	k_mutex_unlock(&m_talk_lock);
+
 	if (ret) {
 		LOG_ERR("Call `ctr_lrw_v2_talk_` failed: %d", ret);
 		shell_error(shell, "command failed");
@@ -773,6 +1065,10 @@ static int init(void)
 
 	LOG_INF("System initialization");
 
+	k_work_queue_init(&m_send_work_q);
+	k_work_queue_start(&m_send_work_q, m_send_work_q_stack,
+			   K_THREAD_STACK_SIZEOF(m_send_work_q_stack), SEND_WORK_Q_PRIORITY, NULL);
+
 	ret = ctr_lrw_v2_talk_init(&m_talk, dev_lrw_link);
 	if (ret) {
 		LOG_ERR("Call `ctr_lrw_v2_talk_init` failed: %d", ret);
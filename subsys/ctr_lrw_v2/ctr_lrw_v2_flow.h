@@ -21,7 +21,8 @@ int ctr_lrw_v2_flow_reset(void);
 int ctr_lrw_v2_flow_start(void);
 int ctr_lrw_v2_flow_setup(void);
 int ctr_lrw_v2_flow_join(int retries, k_timeout_t timeout);
-int ctr_lrw_v2_flow_send(int retries, k_timeout_t timeout, const struct send_msgq_data *data);
+/* Queues a copy of the message for the send work queue, completion is reported by the event */
+int ctr_lrw_v2_flow_send(int retries, const struct send_msgq_data *data);
 int ctr_lrw_v2_flow_poll(void);
 int ctr_lrw_v2_flow_cmd_test_uart(const struct shell *shell, size_t argc, char **argv);
 int ctr_lrw_v2_flow_cmd_test_reset(const struct shell *shell, size_t argc, char **argv);
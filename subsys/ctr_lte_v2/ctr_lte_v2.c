@@ -680,12 +680,24 @@ static int on_leave_boot(void)
 
 static int on_enter_prepare(void)
 {
-	int ret = ctr_lte_v2_flow_prepare();
+	bool cached;
+	uint32_t start = k_uptime_get_32();
+
+	int ret = ctr_lte_v2_flow_prepare(&cached);
 	if (ret) {
 		LOG_ERR("Call `ctr_lte_v2_flow_prepare` failed: %d", ret);
 		return ret;
 	}
 
+	k_mutex_lock(&m_metrics_lock, K_FOREVER);
+	m_metrics.prepare_count++;
+	if (cached) {
+		m_metrics.prepare_cached_count++;
+	}
+	m_metrics.prepare_last_duration_ms = k_uptime_get_32() - start;
+	m_metrics.prepare_duration_ms += m_metrics.prepare_last_duration_ms;
+	k_mutex_unlock(&m_metrics_lock);
+
 	ret = ctr_lte_v2_flow_cfun(1);
 	if (ret) {
 		LOG_ERR("Call `ctr_lte_v2_flow_cfun` failed: %d", ret);
@@ -739,6 +751,9 @@ static int on_leave_prepare(void)
 
 static int on_enter_reset_loop(void)
 {
+	/* Start over with the full configuration after the modem recovers */
+	ctr_lte_v2_flow_prepare_invalidate();
+
 	int ret = ctr_lte_v2_flow_cfun(4);
 	if (ret) {
 		LOG_ERR("Call `ctr_lte_v2_flow_cfun` 4 failed: %d", ret);
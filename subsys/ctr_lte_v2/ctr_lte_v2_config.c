@@ -249,6 +249,7 @@ int ctr_lte_v2_config_init(void)
 	}
 
 	ctr_config_append_show(SETTINGS_PFX, ctr_lte_v2_config_cmd_show);
+	ctr_config_append_items(m_config_items, ARRAY_SIZE(m_config_items));
 
 	return 0;
 }
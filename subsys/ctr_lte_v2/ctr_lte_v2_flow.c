@@ -26,8 +26,10 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/net/socket_ncs.h>
+#include <zephyr/settings/settings.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/sys/timeutil.h>
 
 /* Standard includes */
@@ -51,6 +53,19 @@ LOG_MODULE_REGISTER(ctr_lte_v2_flow, CONFIG_CTR_LTE_V2_LOG_LEVEL);
 
 #define XRECVFROM_TIMEOUT_SEC 5
 
+#define PREPARE_CACHE_KEY "lte/prepare"
+
+/* Bump whenever the set of cached commands or their fixed parameters change */
+#define PREPARE_CACHE_VERSION 1
+
+/* Modem identity and the configuration last written to its NVM */
+struct prepare_cache {
+	uint32_t version;
+	uint32_t config_hash;
+	uint64_t imei;
+	char xversion[64];
+};
+
 static struct ctr_lte_v2_talk m_talk;
 
 static const struct device *dev_lte_if = DEVICE_DT_GET(DT_CHOSEN(ctr_lte_link));
@@ -70,6 +85,7 @@ static atomic_t m_started;
 static ctr_lte_v2_flow_event_delegate_cb m_event_delegate_cb = NULL;
 static ctr_lte_v2_flow_bypass_cb m_bypass_cb = NULL;
 static void *m_bypass_user_data = NULL;
+static struct prepare_cache m_prepare_cache;
 
 static void process_urc(const char *line)
 {
@@ -255,23 +271,125 @@ static int fill_bands(char *bands)
 	return 0;
 }
 
-int ctr_lte_v2_flow_prepare(void)
+static void prepare_cache_invalidate(void)
 {
 	int ret;
 
-	ret = ctr_lte_v2_talk_at(&m_talk);
+	if (m_prepare_cache.version != PREPARE_CACHE_VERSION) {
+		return;
+	}
+
+	memset(&m_prepare_cache, 0, sizeof(m_prepare_cache));
+
+	ret = settings_delete(PREPARE_CACHE_KEY);
 	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at` failed: %d", ret);
-		return ret;
+		LOG_WRN("Call `settings_delete` failed: %d", ret);
 	}
+}
 
-	if (g_ctr_lte_v2_config.modemtrace) {
-		ret = ctr_lte_v2_talk_at_xmodemtrace(&m_talk);
-		if (ret) {
-			LOG_ERR("Call `ctr_lte_v2_talk_at_xmodemtrace` failed: %d", ret);
-			return ret;
-		}
+static void prepare_cache_save(uint64_t imei, const char *xversion, uint32_t config_hash)
+{
+	int ret;
+
+	memset(&m_prepare_cache, 0, sizeof(m_prepare_cache));
+
+	m_prepare_cache.version = PREPARE_CACHE_VERSION;
+	m_prepare_cache.config_hash = config_hash;
+	m_prepare_cache.imei = imei;
+	strncpy(m_prepare_cache.xversion, xversion, sizeof(m_prepare_cache.xversion) - 1);
+
+	/* Without the persistent copy the next boot merely runs the full sequence */
+	ret = settings_save_one(PREPARE_CACHE_KEY, &m_prepare_cache, sizeof(m_prepare_cache));
+	if (ret) {
+		LOG_WRN("Call `settings_save_one` failed: %d", ret);
 	}
+}
+
+static int prepare_cache_read_cb(const char *key, size_t len, settings_read_cb read_cb,
+				 void *cb_arg, void *param)
+{
+	struct prepare_cache *cache = param;
+
+	if (len != sizeof(*cache)) {
+		return -EINVAL;
+	}
+
+	if (settings_name_next(key, NULL) != 0) {
+		return -EINVAL;
+	}
+
+	if (read_cb(cb_arg, cache, len) < 0) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static void prepare_cache_load(void)
+{
+	int ret;
+
+	struct prepare_cache cache = {0};
+	ret = settings_load_subtree_direct(PREPARE_CACHE_KEY, prepare_cache_read_cb, &cache);
+	if (ret) {
+		LOG_WRN("Call `settings_load_subtree_direct` failed: %d", ret);
+		return;
+	}
+
+	if (cache.version != PREPARE_CACHE_VERSION) {
+		return;
+	}
+
+	cache.xversion[sizeof(cache.xversion) - 1] = '\0';
+
+	memcpy(&m_prepare_cache, &cache, sizeof(m_prepare_cache));
+
+	LOG_INF("Prepare cache loaded (version: %s)", m_prepare_cache.xversion);
+}
+
+/* Terminating zero keeps the neighbouring strings apart */
+static uint32_t hash_str(uint32_t hash, const char *str)
+{
+	return crc32_ieee_update(hash, (const uint8_t *)str, strlen(str) + 1);
+}
+
+/* Covers the parameters of the commands the modem keeps in its NVM */
+static uint32_t get_config_hash(int lte_m_mode, int nb_iot_mode, int gnss_mode, int preference,
+				const char *bands)
+{
+	const int modes[] = {lte_m_mode, nb_iot_mode, gnss_mode, preference,
+			     g_ctr_lte_v2_config.auth};
+
+	uint32_t hash = crc32_ieee((const uint8_t *)modes, sizeof(modes));
+
+	hash = hash_str(hash, bands);
+	hash = hash_str(hash, g_ctr_lte_v2_config.apn);
+	hash = hash_str(hash, g_ctr_lte_v2_config.username);
+	hash = hash_str(hash, g_ctr_lte_v2_config.password);
+
+	return hash;
+}
+
+static int query_xversion(char *xversion, size_t size)
+{
+	int ret;
+
+	ret = ctr_lte_v2_talk_at_xversion(&m_talk, xversion, size);
+	if (ret) {
+		LOG_ERR("Call `ctr_lte_v2_talk_at_xversion` failed: %d", ret);
+		return ret;
+	}
+
+	str_remove_trailin_quotes(xversion);
+
+	LOG_INF("Version: %s", xversion);
+
+	return 0;
+}
+
+static int query_identity(uint64_t *imei, char *xversion, size_t size)
+{
+	int ret;
 
 	char cgsn[64] = {0};
 	ret = ctr_lte_v2_talk_at_cgsn(&m_talk, cgsn, sizeof(cgsn));
@@ -284,7 +402,7 @@ int ctr_lte_v2_flow_prepare(void)
 
 	LOG_INF("CGSN: %s", cgsn);
 
-	ctr_lte_v2_state_set_imei(strtoull(cgsn, NULL, 10));
+	*imei = strtoull(cgsn, NULL, 10);
 
 	char hw_version[64] = {0};
 	ret = ctr_lte_v2_talk_at_hwversion(&m_talk, hw_version, sizeof(hw_version));
@@ -313,17 +431,69 @@ int ctr_lte_v2_flow_prepare(void)
 
 	LOG_INF("SLM version: %s", slm_version);
 
-	char xversion[64] = {0};
-	ret = ctr_lte_v2_talk_at_xversion(&m_talk, xversion, sizeof(xversion));
+	/* Already known when it failed to verify the cache */
+	if (!strlen(xversion)) {
+		ret = query_xversion(xversion, size);
+		if (ret) {
+			LOG_ERR("Call `query_xversion` failed: %d", ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int prepare(bool *cached)
+{
+	int ret;
+
+	ret = ctr_lte_v2_talk_at(&m_talk);
 	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_xversion` failed: %d", ret);
+		LOG_ERR("Call `ctr_lte_v2_talk_at` failed: %d", ret);
 		return ret;
 	}
 
-	str_remove_trailin_quotes(xversion);
+	if (g_ctr_lte_v2_config.modemtrace) {
+		ret = ctr_lte_v2_talk_at_xmodemtrace(&m_talk);
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_xmodemtrace` failed: %d", ret);
+			return ret;
+		}
+	}
 
-	LOG_INF("Version: %s", xversion);
+	bool is_cache_valid = m_prepare_cache.version == PREPARE_CACHE_VERSION;
 
+	uint64_t imei = 0;
+	char xversion[64] = {0};
+
+	/* A single query tells whether the modem is still the one the cache describes */
+	if (is_cache_valid) {
+		ret = query_xversion(xversion, sizeof(xversion));
+		if (ret) {
+			LOG_ERR("Call `query_xversion` failed: %d", ret);
+			return ret;
+		}
+
+		if (strcmp(xversion, m_prepare_cache.xversion)) {
+			LOG_INF("Modem firmware changed, ignoring prepare cache");
+			prepare_cache_invalidate();
+			is_cache_valid = false;
+		}
+	}
+
+	if (is_cache_valid) {
+		imei = m_prepare_cache.imei;
+
+		LOG_INF("CGSN: %llu (cached)", (unsigned long long)imei);
+	} else {
+		ret = query_identity(&imei, xversion, sizeof(xversion));
+		if (ret) {
+			LOG_ERR("Call `query_identity` failed: %d", ret);
+			return ret;
+		}
+	}
+
+	ctr_lte_v2_state_set_imei(imei);
 	ctr_lte_v2_state_set_modem_fw_version(xversion);
 
 	ret = ctr_lte_v2_talk_at_cfun(&m_talk, 0);
@@ -365,36 +535,50 @@ int ctr_lte_v2_flow_prepare(void)
 		preference = pos_let_m < pos_nb_iot ? 1 : 2;
 	}
 
-	ret = ctr_lte_v2_talk_at_xsystemmode(&m_talk, lte_m_mode, nb_iot_mode, gnss_mode,
-					     preference);
-	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_xsystemmode` failed: %d", ret);
-		return ret;
-	}
-
-	ret = ctr_lte_v2_talk_at_xdataprfl(&m_talk, 0);
-	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_xdataprfl` failed: %d", ret);
-		return ret;
-	}
-
-	if (!strlen(g_ctr_lte_v2_config.bands)) {
-		ret = ctr_lte_v2_talk_at_xbandlock(&m_talk, 0, NULL);
-	} else {
-		char bands[] =
-			"00000000000000000000000000000000000000000000000000000000000000000000"
-			"00000000000000000000";
+	char bands[] = "00000000000000000000000000000000000000000000000000000000000000000000"
+		       "00000000000000000000";
 
+	if (strlen(g_ctr_lte_v2_config.bands)) {
 		ret = fill_bands(bands);
 		if (ret) {
 			LOG_ERR("Call `fill_bands` failed: %d", ret);
 			return ret;
 		}
-		ret = ctr_lte_v2_talk_at_xbandlock(&m_talk, 1, bands);
 	}
-	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_xbandlock` failed: %d", ret);
-		return ret;
+
+	uint32_t config_hash = get_config_hash(lte_m_mode, nb_iot_mode, gnss_mode, preference,
+					       strlen(g_ctr_lte_v2_config.bands) ? bands : "");
+
+	/* The modem keeps these settings in its NVM, so they survive the reset */
+	bool apply_config = !is_cache_valid || m_prepare_cache.config_hash != config_hash;
+
+	if (apply_config) {
+		LOG_INF("Applying modem configuration");
+
+		ret = ctr_lte_v2_talk_at_xsystemmode(&m_talk, lte_m_mode, nb_iot_mode, gnss_mode,
+						     preference);
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_xsystemmode` failed: %d", ret);
+			return ret;
+		}
+
+		ret = ctr_lte_v2_talk_at_xdataprfl(&m_talk, 0);
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_xdataprfl` failed: %d", ret);
+			return ret;
+		}
+
+		if (!strlen(g_ctr_lte_v2_config.bands)) {
+			ret = ctr_lte_v2_talk_at_xbandlock(&m_talk, 0, NULL);
+		} else {
+			ret = ctr_lte_v2_talk_at_xbandlock(&m_talk, 1, bands);
+		}
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_xbandlock` failed: %d", ret);
+			return ret;
+		}
+	} else {
+		LOG_INF("Modem configuration unchanged");
 	}
 
 	ret = ctr_lte_v2_talk_at_xsim(&m_talk, 1);
@@ -415,10 +599,12 @@ int ctr_lte_v2_flow_prepare(void)
 		return ret;
 	}
 
-	ret = ctr_lte_v2_talk_at_rel14feat(&m_talk, 1, 1, 1, 1, 0);
-	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_rel14feat` failed: %d", ret);
-		return ret;
+	if (apply_config) {
+		ret = ctr_lte_v2_talk_at_rel14feat(&m_talk, 1, 1, 1, 1, 0);
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_rel14feat` failed: %d", ret);
+			return ret;
+		}
 	}
 
 	/* TODO Make optional */
@@ -428,11 +614,13 @@ int ctr_lte_v2_flow_prepare(void)
 		return ret;
 	}
 
-	/* TODO Configurable? */
-	ret = ctr_lte_v2_talk_at_cpsms(&m_talk, (int[]){1}, "00111000", "00000000");
-	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_cpsms` failed: %d", ret);
-		return ret;
+	if (apply_config) {
+		/* TODO Configurable? */
+		ret = ctr_lte_v2_talk_at_cpsms(&m_talk, (int[]){1}, "00111000", "00000000");
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_cpsms` failed: %d", ret);
+			return ret;
+		}
 	}
 
 	ret = ctr_lte_v2_talk_at_ceppi(&m_talk, 1);
@@ -489,42 +677,80 @@ int ctr_lte_v2_flow_prepare(void)
 		}
 	}
 
-	if (!strlen(g_ctr_lte_v2_config.apn)) {
-		ret = ctr_lte_v2_talk_at_cgdcont(&m_talk, 0, "IP", NULL);
-	} else {
-		ret = ctr_lte_v2_talk_at_cgdcont(&m_talk, 0, "IP", g_ctr_lte_v2_config.apn);
+	if (apply_config) {
+		if (!strlen(g_ctr_lte_v2_config.apn)) {
+			ret = ctr_lte_v2_talk_at_cgdcont(&m_talk, 0, "IP", NULL);
+		} else {
+			ret = ctr_lte_v2_talk_at_cgdcont(&m_talk, 0, "IP", g_ctr_lte_v2_config.apn);
+		}
+		if (ret) {
+			LOG_ERR("Call `ctr_lte_v2_talk_at_cgdcont` failed: %d", ret);
+			return ret;
+		}
+
+		if (g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_PAP ||
+		    g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_CHAP) {
+			int protocol =
+				g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_PAP ? 1 : 2;
+			ret = ctr_lte_v2_talk_at_cgauth(&m_talk, 0, &protocol,
+							g_ctr_lte_v2_config.username,
+							g_ctr_lte_v2_config.password);
+			if (ret) {
+				LOG_ERR("Call `ctr_lte_v2_talk_at_cgauth` failed: %d", ret);
+				return ret;
+			}
+		} else {
+			ret = ctr_lte_v2_talk_at_cgauth(&m_talk, 0, (int[]){0}, NULL, NULL);
+			if (ret) {
+				LOG_ERR("Call `ctr_lte_v2_talk_at_cgauth` failed: %d", ret);
+				return ret;
+			}
+		}
 	}
+
+	ret = ctr_lte_v2_talk_at_xmodemsleep(&m_talk, 1, (int[]){500}, (int[]){10240});
 	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_cgdcont` failed: %d", ret);
+		LOG_ERR("Call `ctr_lte_v2_talk_at_xmodemsleep` failed: %d", ret);
 		return ret;
 	}
 
-	if (g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_PAP ||
-	    g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_CHAP) {
-		int protocol = g_ctr_lte_v2_config.auth == CTR_LTE_V2_CONFIG_AUTH_PAP ? 1 : 2;
-		ret = ctr_lte_v2_talk_at_cgauth(&m_talk, 0, &protocol, g_ctr_lte_v2_config.username,
-						g_ctr_lte_v2_config.password);
-		if (ret) {
-			LOG_ERR("Call `ctr_lte_v2_talk_at_cgauth` failed: %d", ret);
-			return ret;
-		}
-	} else {
-		ret = ctr_lte_v2_talk_at_cgauth(&m_talk, 0, (int[]){0}, NULL, NULL);
+	if (apply_config) {
+		/* The modem writes its NVM on entering CFUN=0, before that a reset loses it */
+		ret = ctr_lte_v2_talk_at_cfun(&m_talk, 0);
 		if (ret) {
-			LOG_ERR("Call `ctr_lte_v2_talk_at_cgauth` failed: %d", ret);
+			LOG_ERR("Call `ctr_lte_v2_talk_at_cfun` failed: %d", ret);
 			return ret;
 		}
+
+		prepare_cache_save(imei, xversion, config_hash);
 	}
 
-	ret = ctr_lte_v2_talk_at_xmodemsleep(&m_talk, 1, (int[]){500}, (int[]){10240});
+	*cached = !apply_config;
+
+	return 0;
+}
+
+int ctr_lte_v2_flow_prepare(bool *cached)
+{
+	int ret;
+
+	*cached = false;
+
+	ret = prepare(cached);
 	if (ret) {
-		LOG_ERR("Call `ctr_lte_v2_talk_at_xmodemsleep` failed: %d", ret);
+		/* The modem state is unknown, so the next prepare runs in full */
+		prepare_cache_invalidate();
 		return ret;
 	}
 
 	return 0;
 }
 
+void ctr_lte_v2_flow_prepare_invalidate(void)
+{
+	prepare_cache_invalidate();
+}
+
 int ctr_lte_v2_flow_cfun(int cfun)
 {
 	int ret;
@@ -1105,6 +1331,8 @@ int ctr_lte_v2_flow_init(ctr_lte_v2_flow_event_delegate_cb cb)
 
 	m_event_delegate_cb = cb;
 
+	prepare_cache_load();
+
 	if (g_ctr_lte_v2_config.test) {
 		LOG_WRN("LTE Test mode enabled, skipping lte link reset");
 	} else {
@@ -1205,6 +1433,9 @@ int ctr_lte_v2_flow_bypass_write(const uint8_t *data, const size_t len)
 		return -ENOTCONN;
 	}
 
+	/* Raw commands may change the modem configuration behind the cache */
+	prepare_cache_invalidate();
+
 	int ret = ctr_lte_link_send_data(dev_lte_if, K_SECONDS(1), data, len);
 	if (ret) {
 		LOG_ERR("Call `ctr_lte_link_send_data` failed: %d", ret);
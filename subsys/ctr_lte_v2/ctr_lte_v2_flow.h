@@ -61,7 +61,9 @@ int ctr_lte_v2_flow_enable(bool wakeup);
 int ctr_lte_v2_flow_disable(bool send_sleep);
 int ctr_lte_v2_flow_reset(void);
 
-int ctr_lte_v2_flow_prepare(void);
+/* Sets cached when the modem identity and configuration were reused instead of queried/applied */
+int ctr_lte_v2_flow_prepare(bool *cached);
+void ctr_lte_v2_flow_prepare_invalidate(void);
 int ctr_lte_v2_flow_cfun(int cfun);
 int ctr_lte_v2_flow_sim_info(void);
 int ctr_lte_v2_flow_sim_fplmn(void);
@@ -10,8 +10,11 @@
 
 /* CHESTER includes */
 #include <chester/ctr_lte_v2.h>
+#include <chester/drivers/ctr_lte_link.h>
 
 /* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/shell/shell.h>
@@ -25,6 +28,8 @@
 
 LOG_MODULE_REGISTER(ctr_lte_v2_shell, CONFIG_CTR_LTE_V2_LOG_LEVEL);
 
+static const struct device *dev_lte_if = DEVICE_DT_GET(DT_CHOSEN(ctr_lte_link));
+
 static int cmd_imei(const struct shell *shell, size_t argc, char **argv)
 {
 	int ret;
@@ -234,6 +239,21 @@ static int cmd_metrics(const struct shell *shell, size_t argc, char **argv)
 	shell_print(shell, "cscon 1 duration ms: %u", metrics.cscon_1_duration_ms);
 	shell_print(shell, "cscon 1 last duration ms: %u", metrics.cscon_1_last_duration_ms);
 
+	shell_print(shell, "prepare count: %u", metrics.prepare_count);
+	shell_print(shell, "prepare cached count: %u", metrics.prepare_cached_count);
+	shell_print(shell, "prepare duration ms: %u", metrics.prepare_duration_ms);
+	shell_print(shell, "prepare last duration ms: %u", metrics.prepare_last_duration_ms);
+
+	struct ctr_lte_link_stats stats;
+	ret = ctr_lte_link_get_stats(dev_lte_if, &stats);
+	if (!ret) {
+		shell_print(shell, "link rx bytes: %u", stats.rx_bytes);
+		shell_print(shell, "link rx lines: %u", stats.rx_lines);
+		shell_print(shell, "link rx drops: %u", stats.rx_drops);
+		shell_print(shell, "link rx pool max: %u", stats.rx_pool_max);
+		shell_print(shell, "link rx heap max: %u", stats.rx_heap_max);
+	}
+
 	shell_print(shell, "command succeeded");
 
 	return 0;
@@ -354,13 +374,16 @@ static int cmd_test_prepare(const struct shell *shell, size_t argc, char **argv)
 		return -ENOEXEC;
 	}
 
-	ret = ctr_lte_v2_flow_prepare();
+	bool cached;
+	ret = ctr_lte_v2_flow_prepare(&cached);
 	if (ret) {
 		LOG_ERR("Call `ctr_lte_v2_flow_prepare` failed: %d", ret);
 		shell_error(shell, "command failed");
 		return ret;
 	}
 
+	shell_print(shell, "cached: %s", cached ? "yes" : "no");
+
 	return 0;
 }
 
@@ -379,6 +402,9 @@ static int cmd_test_cmd(const struct shell *shell, size_t argc, char **argv)
 		return -ENOEXEC;
 	}
 
+	/* The command may change the modem configuration behind the prepare cache */
+	ctr_lte_v2_flow_prepare_invalidate();
+
 	ret = ctr_lte_v2_flow_cmd_without_response(argv[1]);
 	if (ret) {
 		if (ret == -ENOTCONN) {
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_pulse_backend.h"
+
+/* CHESTER includes */
+#include <chester/ctr_pulse.h>
+
+/* Zephyr includes */
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+LOG_MODULE_REGISTER(ctr_pulse, CONFIG_CTR_PULSE_LOG_LEVEL);
+
+/* Extend the 32-bit hardware count to 64 bits */
+static void accumulate(struct ctr_pulse *pulse)
+{
+	uint32_t raw = ctr_pulse_backend_capture(pulse);
+
+	pulse->count += (uint32_t)(raw - pulse->last_raw);
+	pulse->last_raw = raw;
+}
+
+static void arm(struct ctr_pulse *pulse)
+{
+	if (!pulse->is_running || !pulse->threshold || !pulse->cb) {
+		ctr_pulse_backend_set_compare(pulse, 0, false);
+		return;
+	}
+
+	ctr_pulse_backend_set_compare(pulse, pulse->last_raw + pulse->threshold, true);
+
+	/* The compare event is only generated on an exact match - catch up if the threshold was
+	 * crossed while the compare value was being written */
+	uint32_t raw = ctr_pulse_backend_capture(pulse);
+	if ((uint32_t)(raw - pulse->last_raw) >= pulse->threshold) {
+		k_work_submit(&pulse->threshold_work);
+	}
+}
+
+static void threshold_work_handler(struct k_work *work)
+{
+	struct ctr_pulse *pulse = CONTAINER_OF(work, struct ctr_pulse, threshold_work);
+
+	k_mutex_lock(&pulse->lock, K_FOREVER);
+
+	if (!pulse->is_running) {
+		k_mutex_unlock(&pulse->lock);
+		return;
+	}
+
+	accumulate(pulse);
+	arm(pulse);
+
+	if (pulse->cb) {
+		pulse->cb(pulse, pulse->count, pulse->user_data);
+	}
+
+	k_mutex_unlock(&pulse->lock);
+}
+
+void ctr_pulse_backend_compare_handler(struct ctr_pulse *pulse)
+{
+	k_work_submit(&pulse->threshold_work);
+}
+
+int ctr_pulse_init(struct ctr_pulse *pulse, const struct gpio_dt_spec *spec,
+		   enum ctr_pulse_edge edge, int holdoff_us)
+{
+	int ret;
+
+	if (holdoff_us < 0) {
+		return -EINVAL;
+	}
+
+	pulse->spec = spec;
+	pulse->edge = edge;
+	pulse->holdoff_us = holdoff_us;
+	pulse->threshold = 0;
+	pulse->cb = NULL;
+	pulse->user_data = NULL;
+	pulse->is_running = false;
+	pulse->count = 0;
+	pulse->slot = -1;
+	pulse->holdoff_slot = -1;
+
+	k_mutex_init(&pulse->lock);
+	k_work_init(&pulse->threshold_work, threshold_work_handler);
+
+	ret = ctr_pulse_backend_init(pulse);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_backend_init` failed: %d", ret);
+		return ret;
+	}
+
+	pulse->last_raw = ctr_pulse_backend_capture(pulse);
+
+	return 0;
+}
+
+int ctr_pulse_set_callback(struct ctr_pulse *pulse, uint32_t threshold, ctr_pulse_cb_t cb,
+			   void *user_data)
+{
+	k_mutex_lock(&pulse->lock, K_FOREVER);
+
+	pulse->threshold = threshold;
+	pulse->cb = cb;
+	pulse->user_data = user_data;
+
+	accumulate(pulse);
+	arm(pulse);
+
+	k_mutex_unlock(&pulse->lock);
+
+	return 0;
+}
+
+int ctr_pulse_start(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	k_mutex_lock(&pulse->lock, K_FOREVER);
+
+	if (pulse->is_running) {
+		k_mutex_unlock(&pulse->lock);
+		return 0;
+	}
+
+	accumulate(pulse);
+
+	ret = ctr_pulse_backend_start(pulse);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_backend_start` failed: %d", ret);
+		k_mutex_unlock(&pulse->lock);
+		return ret;
+	}
+
+	pulse->is_running = true;
+
+	arm(pulse);
+
+	k_mutex_unlock(&pulse->lock);
+
+	return 0;
+}
+
+int ctr_pulse_stop(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	k_mutex_lock(&pulse->lock, K_FOREVER);
+
+	if (!pulse->is_running) {
+		k_mutex_unlock(&pulse->lock);
+		return 0;
+	}
+
+	ret = ctr_pulse_backend_stop(pulse);
+	if (ret) {
+		LOG_ERR("Call `ctr_pulse_backend_stop` failed: %d", ret);
+		k_mutex_unlock(&pulse->lock);
+		return ret;
+	}
+
+	pulse->is_running = false;
+
+	accumulate(pulse);
+	arm(pulse);
+
+	k_mutex_unlock(&pulse->lock);
+
+	return 0;
+}
+
+int ctr_pulse_read(struct ctr_pulse *pulse, uint64_t *count)
+{
+	k_mutex_lock(&pulse->lock, K_FOREVER);
+
+	accumulate(pulse);
+	*count = pulse->count;
+
+	k_mutex_unlock(&pulse->lock);
+
+	return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_PULSE_BACKEND_H_
+#define CHESTER_SUBSYS_CTR_PULSE_BACKEND_H_
+
+/* CHESTER includes */
+#include <chester/ctr_pulse.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int ctr_pulse_backend_init(struct ctr_pulse *pulse);
+int ctr_pulse_backend_start(struct ctr_pulse *pulse);
+int ctr_pulse_backend_stop(struct ctr_pulse *pulse);
+
+/* Free running 32-bit raw count */
+uint32_t ctr_pulse_backend_capture(struct ctr_pulse *pulse);
+void ctr_pulse_backend_set_compare(struct ctr_pulse *pulse, uint32_t raw, bool enable);
+
+/* Called by the backend from interrupt context once the raw count reaches the compare value */
+void ctr_pulse_backend_compare_handler(struct ctr_pulse *pulse);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_PULSE_BACKEND_H_ */
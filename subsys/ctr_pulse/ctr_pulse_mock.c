@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_pulse_backend.h"
+
+/* CHESTER includes */
+#include <chester/ctr_pulse.h>
+
+/* Zephyr includes */
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+LOG_MODULE_DECLARE(ctr_pulse, CONFIG_CTR_PULSE_LOG_LEVEL);
+
+int ctr_pulse_backend_init(struct ctr_pulse *pulse)
+{
+	pulse->mock_raw = 0;
+	pulse->mock_compare = 0;
+	pulse->mock_compare_enabled = false;
+
+	return 0;
+}
+
+int ctr_pulse_backend_start(struct ctr_pulse *pulse)
+{
+	return 0;
+}
+
+int ctr_pulse_backend_stop(struct ctr_pulse *pulse)
+{
+	return 0;
+}
+
+uint32_t ctr_pulse_backend_capture(struct ctr_pulse *pulse)
+{
+	unsigned int key = irq_lock();
+	uint32_t raw = pulse->mock_raw;
+	irq_unlock(key);
+
+	return raw;
+}
+
+void ctr_pulse_backend_set_compare(struct ctr_pulse *pulse, uint32_t raw, bool enable)
+{
+	unsigned int key = irq_lock();
+	pulse->mock_compare = raw;
+	pulse->mock_compare_enabled = enable;
+	irq_unlock(key);
+}
+
+void ctr_pulse_mock_inject(struct ctr_pulse *pulse, uint32_t pulses)
+{
+	/* Pulses on a stopped counter are lost the same way as with a halted TIMER */
+	if (!pulse->is_running || !pulses) {
+		return;
+	}
+
+	unsigned int key = irq_lock();
+
+	uint32_t from = pulse->mock_raw;
+	pulse->mock_raw += pulses;
+
+	/* The compare value is matched when it lies in (from, from + pulses] */
+	bool match = pulse->mock_compare_enabled &&
+		     (uint32_t)(pulse->mock_compare - from - 1) < pulses;
+
+	irq_unlock(key);
+
+	if (match) {
+		ctr_pulse_backend_compare_handler(pulse);
+	}
+}
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_pulse_backend.h"
+
+/* CHESTER includes */
+#include <chester/ctr_pulse.h>
+
+/* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+/* NRFX includes */
+#include <hal/nrf_gpio.h>
+#include <hal/nrf_timer.h>
+#include <helpers/nrfx_gppi.h>
+#include <nrfx_gpiote.h>
+#include <nrfx_timer.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+LOG_MODULE_DECLARE(ctr_pulse, CONFIG_CTR_PULSE_LOG_LEVEL);
+
+/*
+ * Counting:  GPIOTE IN --PPI--> TIMER (counter mode) COUNT
+ *
+ * With hold-off: GPIOTE IN --PPI--> hold-off TIMER CLEAR + START
+ *                hold-off TIMER COMPARE0 (short to STOP) --PPI--> TIMER COUNT
+ *
+ * Every edge restarts the hold-off, so a burst of edges shorter than the hold-off is counted once
+ * after the input settles. CC0 of the counting TIMER is used for readout, CC1 for the threshold.
+ */
+
+#define CC_CAPTURE   NRF_TIMER_CC_CHANNEL0
+#define CC_THRESHOLD NRF_TIMER_CC_CHANNEL1
+
+#define HOLDOFF_FREQUENCY_HZ 1000000
+
+#define TIMER_DEFINE(n) static nrfx_timer_t m_timer_##n = NRFX_TIMER_INSTANCE(n);
+
+#if defined(CONFIG_CTR_PULSE_TIMER1)
+TIMER_DEFINE(1)
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER2)
+TIMER_DEFINE(2)
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER3)
+TIMER_DEFINE(3)
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER4)
+TIMER_DEFINE(4)
+#endif
+
+struct slot {
+	nrfx_timer_t *timer;
+	struct ctr_pulse *owner;
+	uint8_t gpiote_channel;
+	nrfx_gppi_handle_t gppi_edge;
+	nrfx_gppi_handle_t gppi_holdoff;
+};
+
+static struct slot m_slots[] = {
+#if defined(CONFIG_CTR_PULSE_TIMER1)
+	{.timer = &m_timer_1},
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER2)
+	{.timer = &m_timer_2},
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER3)
+	{.timer = &m_timer_3},
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER4)
+	{.timer = &m_timer_4},
+#endif
+};
+
+static nrfx_gpiote_t m_gpiote = NRFX_GPIOTE_INSTANCE(0);
+
+static K_MUTEX_DEFINE(m_slots_lock);
+
+static bool m_irq_connected;
+
+static void connect_irqs(void)
+{
+	if (m_irq_connected) {
+		return;
+	}
+
+#if defined(CONFIG_CTR_PULSE_TIMER1)
+	IRQ_CONNECT(TIMER1_IRQn, CONFIG_CTR_PULSE_IRQ_PRIORITY, nrfx_timer_irq_handler, &m_timer_1,
+		    0);
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER2)
+	IRQ_CONNECT(TIMER2_IRQn, CONFIG_CTR_PULSE_IRQ_PRIORITY, nrfx_timer_irq_handler, &m_timer_2,
+		    0);
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER3)
+	IRQ_CONNECT(TIMER3_IRQn, CONFIG_CTR_PULSE_IRQ_PRIORITY, nrfx_timer_irq_handler, &m_timer_3,
+		    0);
+#endif
+#if defined(CONFIG_CTR_PULSE_TIMER4)
+	IRQ_CONNECT(TIMER4_IRQn, CONFIG_CTR_PULSE_IRQ_PRIORITY, nrfx_timer_irq_handler, &m_timer_4,
+		    0);
+#endif
+
+	m_irq_connected = true;
+}
+
+static int slot_alloc(struct ctr_pulse *pulse)
+{
+	for (int i = 0; i < ARRAY_SIZE(m_slots); i++) {
+		if (!m_slots[i].owner) {
+			m_slots[i].owner = pulse;
+			return i;
+		}
+	}
+
+	return -ENOSPC;
+}
+
+static void slot_free(struct ctr_pulse *pulse)
+{
+	k_mutex_lock(&m_slots_lock, K_FOREVER);
+
+	if (pulse->holdoff_slot >= 0) {
+		m_slots[pulse->holdoff_slot].owner = NULL;
+		pulse->holdoff_slot = -1;
+	}
+
+	if (pulse->slot >= 0) {
+		m_slots[pulse->slot].owner = NULL;
+		pulse->slot = -1;
+	}
+
+	k_mutex_unlock(&m_slots_lock);
+}
+
+static void timer_event_handler(nrf_timer_event_t event_type, void *p_context)
+{
+	struct ctr_pulse *pulse = p_context;
+
+	if (event_type == nrf_timer_compare_event_get(CC_THRESHOLD)) {
+		ctr_pulse_backend_compare_handler(pulse);
+	}
+}
+
+static uint32_t get_pin(const struct gpio_dt_spec *spec)
+{
+#if DT_NODE_HAS_STATUS(DT_NODELABEL(gpio1), okay)
+	if (spec->port == DEVICE_DT_GET(DT_NODELABEL(gpio1))) {
+		return NRF_GPIO_PIN_MAP(1, spec->pin);
+	}
+#endif /* DT_NODE_HAS_STATUS(DT_NODELABEL(gpio1), okay) */
+
+	return NRF_GPIO_PIN_MAP(0, spec->pin);
+}
+
+static int setup_counter(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	nrfx_timer_t *timer = m_slots[pulse->slot].timer;
+
+	uint32_t base_frequency = NRF_TIMER_BASE_FREQUENCY_GET(timer->p_reg);
+	nrfx_timer_config_t timer_config = NRFX_TIMER_DEFAULT_CONFIG(base_frequency);
+	timer_config.mode = NRF_TIMER_MODE_LOW_POWER_COUNTER;
+	timer_config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+	timer_config.p_context = pulse;
+
+	ret = nrfx_timer_init(timer, &timer_config, timer_event_handler);
+	if (ret) {
+		LOG_ERR("Call `nrfx_timer_init` failed: %d", ret);
+		return ret;
+	}
+
+	nrfx_timer_clear(timer);
+
+	/* Counts only on COUNT tasks, so it is left running - start/stop gate the PPI instead */
+	nrfx_timer_enable(timer);
+
+	return 0;
+}
+
+static int setup_holdoff(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	nrfx_timer_t *timer = m_slots[pulse->holdoff_slot].timer;
+
+	nrfx_timer_config_t timer_config = NRFX_TIMER_DEFAULT_CONFIG(HOLDOFF_FREQUENCY_HZ);
+	timer_config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+	ret = nrfx_timer_init(timer, &timer_config, NULL);
+	if (ret) {
+		LOG_ERR("Call `nrfx_timer_init` failed: %d", ret);
+		return ret;
+	}
+
+	/* One-shot - the timer stops itself once the input has been stable for the hold-off */
+	nrfx_timer_extended_compare(timer, NRF_TIMER_CC_CHANNEL0,
+				    nrfx_timer_us_to_ticks(timer, pulse->holdoff_us),
+				    NRF_TIMER_SHORT_COMPARE0_STOP_MASK, false);
+
+	return 0;
+}
+
+static int setup_gpiote(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	struct slot *slot = &m_slots[pulse->slot];
+
+	ret = nrfx_gpiote_channel_alloc(&m_gpiote, &slot->gpiote_channel);
+	if (ret) {
+		LOG_ERR("Call `nrfx_gpiote_channel_alloc` failed: %d", ret);
+		return ret;
+	}
+
+	nrfx_gpiote_trigger_t trigger = NRFX_GPIOTE_TRIGGER_TOGGLE;
+
+	if (pulse->edge == CTR_PULSE_EDGE_RISING) {
+		trigger = NRFX_GPIOTE_TRIGGER_LOTOHI;
+	} else if (pulse->edge == CTR_PULSE_EDGE_FALLING) {
+		trigger = NRFX_GPIOTE_TRIGGER_HITOLO;
+	}
+
+	/* No handler - the event is only routed over PPI */
+	ret = nrfx_gpiote_input_configure(&m_gpiote, get_pin(pulse->spec),
+					  &(nrfx_gpiote_input_pin_config_t){
+						  .p_trigger_config =
+							  &(nrfx_gpiote_trigger_config_t){
+								  .trigger = trigger,
+								  .p_in_channel =
+									  &slot->gpiote_channel,
+							  },
+					  });
+	if (ret) {
+		LOG_ERR("Call `nrfx_gpiote_input_configure` failed: %d", ret);
+		nrfx_gpiote_channel_free(&m_gpiote, slot->gpiote_channel);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int setup_ppi(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	struct slot *slot = &m_slots[pulse->slot];
+
+	uint32_t edge_event = nrfx_gpiote_in_event_address_get(&m_gpiote, get_pin(pulse->spec));
+	uint32_t count_task = nrfx_timer_task_address_get(slot->timer, NRF_TIMER_TASK_COUNT);
+
+	if (pulse->holdoff_slot < 0) {
+		ret = nrfx_gppi_conn_alloc(edge_event, count_task, &slot->gppi_edge);
+		if (ret) {
+			LOG_ERR("Call `nrfx_gppi_conn_alloc` failed: %d", ret);
+			return ret;
+		}
+
+		return 0;
+	}
+
+	nrfx_timer_t *holdoff = m_slots[pulse->holdoff_slot].timer;
+	uint32_t clear_task = nrfx_timer_task_address_get(holdoff, NRF_TIMER_TASK_CLEAR);
+
+	ret = nrfx_gppi_conn_alloc(edge_event, clear_task, &slot->gppi_edge);
+	if (ret) {
+		LOG_ERR("Call `nrfx_gppi_conn_alloc` failed: %d", ret);
+		return ret;
+	}
+
+	ret = nrfx_gppi_ep_attach(nrfx_timer_task_address_get(holdoff, NRF_TIMER_TASK_START),
+				  slot->gppi_edge);
+	if (ret) {
+		LOG_ERR("Call `nrfx_gppi_ep_attach` failed: %d", ret);
+		nrfx_gppi_conn_free(edge_event, clear_task, slot->gppi_edge);
+		return ret;
+	}
+
+	ret = nrfx_gppi_conn_alloc(nrfx_timer_event_address_get(holdoff, NRF_TIMER_EVENT_COMPARE0),
+				   count_task, &slot->gppi_holdoff);
+	if (ret) {
+		LOG_ERR("Call `nrfx_gppi_conn_alloc` failed: %d", ret);
+		nrfx_gppi_conn_free(edge_event, clear_task, slot->gppi_edge);
+		return ret;
+	}
+
+	return 0;
+}
+
+int ctr_pulse_backend_init(struct ctr_pulse *pulse)
+{
+	int ret;
+
+	k_mutex_lock(&m_slots_lock, K_FOREVER);
+
+	connect_irqs();
+
+	pulse->slot = slot_alloc(pulse);
+	if (pulse->slot < 0) {
+		LOG_ERR("No TIMER instance left for counting");
+		k_mutex_unlock(&m_slots_lock);
+		return -ENOSPC;
+	}
+
+	if (pulse->holdoff_us) {
+		pulse->holdoff_slot = slot_alloc(pulse);
+		if (pulse->holdoff_slot < 0) {
+			LOG_ERR("No TIMER instance left for hold-off");
+			k_mutex_unlock(&m_slots_lock);
+			slot_free(pulse);
+			return -ENOSPC;
+		}
+	}
+
+	k_mutex_unlock(&m_slots_lock);
+
+	/* On failure everything set up so far is released, so the TIMER instances and the GPIOTE
+	 * channel can be used by another counter */
+	ret = setup_counter(pulse);
+	if (ret) {
+		goto error_slot;
+	}
+
+	if (pulse->holdoff_slot >= 0) {
+		ret = setup_holdoff(pulse);
+		if (ret) {
+			goto error_counter;
+		}
+	}
+
+	ret = setup_gpiote(pulse);
+	if (ret) {
+		goto error_holdoff;
+	}
+
+	ret = setup_ppi(pulse);
+	if (ret) {
+		goto error_gpiote;
+	}
+
+	return 0;
+
+error_gpiote:
+	nrfx_gpiote_pin_uninit(&m_gpiote, get_pin(pulse->spec));
+	nrfx_gpiote_channel_free(&m_gpiote, m_slots[pulse->slot].gpiote_channel);
+
+error_holdoff:
+	if (pulse->holdoff_slot >= 0) {
+		nrfx_timer_uninit(m_slots[pulse->holdoff_slot].timer);
+	}
+
+error_counter:
+	nrfx_timer_uninit(m_slots[pulse->slot].timer);
+
+error_slot:
+	slot_free(pulse);
+
+	return ret;
+}
+
+int ctr_pulse_backend_start(struct ctr_pulse *pulse)
+{
+	struct slot *slot = &m_slots[pulse->slot];
+
+	/* The hold-off TIMER itself is started by the edge over PPI */
+	if (pulse->holdoff_slot >= 0) {
+		nrfx_gppi_conn_enable(slot->gppi_holdoff);
+	}
+
+	nrfx_gppi_conn_enable(slot->gppi_edge);
+	nrfx_gpiote_trigger_enable(&m_gpiote, get_pin(pulse->spec), false);
+
+	return 0;
+}
+
+int ctr_pulse_backend_stop(struct ctr_pulse *pulse)
+{
+	struct slot *slot = &m_slots[pulse->slot];
+
+	nrfx_gpiote_trigger_disable(&m_gpiote, get_pin(pulse->spec));
+	nrfx_gppi_conn_disable(slot->gppi_edge);
+
+	if (pulse->holdoff_slot >= 0) {
+		nrfx_gppi_conn_disable(slot->gppi_holdoff);
+		nrf_timer_task_trigger(m_slots[pulse->holdoff_slot].timer->p_reg,
+				       NRF_TIMER_TASK_STOP);
+	}
+
+	return 0;
+}
+
+uint32_t ctr_pulse_backend_capture(struct ctr_pulse *pulse)
+{
+	return nrfx_timer_capture(m_slots[pulse->slot].timer, CC_CAPTURE);
+}
+
+void ctr_pulse_backend_set_compare(struct ctr_pulse *pulse, uint32_t raw, bool enable)
+{
+	nrfx_timer_t *timer = m_slots[pulse->slot].timer;
+
+	if (!enable) {
+		nrfx_timer_compare_int_disable(timer, CC_THRESHOLD);
+		return;
+	}
+
+	nrfx_timer_compare(timer, CC_THRESHOLD, raw, true);
+}
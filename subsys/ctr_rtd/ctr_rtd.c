@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
  */
 
+#include "ctr_rtd_conv.h"
+
 /* CHESTER includes */
 #include <chester/ctr_rtd.h>
 #include <chester/drivers/ctr_x3.h>
@@ -23,23 +25,10 @@
 
 LOG_MODULE_REGISTER(ctr_rtd, CONFIG_CTR_RTD_LOG_LEVEL);
 
-#define R0_PT100     100.0
-#define R_MIN_PT100  4.0
-#define R_MAX_PT100  400.0
-#define R_MIN_PT1000 40.0
-#define R_MAX_PT1000 4000.0
-#define R0_PT1000    1000.0
-#define R_REF        1800.0
-#define ADC_GAIN     1
-#define A_ITS_90     3.9083e-3
-#define B_ITS_90     -5.775e-7
-#define A_IPTS_68    3.90802e-3
-#define B_IPTS_68    -5.80195e-7
-
-static double convert_r_to_t(double r, double r0, double a, double b)
-{
-	return (-r0 * a + sqrt(r0 * r0 * a * a - 4 * r0 * b * (r0 - r))) / (2 * r0 * b);
-}
+#define R0_PT100  100.f
+#define R0_PT1000 1000.f
+#define R_REF     1800.f
+#define ADC_GAIN  1
 
 int ctr_rtd_read(enum ctr_rtd_channel channel, enum ctr_rtd_type type, float *temperature)
 {
@@ -79,20 +68,14 @@ int ctr_rtd_read(enum ctr_rtd_channel channel, enum ctr_rtd_type type, float *te
 		return -ENODEV;
 	}
 
-	double r0;
-	double r_min;
-	double r_max;
+	float r0;
 
 	switch (type) {
 	case CTR_RTD_TYPE_PT100:
 		r0 = R0_PT100;
-		r_min = R_MIN_PT100;
-		r_max = R_MAX_PT100;
 		break;
 	case CTR_RTD_TYPE_PT1000:
 		r0 = R0_PT1000;
-		r_min = R_MIN_PT1000;
-		r_max = R_MAX_PT1000;
 		break;
 	default:
 		LOG_ERR("Unknown type: %d", type);
@@ -106,16 +89,16 @@ int ctr_rtd_read(enum ctr_rtd_channel channel, enum ctr_rtd_type type, float *te
 		return ret;
 	}
 
-	double r_rtd = R_REF * ((double)result / (ADC_GAIN * pow(2, 23)));
+	float r_rtd = R_REF * ((float)result / (ADC_GAIN * (1 << 23)));
 
-	if (r_rtd < r_min || r_rtd > r_max) {
-		LOG_WRN("Resistance out of range");
-		return -ERANGE;
+	ret = ctr_rtd_conv_temperature(r_rtd / r0, temperature);
+	if (ret) {
+		LOG_WRN("Resistance out of range: %.3f Ohm", (double)r_rtd);
+		return ret;
 	}
 
-	*temperature = convert_r_to_t(r_rtd, r0, A_ITS_90, B_ITS_90);
-
-	LOG_INF("Raw: %" PRId32 "; R: %.3f Ohm; T: %.3f C", result, r_rtd, (double)*temperature);
+	LOG_INF("Raw: %" PRId32 "; R: %.3f Ohm; T: %.3f C", result, (double)r_rtd,
+		(double)*temperature);
 
 	return 0;
 }
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_rtd_conv.h"
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+
+/* Callendar-Van Dusen coefficients (ITS-90) - C applies below 0 °C only */
+#define CVD_A 3.9083e-3f
+#define CVD_B -5.775e-7f
+#define CVD_C -4.183e-12f
+
+#define T_MIN     -200.f
+#define T_MAX     850.f
+#define RATIO_MIN 0.1852008f
+#define RATIO_MAX 3.9048113f
+
+/* The quadratic root is within 3 °C of the sub-zero solution, two Newton steps settle it */
+#define NEWTON_ITERATIONS 2
+
+int ctr_rtd_conv_ratio(float temperature, float *ratio)
+{
+	if (!(temperature >= T_MIN && temperature <= T_MAX)) {
+		return -ERANGE;
+	}
+
+	float t = temperature;
+	float x = t * (CVD_A + CVD_B * t);
+
+	if (t < 0.f) {
+		x += CVD_C * (t - 100.f) * t * t * t;
+	}
+
+	*ratio = 1.f + x;
+
+	return 0;
+}
+
+int ctr_rtd_conv_temperature(float ratio, float *temperature)
+{
+	if (!(ratio >= RATIO_MIN && ratio <= RATIO_MAX)) {
+		return -ERANGE;
+	}
+
+	float x = ratio - 1.f;
+
+	/* Root of B * t^2 + A * t - x = 0 in the form that does not cancel around 0 °C */
+	float t = 2.f * x / (CVD_A + sqrtf(CVD_A * CVD_A + 4.f * CVD_B * x));
+
+	if (x < 0.f) {
+		for (int i = 0; i < NEWTON_ITERATIONS; i++) {
+			float t2 = t * t;
+			float f = t * (CVD_A + CVD_B * t) + CVD_C * (t - 100.f) * t2 * t - x;
+			float df = CVD_A + 2.f * CVD_B * t + CVD_C * (4.f * t - 300.f) * t2;
+
+			t -= f / df;
+		}
+	}
+
+	*temperature = t;
+
+	return 0;
+}
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_RTD_CTR_RTD_CONV_H_
+#define CHESTER_SUBSYS_CTR_RTD_CTR_RTD_CONV_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Resistance ratio R(t) / R0 of a platinum RTD (IEC 60751, -200 to 850 °C) */
+int ctr_rtd_conv_ratio(float temperature, float *ratio);
+
+/* Temperature of a platinum RTD with the given resistance ratio R / R0 */
+int ctr_rtd_conv_temperature(float ratio, float *temperature);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_RTD_CTR_RTD_CONV_H_ */
@@ -5,6 +5,7 @@
  */
 
 /* CHESTER includes */
+#include <chester/ctr_sps30.h>
 #include <chester/drivers/sensor/sps30.h>
 #include <chester/drivers/ctr_x0.h>
 
@@ -16,16 +17,41 @@
 #include <zephyr/logging/log.h>
 
 /* Standard includes */
-#include <stddef.h>
 #include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(ctr_sps30, CONFIG_CTR_SPS30_LOG_LEVEL);
 
+#define POWER_SETTLE_TIME K_MSEC(1000)
+#define WARM_UP_TIME      K_MSEC(15000)
+/* The sensor updates its measurement once per second */
+#define READING_INTERVAL  K_MSEC(1000)
+
+enum state {
+	STATE_OFF = 0,
+	STATE_SETTLE,
+	STATE_WARM_UP,
+	STATE_READY,
+};
+
 static K_MUTEX_DEFINE(m_mut);
 
 static const struct device *m_sens_dev = DEVICE_DT_GET(DT_NODELABEL(sps30_ext));
 static const struct device *m_x0_dev = DEVICE_DT_GET(DT_NODELABEL(ctr_x0_a));
 
+static enum state m_state;
+static bool m_continuous;
+
+static ctr_sps30_read_cb m_cb;
+static void *m_user_data;
+static int m_readings;
+static struct ctr_sps30_data m_sum;
+
+static void work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(m_work, work_handler);
+
 static int power_on()
 {
 	int ret = ctr_x0_set_mode(m_x0_dev, CTR_X0_CHANNEL_1, CTR_X0_MODE_PWR_SOURCE);
@@ -34,19 +60,18 @@ static int power_on()
 		return ret;
 	}
 
-	k_sleep(K_MSEC(1000));
-
-	ret = sps30_power_on_init(m_sens_dev);
-	if (ret) {
-		LOG_ERR("Call `sps30_power_on_init` failed: %d", ret);
-		return ret;
-	}
+	m_state = STATE_SETTLE;
+	k_work_reschedule(&m_work, POWER_SETTLE_TIME);
 
 	return 0;
 }
 
 static int power_off()
 {
+	k_work_cancel_delayable(&m_work);
+
+	m_state = STATE_OFF;
+
 	int ret = ctr_x0_set_mode(m_x0_dev, CTR_X0_CHANNEL_1, CTR_X0_MODE_DEFAULT);
 	if (ret) {
 		LOG_ERR("Call `ctr_x0_set_mode` failed: %d", ret);
@@ -56,169 +81,322 @@ static int power_off()
 	return 0;
 }
 
-int ctr_sps30_read(float *mass_conc_pm_1_0, float *mass_conc_pm_2_5, float *mass_conc_pm_4_0,
-		   float *mass_conc_pm_10_0, float *num_conc_pm_0_5, float *num_conc_pm_1_0,
-		   float *num_conc_pm_2_5, float *num_conc_pm_4_0, float *num_conc_pm_10_0)
+static int get_channel(enum sensor_channel chan, float *val)
 {
-	int ret;
-
-	k_mutex_lock(&m_mut, K_FOREVER);
-
-	if (!device_is_ready(m_sens_dev)) {
-		LOG_ERR("Device `SPS30_EXT` not ready");
-		ret = -EINVAL;
-		goto exit;
-	}
+	struct sensor_value sv;
 
-	ret = power_on();
+	int ret = sensor_channel_get(m_sens_dev, chan, &sv);
 	if (ret) {
-		LOG_ERR("Call `power_on` failed: %d", ret);
-		goto exit;
+		LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
+		return ret;
 	}
 
-	k_sleep(K_MSEC(15000));
+	*val = sensor_value_to_double(&sv);
+
+	return 0;
+}
+
+static int fetch(struct ctr_sps30_data *data)
+{
+	int ret;
 
 	ret = sensor_sample_fetch(m_sens_dev);
 	if (ret) {
 		LOG_ERR("Call `sensor_sample_fetch` failed: %d", ret);
-		goto exit;
+		return ret;
 	}
 
-	struct sensor_value val;
-
-	if (mass_conc_pm_1_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_PM_1_0, &val);
+	const struct {
+		enum sensor_channel chan;
+		float *val;
+	} channels[] = {
+		{SENSOR_CHAN_PM_1_0, &data->mass_conc_pm_1_0},
+		{SENSOR_CHAN_PM_2_5, &data->mass_conc_pm_2_5},
+		{SENSOR_CHAN_SPS30_PM_4_0, &data->mass_conc_pm_4_0},
+		{SENSOR_CHAN_PM_10, &data->mass_conc_pm_10_0},
+		{SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_0_5, &data->num_conc_pm_0_5},
+		{SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_1_0, &data->num_conc_pm_1_0},
+		{SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_2_5, &data->num_conc_pm_2_5},
+		{SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_4_0, &data->num_conc_pm_4_0},
+		{SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_10_0, &data->num_conc_pm_10_0},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(channels); i++) {
+		ret = get_channel(channels[i].chan, channels[i].val);
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			return ret;
 		}
-		*mass_conc_pm_1_0 = sensor_value_to_double(&val);
-		LOG_DBG("Particulate Matter 1.0: %.2f ug/m3", (double)*mass_conc_pm_1_0);
 	}
 
-	if (mass_conc_pm_2_5) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_PM_2_5, &val);
-		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
-		}
-		*mass_conc_pm_2_5 = sensor_value_to_double(&val);
-		LOG_DBG("Particulate Matter 2.5: %.2f ug/m3", (double)*mass_conc_pm_1_0);
+	return 0;
+}
+
+static void accumulate(const struct ctr_sps30_data *data)
+{
+	m_sum.mass_conc_pm_1_0 += data->mass_conc_pm_1_0;
+	m_sum.mass_conc_pm_2_5 += data->mass_conc_pm_2_5;
+	m_sum.mass_conc_pm_4_0 += data->mass_conc_pm_4_0;
+	m_sum.mass_conc_pm_10_0 += data->mass_conc_pm_10_0;
+	m_sum.num_conc_pm_0_5 += data->num_conc_pm_0_5;
+	m_sum.num_conc_pm_1_0 += data->num_conc_pm_1_0;
+	m_sum.num_conc_pm_2_5 += data->num_conc_pm_2_5;
+	m_sum.num_conc_pm_4_0 += data->num_conc_pm_4_0;
+	m_sum.num_conc_pm_10_0 += data->num_conc_pm_10_0;
+	m_sum.count++;
+}
+
+static void average(struct ctr_sps30_data *data)
+{
+	float n = m_sum.count;
+
+	data->mass_conc_pm_1_0 = m_sum.mass_conc_pm_1_0 / n;
+	data->mass_conc_pm_2_5 = m_sum.mass_conc_pm_2_5 / n;
+	data->mass_conc_pm_4_0 = m_sum.mass_conc_pm_4_0 / n;
+	data->mass_conc_pm_10_0 = m_sum.mass_conc_pm_10_0 / n;
+	data->num_conc_pm_0_5 = m_sum.num_conc_pm_0_5 / n;
+	data->num_conc_pm_1_0 = m_sum.num_conc_pm_1_0 / n;
+	data->num_conc_pm_2_5 = m_sum.num_conc_pm_2_5 / n;
+	data->num_conc_pm_4_0 = m_sum.num_conc_pm_4_0 / n;
+	data->num_conc_pm_10_0 = m_sum.num_conc_pm_10_0 / n;
+	data->count = m_sum.count;
+}
+
+static void complete(int result)
+{
+	struct ctr_sps30_data data = {0};
+
+	if (!result) {
+		average(&data);
+
+		LOG_DBG("Particulate Matter 1.0: %.2f ug/m3 (readings: %d)",
+			(double)data.mass_conc_pm_1_0, data.count);
 	}
 
-	if (mass_conc_pm_4_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_PM_4_0, &val);
+	/* A failed sensor is restarted from scratch by the next measurement */
+	if (result || !m_continuous) {
+		int ret = power_off();
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_WRN("Call `power_off` failed: %d", ret);
 		}
-		*mass_conc_pm_4_0 = sensor_value_to_double(&val);
-		LOG_DBG("Particulate Matter 4.0: %.2f ug/m3", (double)*mass_conc_pm_1_0);
 	}
 
-	if (mass_conc_pm_10_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_PM_10, &val);
+	ctr_sps30_read_cb cb = m_cb;
+	void *user_data = m_user_data;
+
+	m_cb = NULL;
+
+	k_mutex_unlock(&m_mut);
+	cb(result, result ? NULL : &data, user_data);
+	k_mutex_lock(&m_mut, K_FOREVER);
+}
+
+static void work_handler(struct k_work *work)
+{
+	int ret;
+
+	k_mutex_lock(&m_mut, K_FOREVER);
+
+	switch (m_state) {
+	case STATE_SETTLE:
+		ret = sps30_power_on_init(m_sens_dev);
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_ERR("Call `sps30_power_on_init` failed: %d", ret);
+
+			if (m_cb) {
+				complete(ret);
+			} else {
+				power_off();
+			}
+
+			break;
 		}
-		*mass_conc_pm_10_0 = sensor_value_to_double(&val);
-		LOG_DBG("Particulate Matter 10.0: %.2f ug/m3", (double)*mass_conc_pm_1_0);
-	}
 
-	if (num_conc_pm_0_5) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_0_5,
-					 &val);
-		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+		m_state = STATE_WARM_UP;
+		k_work_reschedule(&m_work, WARM_UP_TIME);
+		break;
+
+	case STATE_WARM_UP:
+		m_state = STATE_READY;
+		__fallthrough;
+
+	case STATE_READY:
+		if (!m_cb) {
+			break;
 		}
-		*num_conc_pm_0_5 = sensor_value_to_double(&val);
-		LOG_DBG("Number concentration 0.5: %.2f", (double)*num_conc_pm_0_5);
-	}
 
-	if (num_conc_pm_1_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_1_0,
-					 &val);
+		struct ctr_sps30_data data;
+		ret = fetch(&data);
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_ERR("Call `fetch` failed: %d", ret);
+			complete(ret);
+			break;
 		}
-		*num_conc_pm_1_0 = sensor_value_to_double(&val);
-		LOG_DBG("Number concentration 1.0: %.2f", (double)*num_conc_pm_1_0);
+
+		accumulate(&data);
+
+		if (m_sum.count < m_readings) {
+			k_work_reschedule(&m_work, READING_INTERVAL);
+		} else {
+			complete(0);
+		}
+
+		break;
+
+	default:
+		break;
 	}
 
-	if (num_conc_pm_2_5) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_2_5,
-					 &val);
+	k_mutex_unlock(&m_mut);
+}
+
+int ctr_sps30_read_async(int readings, ctr_sps30_read_cb cb, void *user_data)
+{
+	int ret;
+
+	if (readings < 1 || !cb) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&m_mut, K_FOREVER);
+
+	if (!device_is_ready(m_sens_dev)) {
+		LOG_ERR("Device `SPS30_EXT` not ready");
+		k_mutex_unlock(&m_mut);
+		return -EINVAL;
+	}
+
+	if (m_cb) {
+		k_mutex_unlock(&m_mut);
+		return -EBUSY;
+	}
+
+	m_cb = cb;
+	m_user_data = user_data;
+	m_readings = readings;
+	memset(&m_sum, 0, sizeof(m_sum));
+
+	if (m_state == STATE_OFF) {
+		ret = power_on();
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_ERR("Call `power_on` failed: %d", ret);
+			m_cb = NULL;
+			power_off();
+			k_mutex_unlock(&m_mut);
+			return ret;
 		}
-		*num_conc_pm_2_5 = sensor_value_to_double(&val);
-		LOG_DBG("Number concentration 2.5: %.2f", (double)*num_conc_pm_2_5);
+	} else if (m_state == STATE_READY) {
+		k_work_reschedule(&m_work, K_NO_WAIT);
 	}
 
-	if (num_conc_pm_4_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_4_0,
-					 &val);
+	k_mutex_unlock(&m_mut);
+
+	return 0;
+}
+
+int ctr_sps30_set_continuous(bool enable)
+{
+	int ret = 0;
+
+	k_mutex_lock(&m_mut, K_FOREVER);
+
+	m_continuous = enable;
+
+	if (enable && m_state == STATE_OFF) {
+		ret = power_on();
+		if (ret) {
+			LOG_ERR("Call `power_on` failed: %d", ret);
+			power_off();
+		}
+	} else if (!enable && !m_cb && m_state != STATE_OFF) {
+		ret = power_off();
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_ERR("Call `power_off` failed: %d", ret);
 		}
-		*num_conc_pm_4_0 = sensor_value_to_double(&val);
-		LOG_DBG("Number concentration 4.0: %.2f", (double)*num_conc_pm_4_0);
 	}
 
-	if (num_conc_pm_10_0) {
-		ret = sensor_channel_get(m_sens_dev, SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_10_0,
-					 &val);
+	k_mutex_unlock(&m_mut);
+
+	return ret;
+}
+
+struct read_ctx {
+	struct k_sem sem;
+	int result;
+	struct ctr_sps30_data data;
+};
+
+static void read_cb(int result, const struct ctr_sps30_data *data, void *user_data)
+{
+	struct read_ctx *ctx = user_data;
+
+	ctx->result = result;
+
+	if (!result) {
+		ctx->data = *data;
+	}
+
+	k_sem_give(&ctx->sem);
+}
+
+int ctr_sps30_read(float *mass_conc_pm_1_0, float *mass_conc_pm_2_5, float *mass_conc_pm_4_0,
+		   float *mass_conc_pm_10_0, float *num_conc_pm_0_5, float *num_conc_pm_1_0,
+		   float *num_conc_pm_2_5, float *num_conc_pm_4_0, float *num_conc_pm_10_0)
+{
+	int ret;
+
+	struct read_ctx ctx = {
+		.data = {NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN, 0},
+	};
+
+	k_sem_init(&ctx.sem, 0, 1);
+
+	/* The measurement is driven by the system work queue, waiting on it there never returns */
+	if (k_current_get() == &k_sys_work_q.thread) {
+		LOG_ERR("Blocking read called from the system work queue");
+		ret = -EDEADLK;
+	} else {
+		ret = ctr_sps30_read_async(1, read_cb, &ctx);
 		if (ret) {
-			LOG_ERR("Call `sensor_channel_get` failed: %d", ret);
-			goto exit;
+			LOG_ERR("Call `ctr_sps30_read_async` failed: %d", ret);
+		} else {
+			k_sem_take(&ctx.sem, K_FOREVER);
+			ret = ctx.result;
 		}
-		*num_conc_pm_10_0 = sensor_value_to_double(&val);
-		LOG_DBG("Number concentration 10.0: %.2f", (double)*num_conc_pm_10_0);
 	}
 
-exit:
 	if (ret) {
-		if (mass_conc_pm_1_0) {
-			*mass_conc_pm_1_0 = NAN;
-		}
-		if (mass_conc_pm_2_5) {
-			*mass_conc_pm_2_5 = NAN;
-		}
-		if (mass_conc_pm_4_0) {
-			*mass_conc_pm_4_0 = NAN;
-		}
-		if (mass_conc_pm_10_0) {
-			*mass_conc_pm_10_0 = NAN;
-		}
+		ctx.data = (struct ctr_sps30_data){NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN, 0};
+	}
 
-		if (num_conc_pm_0_5) {
-			*num_conc_pm_0_5 = NAN;
-		}
-		if (num_conc_pm_1_0) {
-			*num_conc_pm_1_0 = NAN;
-		}
-		if (num_conc_pm_2_5) {
-			*num_conc_pm_2_5 = NAN;
-		}
-		if (num_conc_pm_4_0) {
-			*num_conc_pm_4_0 = NAN;
-		}
-		if (num_conc_pm_10_0) {
-			*num_conc_pm_10_0 = NAN;
-		}
+	if (mass_conc_pm_1_0) {
+		*mass_conc_pm_1_0 = ctx.data.mass_conc_pm_1_0;
+	}
+	if (mass_conc_pm_2_5) {
+		*mass_conc_pm_2_5 = ctx.data.mass_conc_pm_2_5;
+	}
+	if (mass_conc_pm_4_0) {
+		*mass_conc_pm_4_0 = ctx.data.mass_conc_pm_4_0;
+	}
+	if (mass_conc_pm_10_0) {
+		*mass_conc_pm_10_0 = ctx.data.mass_conc_pm_10_0;
 	}
 
-	int pwr_ret = power_off();
-	if (pwr_ret) {
-		LOG_WRN("Call `power_off` failed: %d", ret);
+	if (num_conc_pm_0_5) {
+		*num_conc_pm_0_5 = ctx.data.num_conc_pm_0_5;
+	}
+	if (num_conc_pm_1_0) {
+		*num_conc_pm_1_0 = ctx.data.num_conc_pm_1_0;
+	}
+	if (num_conc_pm_2_5) {
+		*num_conc_pm_2_5 = ctx.data.num_conc_pm_2_5;
+	}
+	if (num_conc_pm_4_0) {
+		*num_conc_pm_4_0 = ctx.data.num_conc_pm_4_0;
+	}
+	if (num_conc_pm_10_0) {
+		*num_conc_pm_10_0 = ctx.data.num_conc_pm_10_0;
 	}
 
-	k_mutex_unlock(&m_mut);
 	return ret;
 }
 
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "ctr_tc_conv.h"
+
+/* CHESTER includes */
+#include <chester/ctr_tc.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Newton converges quadratically from the knot-interpolated guess - once a step drops below the
+ * tolerance the remaining error is under 0.001 °C on every type */
+#define NEWTON_ITERATIONS 4
+#define NEWTON_TOLERANCE  0.05f
+
+#define ARRAY_COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+/* NIST ITS-90 reference function valid up to t_max, re-expanded around t0 as
+ * E(t) = c0 + c1 * (t - t0) + ... - the published power series of degree up to 14 cancels terms
+ * of tens of volts near -200 °C and is not usable in single precision as is */
+struct segment {
+	float t_max;
+	float t0;
+	const float *c;
+	size_t count;
+	/* Type K adds a0 * exp(a1 * (t - a2)^2) above 0 °C */
+	bool has_exp;
+};
+
+/* Points of the reference table bracketing the inversion guess */
+struct knot {
+	float t;
+	float mv;
+};
+
+struct tc {
+	float t_min;
+	const struct segment *segments;
+	size_t segments_count;
+	/* Span the range the inverse conversion is defined on */
+	const struct knot *knots;
+	size_t knots_count;
+};
+
+#define SEGMENT(t_max_, t0_, c_, has_exp_)                                                         \
+	{                                                                                          \
+		.t_max = t_max_, .t0 = t0_, .c = c_, .count = ARRAY_COUNT(c_),                     \
+		.has_exp = has_exp_,                                                               \
+	}
+
+#define TC(t_min_, segments_, knots_)                                                              \
+	{                                                                                          \
+		.t_min = t_min_, .segments = segments_, .segments_count = ARRAY_COUNT(segments_),  \
+		.knots = knots_, .knots_count = ARRAY_COUNT(knots_),                               \
+	}
+
+static const float m_k_exp[] = {1.185976e-1f, -1.183432e-4f, 1.269686e2f};
+
+static const float m_j_0[] = {
+	1.494220044e1f, 5.544384695e-2f, -1.634050236e-6f, -5.724285727e-9f, 5.042587811e-11f,
+	-5.806379259e-15f, 1.216975915e-18f, -9.099415683e-20f, 1.563172570e-23f,
+};
+
+static const float m_j_1[] = {
+	5.676302262e1f, 5.979065001e-2f, -1.419185728e-5f, 3.019329533e-8f, 6.820481666e-11f,
+	-3.069136906e-13f,
+};
+
+static const float m_k_0[] = {
+	-4.541590872e0f, 2.583836858e-2f, 7.170162758e-5f, -9.690520794e-8f, -3.473433386e-11f,
+	-2.437566671e-13f, 2.348798771e-15f, -5.130235460e-17f, 3.271976161e-19f, 2.146374728e-21f,
+	-1.632269749e-23f,
+};
+
+static const float m_k_1[] = {
+	2.854164115e1f, 4.200566334e-2f, -3.735619304e-6f, -5.385908238e-9f, 9.741261891e-12f,
+	1.436485151e-15f, -2.500530809e-17f, 7.886692667e-21f, 2.241659800e-23f, -1.210472128e-26f,
+};
+
+static const float m_t_0[] = {
+	-4.299596325e0f, 2.418864026e-2f, 6.173910599e-5f, -2.012109610e-8f, -1.122734953e-10f,
+	-5.908531140e-12f, 3.727351267e-14f, 1.229281774e-15f, -7.445741039e-18f, -1.369300117e-19f,
+	8.820121363e-22f, 6.537936410e-24f, -4.441564329e-26f, -1.136257030e-28f, 7.979515393e-31f,
+};
+
+static const float m_t_1[] = {
+	9.288102004e0f, 5.314978975e-2f, 2.831645706e-5f, -2.236676770e-8f, -2.808712598e-11f,
+	-1.053359043e-13f, 2.040580760e-15f, 1.458492613e-18f, -2.751290167e-20f,
+};
+
+static const float m_e_0[] = {
+	-6.714173949e0f, 3.909593303e-2f, 9.262319847e-5f, -1.228235147e-7f, 3.421109879e-10f,
+	-5.430110389e-13f, -3.236002582e-14f, 3.984279546e-18f, 4.877644691e-18f, -1.830104210e-20f,
+	-2.637653456e-22f, 1.498797698e-24f, 4.997184012e-27f, -3.465784201e-29f,
+};
+
+static const float m_e_1[] = {
+	3.700535382e1f, 8.092975825e-2f, 1.357661673e-6f, -1.962216707e-8f, 6.580565388e-12f,
+	3.639413576e-14f, 7.509135509e-17f, -2.130757038e-19f, -2.800958534e-22f, 3.592407958e-25f,
+	3.596089948e-28f,
+};
+
+static const float m_n_0[] = {
+	-3.083621937e0f, 1.763950944e-2f, 5.155375786e-5f, -8.341479040e-8f, -8.358961193e-11f,
+	-5.308733804e-13f, 1.578894748e-15f, 2.480394047e-17f, -9.341966783e-20f,
+};
+
+static const float m_n_1[] = {
+	2.256619113e1f, 3.914961295e-2f, 1.464774283e-6f, -5.666603312e-9f, 4.209064174e-12f,
+	3.486528401e-16f, -8.614106108e-18f, -7.399373338e-21f, 2.770220594e-23f, 9.058018409e-27f,
+	-3.068219615e-29f,
+};
+
+static const float m_r_0[] = {
+	4.471260523e0f, 1.088519154e-2f, 2.404733184e-6f, -6.000855516e-10f, 2.597463877e-12f,
+	-3.612378651e-15f, 3.831659421e-19f, 4.825280551e-22f, 3.124910100e-24f, -2.810386253e-27f,
+};
+
+static const float m_r_1[] = {
+	1.533379670e1f, 1.411854417e-2f, 2.433549473e-7f, -1.900853713e-9f, 7.287515007e-14f,
+	-2.933596682e-16f,
+};
+
+static const float m_r_2[] = {
+	2.022169610e1f, 1.345781329e-2f, -5.288595351e-6f, -3.465312576e-8f, -9.346339710e-15f,
+};
+
+static const float m_s_0[] = {
+	4.233294170e0f, 9.900784098e-3f, 1.548850393e-6f, -3.808284471e-10f, 2.398685348e-12f,
+	-3.083379254e-15f, 8.013425212e-19f, -1.649160093e-21f, 2.714431761e-24f,
+};
+
+static const float m_s_1[] = {
+	1.376579872e1f, 1.213924662e-2f, 1.351706347e-8f, -1.578368205e-9f, 1.299896052e-14f,
+};
+
+static const float m_s_2[] = {
+	1.794730210e1f, 1.145162097e-2f, -4.993894310e-6f, -3.310804391e-8f, -9.432236906e-15f,
+};
+
+static const float m_b_0[] = {
+	4.306479155e-1f, 3.047729134e-3f, 5.175947015e-6f, -6.304578928e-10f, -1.244805101e-13f,
+	-5.606266763e-16f, 6.299034709e-19f,
+};
+
+static const float m_b_1[] = {
+	6.786426971e0f, 1.035625366e-2f, 2.753428015e-6f, -1.255491709e-9f, -8.344342285e-13f,
+	-8.708199590e-16f, 8.074428841e-19f, 8.935963744e-22f, -9.379133029e-25f,
+};
+
+static const struct segment m_j_segments[] = {
+	SEGMENT(760.f, 275.f, m_j_0, false),
+	SEGMENT(1200.f, 980.f, m_j_1, false),
+};
+
+static const struct segment m_k_segments[] = {
+	SEGMENT(0.f, -135.f, m_k_0, false),
+	SEGMENT(1372.f, 686.f, m_k_1, true),
+};
+
+static const struct segment m_t_segments[] = {
+	SEGMENT(0.f, -135.f, m_t_0, false),
+	SEGMENT(400.f, 200.f, m_t_1, false),
+};
+
+static const struct segment m_e_segments[] = {
+	SEGMENT(0.f, -135.f, m_e_0, false),
+	SEGMENT(1000.f, 500.f, m_e_1, false),
+};
+
+static const struct segment m_n_segments[] = {
+	SEGMENT(0.f, -135.f, m_n_0, false),
+	SEGMENT(1300.f, 650.f, m_n_1, false),
+};
+
+static const struct segment m_r_segments[] = {
+	SEGMENT(1064.18f, 500.f, m_r_0, false),
+	SEGMENT(1664.5f, 1350.f, m_r_1, false),
+	SEGMENT(1768.1f, 1700.f, m_r_2, false),
+};
+
+static const struct segment m_s_segments[] = {
+	SEGMENT(1064.18f, 500.f, m_s_0, false),
+	SEGMENT(1664.5f, 1350.f, m_s_1, false),
+	SEGMENT(1768.1f, 1700.f, m_s_2, false),
+};
+
+static const struct segment m_b_segments[] = {
+	SEGMENT(630.615f, 300.f, m_b_0, false),
+	SEGMENT(1820.f, 1200.f, m_b_1, false),
+};
+
+static const struct knot m_j_knots[] = {
+	{-210.f, -8.095f}, {-100.f, -4.633f}, {0.f, 0.f},	 {100.f, 5.269f},
+	{200.f, 10.779f},  {300.f, 16.327f},  {400.f, 21.848f},	 {500.f, 27.393f},
+	{600.f, 33.102f},  {700.f, 39.132f},  {800.f, 45.494f},	 {900.f, 51.877f},
+	{1000.f, 57.953f}, {1100.f, 63.792f}, {1200.f, 69.553f},
+};
+
+static const struct knot m_k_knots[] = {
+	{-200.f, -5.891f}, {-100.f, -3.554f}, {0.f, 0.f},	 {100.f, 4.096f},
+	{200.f, 8.138f},   {300.f, 12.209f},  {400.f, 16.397f},	 {500.f, 20.644f},
+	{600.f, 24.905f},  {700.f, 29.129f},  {800.f, 33.275f},	 {900.f, 37.326f},
+	{1000.f, 41.276f}, {1100.f, 45.119f}, {1200.f, 48.838f}, {1300.f, 52.410f},
+	{1372.f, 54.886f},
+};
+
+static const struct knot m_t_knots[] = {
+	{-200.f, -5.603f}, {-100.f, -3.379f}, {0.f, 0.f},	 {100.f, 4.279f},
+	{200.f, 9.288f},   {300.f, 14.862f},  {400.f, 20.872f},
+};
+
+static const struct knot m_e_knots[] = {
+	{-200.f, -8.825f}, {-100.f, -5.237f}, {0.f, 0.f},	 {100.f, 6.319f},
+	{200.f, 13.421f},  {300.f, 21.036f},  {400.f, 28.946f},	 {500.f, 37.005f},
+	{600.f, 45.093f},  {700.f, 53.112f},  {800.f, 61.017f},	 {900.f, 68.787f},
+	{1000.f, 76.373f},
+};
+
+static const struct knot m_n_knots[] = {
+	{-200.f, -3.990f}, {-100.f, -2.407f}, {0.f, 0.f},	 {100.f, 2.774f},
+	{200.f, 5.913f},   {300.f, 9.341f},   {400.f, 12.974f},	 {500.f, 16.748f},
+	{600.f, 20.613f},  {700.f, 24.527f},  {800.f, 28.455f},	 {900.f, 32.371f},
+	{1000.f, 36.256f}, {1100.f, 40.087f}, {1200.f, 43.846f}, {1300.f, 47.513f},
+};
+
+static const struct knot m_r_knots[] = {
+	{-50.f, -0.226f},  {0.f, 0.f},	      {100.f, 0.647f},	 {200.f, 1.469f},
+	{300.f, 2.401f},   {400.f, 3.408f},   {500.f, 4.471f},	 {600.f, 5.583f},
+	{700.f, 6.743f},   {800.f, 7.950f},   {900.f, 9.205f},	 {1000.f, 10.506f},
+	{1100.f, 11.850f}, {1200.f, 13.228f}, {1300.f, 14.629f}, {1400.f, 16.040f},
+	{1500.f, 17.451f}, {1600.f, 18.849f}, {1700.f, 20.222f}, {1768.f, 21.101f},
+};
+
+static const struct knot m_s_knots[] = {
+	{-50.f, -0.236f},  {0.f, 0.f},	      {100.f, 0.646f},	 {200.f, 1.441f},
+	{300.f, 2.323f},   {400.f, 3.259f},   {500.f, 4.233f},	 {600.f, 5.239f},
+	{700.f, 6.275f},   {800.f, 7.345f},   {900.f, 8.449f},	 {1000.f, 9.587f},
+	{1100.f, 10.757f}, {1200.f, 11.951f}, {1300.f, 13.159f}, {1400.f, 14.373f},
+	{1500.f, 15.582f}, {1600.f, 16.777f}, {1700.f, 17.947f}, {1768.f, 18.693f},
+};
+
+static const struct knot m_b_knots[] = {
+	{250.f, 0.291f},   {300.f, 0.431f},   {400.f, 0.787f},	 {500.f, 1.242f},
+	{600.f, 1.792f},   {700.f, 2.431f},   {800.f, 3.154f},	 {900.f, 3.957f},
+	{1000.f, 4.834f},  {1100.f, 5.780f},  {1200.f, 6.786f},	 {1300.f, 7.848f},
+	{1400.f, 8.956f},  {1500.f, 10.099f}, {1600.f, 11.263f}, {1700.f, 12.433f},
+	{1800.f, 13.591f}, {1820.f, 13.820f},
+};
+
+static const struct tc m_tc[] = {
+	[CTR_TC_TYPE_K] = TC(-270.f, m_k_segments, m_k_knots),
+	[CTR_TC_TYPE_J] = TC(-210.f, m_j_segments, m_j_knots),
+	[CTR_TC_TYPE_T] = TC(-270.f, m_t_segments, m_t_knots),
+	[CTR_TC_TYPE_E] = TC(-270.f, m_e_segments, m_e_knots),
+	[CTR_TC_TYPE_N] = TC(-270.f, m_n_segments, m_n_knots),
+	[CTR_TC_TYPE_R] = TC(-50.f, m_r_segments, m_r_knots),
+	[CTR_TC_TYPE_S] = TC(-50.f, m_s_segments, m_s_knots),
+	[CTR_TC_TYPE_B] = TC(0.f, m_b_segments, m_b_knots),
+};
+
+static const struct tc *get_tc(enum ctr_tc_type type)
+{
+	if ((unsigned int)type >= ARRAY_COUNT(m_tc)) {
+		return NULL;
+	}
+
+	return &m_tc[type];
+}
+
+/* Evaluates E(t) and its derivative (Seebeck coefficient) - the outer segments extrapolate */
+static float evaluate(const struct tc *tc, float t, float *seebeck)
+{
+	const struct segment *s = &tc->segments[0];
+
+	for (size_t i = 0; i < tc->segments_count - 1 && t > s->t_max; i++) {
+		s++;
+	}
+
+	float x = t - s->t0;
+	float e = s->c[s->count - 1];
+	float de = 0.f;
+
+	for (size_t i = s->count - 1; i-- > 0;) {
+		de = de * x + e;
+		e = e * x + s->c[i];
+	}
+
+	if (s->has_exp) {
+		float d = t - m_k_exp[2];
+		float g = m_k_exp[0] * expf(m_k_exp[1] * d * d);
+
+		e += g;
+		de += 2.f * m_k_exp[1] * d * g;
+	}
+
+	if (seebeck) {
+		*seebeck = de;
+	}
+
+	return e;
+}
+
+/* Newton iteration on E(t) from a guess interpolated between the bracketing knots */
+static float invert(const struct tc *tc, float mv)
+{
+	size_t lo = 0;
+	size_t hi = tc->knots_count - 1;
+
+	while (hi - lo > 1) {
+		size_t mid = (lo + hi) / 2;
+
+		if (mv < tc->knots[mid].mv) {
+			hi = mid;
+		} else {
+			lo = mid;
+		}
+	}
+
+	const struct knot *a = &tc->knots[lo];
+	const struct knot *b = &tc->knots[hi];
+
+	float t = a->t + (mv - a->mv) * (b->t - a->t) / (b->mv - a->mv);
+
+	for (int i = 0; i < NEWTON_ITERATIONS; i++) {
+		float seebeck;
+		float step = (evaluate(tc, t, &seebeck) - mv) / seebeck;
+
+		t -= step;
+
+		if (fabsf(step) < NEWTON_TOLERANCE) {
+			break;
+		}
+	}
+
+	return t;
+}
+
+int ctr_tc_conv_mv(enum ctr_tc_type type, float temperature, float *mv)
+{
+	const struct tc *tc = get_tc(type);
+	if (!tc) {
+		return -EINVAL;
+	}
+
+	if (!(temperature >= tc->t_min &&
+	      temperature <= tc->segments[tc->segments_count - 1].t_max)) {
+		return -ERANGE;
+	}
+
+	*mv = evaluate(tc, temperature, NULL);
+
+	return 0;
+}
+
+int ctr_tc_conv_temperature(enum ctr_tc_type type, float mv, float *temperature)
+{
+	const struct tc *tc = get_tc(type);
+	if (!tc) {
+		return -EINVAL;
+	}
+
+	const struct knot *first = &tc->knots[0];
+	const struct knot *last = &tc->knots[tc->knots_count - 1];
+
+	/* The knots hold table values rounded to 1 uV - the limits also include the evaluated
+	 * endpoints, so what the forward conversion gives there is accepted as well */
+	if (!(mv >= first->mv && mv <= last->mv) &&
+	    !(mv >= fminf(first->mv, evaluate(tc, first->t, NULL)) &&
+	      mv <= fmaxf(last->mv, evaluate(tc, last->t, NULL)))) {
+		return -ERANGE;
+	}
+
+	*temperature = invert(tc, mv);
+
+	return 0;
+}
+
+int ctr_tc_conv(enum ctr_tc_type type, float mv, float temperature_cj, float *temperature)
+{
+	const struct tc *tc = get_tc(type);
+	if (!tc) {
+		return -EINVAL;
+	}
+
+	/* The board may sit slightly below the lower limit of the reference function (type B
+	 * starts at 0 °C where its output is a few microvolts), so the outer segment is used */
+	float mv_cj = evaluate(tc, temperature_cj, NULL);
+
+	return ctr_tc_conv_temperature(type, mv + mv_cj, temperature);
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#ifndef CHESTER_SUBSYS_CTR_TC_CTR_TC_CONV_H_
+#define CHESTER_SUBSYS_CTR_TC_CTR_TC_CONV_H_
+
+/* CHESTER includes */
+#include <chester/ctr_tc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Thermoelectric voltage (mV) of the junction at the given temperature (NIST ITS-90) */
+int ctr_tc_conv_mv(enum ctr_tc_type type, float temperature, float *mv);
+
+/* Temperature of the junction producing the given thermoelectric voltage (mV) */
+int ctr_tc_conv_temperature(enum ctr_tc_type type, float mv, float *temperature);
+
+/* Measured voltage (mV) to hot junction temperature with cold-junction compensation */
+int ctr_tc_conv(enum ctr_tc_type type, float mv, float temperature_cj, float *temperature);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHESTER_SUBSYS_CTR_TC_CTR_TC_CONV_H_ */
@@ -40,7 +40,25 @@ static int cmd_tc_read(const struct shell *shell, size_t argc, char **argv)
 		return -EINVAL;
 	}
 
-	if (strcmp(argv[2], "k") != 0) {
+	enum ctr_tc_type type;
+
+	if (strcmp(argv[2], "k") == 0) {
+		type = CTR_TC_TYPE_K;
+	} else if (strcmp(argv[2], "j") == 0) {
+		type = CTR_TC_TYPE_J;
+	} else if (strcmp(argv[2], "t") == 0) {
+		type = CTR_TC_TYPE_T;
+	} else if (strcmp(argv[2], "e") == 0) {
+		type = CTR_TC_TYPE_E;
+	} else if (strcmp(argv[2], "n") == 0) {
+		type = CTR_TC_TYPE_N;
+	} else if (strcmp(argv[2], "r") == 0) {
+		type = CTR_TC_TYPE_R;
+	} else if (strcmp(argv[2], "s") == 0) {
+		type = CTR_TC_TYPE_S;
+	} else if (strcmp(argv[2], "b") == 0) {
+		type = CTR_TC_TYPE_B;
+	} else {
 		shell_error(shell, "invalid type: %s", argv[2]);
 		shell_help(shell);
 		return -EINVAL;
@@ -68,7 +86,7 @@ static int cmd_tc_read(const struct shell *shell, size_t argc, char **argv)
 
 		float temperature;
 
-		ret = ctr_tc_read(channel, CTR_TC_TYPE_K, &temperature);
+		ret = ctr_tc_read(channel, type, &temperature);
 		if (ret) {
 			LOG_ERR("Call `ctr_tc_read` failed: %d", ret);
 			shell_error(shell, "command failed");
@@ -103,7 +121,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 
 	SHELL_CMD_ARG(read, NULL,
 	              "Read temperature w/ optional number of repetitions"
-		      "(format: <a1|a2|b1|b2> <k> [<1-3600>]).",
+		      "(format: <a1|a2|b1|b2> <k|j|t|e|n|r|s|b> [<1-3600>]).",
 	              cmd_tc_read, 3, 1),
 
         SHELL_SUBCMD_SET_END
@@ -0,0 +1,223 @@
+/** @file
+ *  @brief Modbus register map test suite
+ *
+ */
+
+#include "app_modbus.h"
+#include "app_modbus_map.h"
+
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_REQUESTS 16
+
+struct request {
+	enum app_modbus_map_func func;
+	uint16_t reg;
+	uint16_t count;
+};
+
+/* Register file of the emulated slave */
+static uint16_t m_regs[256];
+
+static struct request m_requests[MAX_REQUESTS];
+static int m_request_count;
+
+/* Requests of more registers than this are rejected with -EIO (0 = no limit) */
+static uint16_t m_max_count;
+
+/* Forced result of every request (0 = emulate the slave) */
+static int m_ret;
+
+static int read_regs(enum app_modbus_map_func func, uint16_t reg_addr, uint16_t count,
+		     uint16_t *data)
+{
+	zassert_true(m_request_count < MAX_REQUESTS, "too many requests");
+	zassert_true(count <= APP_MODBUS_MAP_MAX_REGS, "request too long");
+	zassert_true(reg_addr + count <= ARRAY_SIZE(m_regs), "request out of range");
+
+	m_requests[m_request_count++] = (struct request){func, reg_addr, count};
+
+	if (m_ret) {
+		return m_ret;
+	}
+
+	if (m_max_count && count > m_max_count) {
+		return -EIO;
+	}
+
+	memcpy(data, &m_regs[reg_addr], count * sizeof(uint16_t));
+
+	return 0;
+}
+
+int app_modbus_read_holding_regs(uint8_t slave_addr, uint16_t reg_addr, uint16_t count,
+				  uint16_t *data)
+{
+	return read_regs(APP_MODBUS_MAP_HOLDING, reg_addr, count, data);
+}
+
+int app_modbus_read_input_regs(uint8_t slave_addr, uint16_t reg_addr, uint16_t count,
+				uint16_t *data)
+{
+	return read_regs(APP_MODBUS_MAP_INPUT, reg_addr, count, data);
+}
+
+static void assert_request(int index, enum app_modbus_map_func func, uint16_t reg,
+			   uint16_t count)
+{
+	zassert_true(index < m_request_count, "request missing");
+	zassert_equal(m_requests[index].func, func, "request function not equal");
+	zassert_equal(m_requests[index].reg, reg, "request register not equal");
+	zassert_equal(m_requests[index].count, count, "request count not equal");
+}
+
+static float m_values[4];
+
+ZTEST(applications_serial_modbus_map, test_not_sorted)
+{
+	int ret;
+
+	const struct app_modbus_map_entry map[] = {
+		{0x20, APP_MODBUS_MAP_U16, 0, &m_values[0]},
+		{0x10, APP_MODBUS_MAP_U16, 0, &m_values[1]},
+	};
+
+	ret = app_modbus_map_read(1, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
+	zassert_equal(ret, -EINVAL, "unsorted map not rejected");
+	zassert_equal(m_request_count, 0, "request sent for unsorted map");
+}
+
+ZTEST(applications_serial_modbus_map, test_coalesce)
+{
+	int ret;
+
+	m_regs[0x10] = 1234;
+	m_regs[0x12] = 0xffff;
+	m_regs[0x13] = 0xfffe;
+	/* 12.5f with high word first */
+	m_regs[0x15] = 0x4148;
+	m_regs[0x16] = 0x0000;
+	m_regs[0x30] = (uint16_t)-5;
+
+	const struct app_modbus_map_entry map[] = {
+		{0x10, APP_MODBUS_MAP_U16, 0.1f, &m_values[0]},
+		{0x12, APP_MODBUS_MAP_S32, 0, &m_values[1]},
+		{0x15, APP_MODBUS_MAP_FLOAT32, 0, &m_values[2]},
+		/* Beyond the gap - read separately */
+		{0x30, APP_MODBUS_MAP_S16, 0, &m_values[3]},
+	};
+
+	ret = app_modbus_map_read(1, APP_MODBUS_MAP_INPUT, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
+	zassert_ok(ret, "app_modbus_map_read failed");
+
+	zassert_equal(m_request_count, 2, "request count not equal");
+	assert_request(0, APP_MODBUS_MAP_INPUT, 0x10, 7);
+	assert_request(1, APP_MODBUS_MAP_INPUT, 0x30, 1);
+
+	zassert_within(m_values[0], 123.4f, 0.001f, "value 0 not equal");
+	zassert_equal(m_values[1], -2.f, "value 1 not equal");
+	zassert_equal(m_values[2], 12.5f, "value 2 not equal");
+	zassert_equal(m_values[3], -5.f, "value 3 not equal");
+}
+
+ZTEST(applications_serial_modbus_map, test_max_regs)
+{
+	int ret;
+
+	m_regs[0] = 1;
+	m_regs[APP_MODBUS_MAP_MAX_REGS - 1] = 2;
+	m_regs[APP_MODBUS_MAP_MAX_REGS] = 3;
+
+	/* The second entry would end one register past the request limit */
+	const struct app_modbus_map_entry map[] = {
+		{0, APP_MODBUS_MAP_U16, 0, &m_values[0]},
+		{APP_MODBUS_MAP_MAX_REGS - 1, APP_MODBUS_MAP_U32_LSW, 0, &m_values[1]},
+	};
+
+	ret = app_modbus_map_read(1, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_MAX_REGS);
+	zassert_ok(ret, "app_modbus_map_read failed");
+
+	zassert_equal(m_request_count, 2, "request count not equal");
+	assert_request(0, APP_MODBUS_MAP_HOLDING, 0, 1);
+	assert_request(1, APP_MODBUS_MAP_HOLDING, APP_MODBUS_MAP_MAX_REGS - 1, 2);
+
+	zassert_equal(m_values[0], 1.f, "value 0 not equal");
+	zassert_equal(m_values[1], 3.f * 65536.f + 2.f, "value 1 not equal");
+}
+
+ZTEST(applications_serial_modbus_map, test_fallback)
+{
+	int ret;
+
+	m_regs[0x10] = 10;
+	m_regs[0x14] = 20;
+	m_regs[0x18] = 30;
+
+	const struct app_modbus_map_entry map[] = {
+		{0x10, APP_MODBUS_MAP_U16, 0, &m_values[0]},
+		{0x14, APP_MODBUS_MAP_U16, 0, &m_values[1]},
+		{0x18, APP_MODBUS_MAP_U16, 0, &m_values[2]},
+	};
+
+	/* The slave rejects reading over unmapped registers */
+	m_max_count = 1;
+
+	ret = app_modbus_map_read(1, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
+	zassert_ok(ret, "app_modbus_map_read failed");
+
+	zassert_equal(m_request_count, 4, "request count not equal");
+	assert_request(0, APP_MODBUS_MAP_HOLDING, 0x10, 9);
+	assert_request(1, APP_MODBUS_MAP_HOLDING, 0x10, 1);
+	assert_request(2, APP_MODBUS_MAP_HOLDING, 0x14, 1);
+	assert_request(3, APP_MODBUS_MAP_HOLDING, 0x18, 1);
+
+	zassert_equal(m_values[0], 10.f, "value 0 not equal");
+	zassert_equal(m_values[1], 20.f, "value 1 not equal");
+	zassert_equal(m_values[2], 30.f, "value 2 not equal");
+}
+
+ZTEST(applications_serial_modbus_map, test_timeout)
+{
+	int ret;
+
+	const struct app_modbus_map_entry map[] = {
+		{0x10, APP_MODBUS_MAP_U16, 0, &m_values[0]},
+		{0x14, APP_MODBUS_MAP_U16, 0, &m_values[1]},
+	};
+
+	/* A silent slave is not retried entry by entry */
+	m_ret = -ETIMEDOUT;
+
+	ret = app_modbus_map_read(1, APP_MODBUS_MAP_HOLDING, map, ARRAY_SIZE(map),
+				  APP_MODBUS_MAP_DEFAULT_GAP);
+	zassert_equal(ret, -EIO, "failure not reported");
+
+	zassert_equal(m_request_count, 1, "request count not equal");
+	zassert_true(isnan(m_values[0]), "value 0 not NAN");
+	zassert_true(isnan(m_values[1]), "value 1 not NAN");
+}
+
+static void before(void *fixture)
+{
+	memset(m_regs, 0, sizeof(m_regs));
+	memset(m_requests, 0, sizeof(m_requests));
+	m_request_count = 0;
+	m_max_count = 0;
+	m_ret = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(m_values); i++) {
+		m_values[i] = 0.f;
+	}
+}
+
+ZTEST_SUITE(applications_serial_modbus_map, NULL, NULL, before, NULL, NULL);
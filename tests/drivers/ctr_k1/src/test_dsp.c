@@ -0,0 +1,171 @@
+/** @file
+ *  @brief CHESTER-K1 per-cycle DSP test suite
+ *
+ */
+
+#include "ctr_k1_dsp.h"
+
+#include <chester/drivers/ctr_k1.h>
+
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CYCLE_SAMPLES 20
+#define MAX_CYCLES    16
+
+/* Differential channel full scale of the SAADC (12-bit, gain 1/6, 0.6 V reference) */
+#define LSB_MV (6.f * 600.f / 2048.f)
+
+struct waveform {
+	float dc;
+	/* Peak amplitudes of harmonics 1..CTR_K1_HARMONIC_COUNT */
+	float amplitude[CTR_K1_HARMONIC_COUNT];
+	float clip;
+};
+
+static struct ctr_k1_dsp m_dsp;
+static struct ctr_k1_cycle m_cycles[MAX_CYCLES];
+
+/* Waveform as captured by the SAADC - quantized to LSB */
+static float sample(const struct waveform *w, int n, float scale)
+{
+	float x = w->dc;
+
+	for (int k = 0; k < CTR_K1_HARMONIC_COUNT; k++) {
+		x += scale * w->amplitude[k] *
+		     sinf(2.f * (float)M_PI * (k + 1) * n / CYCLE_SAMPLES + 0.3f * k);
+	}
+
+	if (w->clip > 0.f) {
+		x = fminf(fmaxf(x, w->dc - w->clip), w->dc + w->clip);
+	}
+
+	return roundf(x / LSB_MV) * LSB_MV;
+}
+
+/* Feeds the cycles with per-cycle amplitude scale and returns the number of completed cycles */
+static int feed(const struct waveform *w, const float scale[], int cycles)
+{
+	int completed = 0;
+
+	for (int n = 0; n < cycles * CYCLE_SAMPLES; n++) {
+		if (ctr_k1_dsp_feed(&m_dsp, sample(w, n, scale[n / CYCLE_SAMPLES]),
+				    &m_cycles[completed])) {
+			completed++;
+		}
+	}
+
+	return completed;
+}
+
+static void before(void *fixture)
+{
+	zassert_ok(ctr_k1_dsp_init(&m_dsp, CYCLE_SAMPLES), "ctr_k1_dsp_init failed");
+}
+
+ZTEST(subsus_ctr_k1_dsp, test_sine)
+{
+	const struct waveform w = {
+		.dc = 100.f,
+		.amplitude = {1000.f},
+	};
+	const float scale[] = {1.f, 1.f, 1.f};
+
+	zassert_equal(feed(&w, scale, 3), 3, "cycle count mismatch");
+
+	for (int i = 0; i < 3; i++) {
+		const struct ctr_k1_cycle *c = &m_cycles[i];
+
+		zassert_within(c->avg, 100.f, 2.f, "avg %f", (double)c->avg);
+		zassert_within(c->rms, sqrtf(100.f * 100.f + 1000.f * 1000.f / 2.f), 2.f, "rms %f",
+			       (double)c->rms);
+		zassert_within(c->peak, 1100.f, 15.f, "peak %f", (double)c->peak);
+		zassert_within(c->harmonics[0], 1000.f / (float)M_SQRT2, 2.f, "h1 %f",
+			       (double)c->harmonics[0]);
+
+		for (int k = 1; k < CTR_K1_HARMONIC_COUNT; k++) {
+			zassert_true(c->harmonics[k] < 2.f, "h%d %f", k + 1,
+				     (double)c->harmonics[k]);
+		}
+	}
+}
+
+ZTEST(subsus_ctr_k1_dsp, test_harmonics)
+{
+	const struct waveform w = {
+		.amplitude = {1000.f, 0.f, 200.f, 0.f, 100.f},
+	};
+	const float scale[] = {1.f};
+
+	zassert_equal(feed(&w, scale, 1), 1, "cycle count mismatch");
+
+	const struct ctr_k1_cycle *c = &m_cycles[0];
+
+	zassert_within(c->harmonics[0], 1000.f / (float)M_SQRT2, 2.f, "h1 %f",
+		       (double)c->harmonics[0]);
+	zassert_true(c->harmonics[1] < 2.f, "h2 %f", (double)c->harmonics[1]);
+	zassert_within(c->harmonics[2], 200.f / (float)M_SQRT2, 2.f, "h3 %f",
+		       (double)c->harmonics[2]);
+	zassert_true(c->harmonics[3] < 2.f, "h4 %f", (double)c->harmonics[3]);
+	zassert_within(c->harmonics[4], 100.f / (float)M_SQRT2, 2.f, "h5 %f",
+		       (double)c->harmonics[4]);
+
+	/* Total RMS of orthogonal components */
+	zassert_within(c->rms, sqrtf((1000.f * 1000.f + 200.f * 200.f + 100.f * 100.f) / 2.f), 2.f,
+		       "rms %f", (double)c->rms);
+}
+
+ZTEST(subsus_ctr_k1_dsp, test_crest)
+{
+	/* Clipped (flat-topped) waveform has a lower crest factor than a sine */
+	const struct waveform clipped = {
+		.amplitude = {1000.f},
+		.clip = 600.f,
+	};
+	const struct waveform sine = {
+		.amplitude = {1000.f},
+	};
+	const float scale[] = {1.f};
+
+	zassert_equal(feed(&sine, scale, 1), 1, "cycle count mismatch");
+	zassert_within(m_cycles[0].crest, (float)M_SQRT2, 0.02f, "crest %f",
+		       (double)m_cycles[0].crest);
+
+	zassert_equal(feed(&clipped, scale, 1), 1, "cycle count mismatch");
+	zassert_within(m_cycles[0].peak, 600.f, 2.f, "peak %f", (double)m_cycles[0].peak);
+	zassert_true(m_cycles[0].crest < 1.3f, "crest %f", (double)m_cycles[0].crest);
+}
+
+ZTEST(subsus_ctr_k1_dsp, test_sag)
+{
+	const struct waveform w = {
+		.amplitude = {1000.f},
+	};
+	const float scale[] = {1.f, 1.f, 1.f, 0.5f, 1.f, 1.f};
+
+	zassert_equal(feed(&w, scale, ARRAY_SIZE(scale)), ARRAY_SIZE(scale),
+		      "cycle count mismatch");
+
+	/* A single-cycle sag is visible in its own cycle only */
+	for (int i = 0; i < ARRAY_SIZE(scale); i++) {
+		float expected = scale[i] * 1000.f / (float)M_SQRT2;
+
+		zassert_within(m_cycles[i].rms, expected, 2.f, "cycle %d rms %f", i,
+			       (double)m_cycles[i].rms);
+	}
+}
+
+ZTEST(subsus_ctr_k1_dsp, test_init_invalid)
+{
+	struct ctr_k1_dsp dsp;
+
+	zassert_equal(ctr_k1_dsp_init(&dsp, 2 * CTR_K1_HARMONIC_COUNT), -EINVAL,
+		      "too few samples per cycle accepted");
+}
+
+ZTEST_SUITE(subsus_ctr_k1_dsp, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,163 @@
+/** @file
+ *  @brief CHESTER-S1 batch measurement test suite
+ *
+ */
+
+#include "ctr_s1_meas.h"
+#include "ctr_s1_reg.h"
+
+#include <chester/drivers/ctr_s1.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Register file of the emulated cover module */
+static uint16_t m_regs[0x20];
+
+/* Big-endian words of consecutive registers, as returned by the driver's read_span */
+static void read_span(uint8_t reg, uint8_t *buf, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		sys_put_be16(m_regs[reg + i], &buf[i * 2]);
+	}
+}
+
+/* Span computation, transfer and conversion as done by the driver */
+static int measure(unsigned int quantities, struct ctr_s1_measurement *measurement)
+{
+	int ret;
+
+	uint8_t reg;
+	size_t count;
+	ret = ctr_s1_meas_span(quantities, &reg, &count);
+	if (ret) {
+		return ret;
+	}
+
+	zassert_true(count <= CTR_S1_MEAS_REG_COUNT);
+
+	uint8_t buf[CTR_S1_MEAS_REG_COUNT * 2];
+	read_span(reg, buf, count);
+
+	return ctr_s1_meas_convert(quantities, reg, buf, measurement);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(m_regs, 0xa5, sizeof(m_regs));
+
+	m_regs[REG_PROTOCOL] = 2;
+	m_regs[REG_CO2CONC] = 612;
+	m_regs[REG_TEMPERATURE] = (uint16_t)-1234;
+	m_regs[REG_HUMIDITY] = 4567;
+	m_regs[REG_ILLUM0] = 0x86a0;
+	m_regs[REG_ILLUM1] = 0x0001;
+	m_regs[REG_ALTITUDE] = 235;
+	m_regs[REG_RESERVED] = 0;
+	m_regs[REG_PRESSURE0] = 0x8b34;
+	m_regs[REG_PRESSURE1] = 0x0001;
+}
+
+ZTEST(drivers_ctr_s1_meas, test_span)
+{
+	uint8_t reg;
+	size_t count;
+
+	zassert_ok(ctr_s1_meas_span(CTR_S1_QUANTITY_ALL, &reg, &count));
+	zassert_equal(reg, REG_CO2CONC);
+	zassert_equal(count, CTR_S1_MEAS_REG_COUNT);
+
+	zassert_ok(ctr_s1_meas_span(CTR_S1_QUANTITY_TEMPERATURE | CTR_S1_QUANTITY_HUMIDITY, &reg,
+				    &count));
+	zassert_equal(reg, REG_TEMPERATURE);
+	zassert_equal(count, 2);
+
+	zassert_ok(ctr_s1_meas_span(CTR_S1_QUANTITY_ILLUMINANCE, &reg, &count));
+	zassert_equal(reg, REG_ILLUM0);
+	zassert_equal(count, 2);
+
+	/* The span covers the reserved register between altitude and pressure */
+	zassert_ok(ctr_s1_meas_span(CTR_S1_QUANTITY_ALTITUDE | CTR_S1_QUANTITY_PRESSURE, &reg,
+				    &count));
+	zassert_equal(reg, REG_ALTITUDE);
+	zassert_equal(count, 4);
+
+	zassert_equal(ctr_s1_meas_span(0, &reg, &count), -EINVAL);
+	zassert_equal(ctr_s1_meas_span(BIT(15), &reg, &count), -EINVAL);
+}
+
+ZTEST(drivers_ctr_s1_meas, test_all)
+{
+	struct ctr_s1_measurement m;
+
+	zassert_ok(measure(CTR_S1_QUANTITY_ALL, &m));
+
+	zassert_within(m.co2_conc, 612.f, 0.01f);
+	zassert_within(m.temperature, -12.34f, 0.001f);
+	zassert_within(m.humidity, 45.67f, 0.001f);
+	zassert_within(m.illuminance, 100000.f, 0.5f);
+	zassert_within(m.pressure, 101172.f, 0.5f);
+	zassert_within(m.altitude, 235.f, 0.01f);
+}
+
+ZTEST(drivers_ctr_s1_meas, test_subset)
+{
+	struct ctr_s1_measurement m;
+
+	zassert_ok(measure(CTR_S1_QUANTITY_HUMIDITY | CTR_S1_QUANTITY_ILLUMINANCE, &m));
+
+	zassert_within(m.humidity, 45.67f, 0.001f);
+	zassert_within(m.illuminance, 100000.f, 0.5f);
+
+	zassert_true(isnan(m.co2_conc));
+	zassert_true(isnan(m.temperature));
+	zassert_true(isnan(m.pressure));
+	zassert_true(isnan(m.altitude));
+
+	zassert_ok(measure(CTR_S1_QUANTITY_PRESSURE, &m));
+	zassert_within(m.pressure, 101172.f, 0.5f);
+	zassert_true(isnan(m.humidity));
+}
+
+ZTEST(drivers_ctr_s1_meas, test_error)
+{
+	struct ctr_s1_measurement m;
+
+	m_regs[REG_TEMPERATURE] = INT16_MAX;
+	m_regs[REG_PRESSURE0] = UINT16_MAX;
+	m_regs[REG_PRESSURE1] = UINT16_MAX;
+
+	zassert_equal(measure(CTR_S1_QUANTITY_ALL, &m), -EINVAL);
+
+	/* Failed quantities are NAN, the others are still converted */
+	zassert_true(isnan(m.temperature));
+	zassert_true(isnan(m.pressure));
+	zassert_within(m.co2_conc, 612.f, 0.01f);
+	zassert_within(m.humidity, 45.67f, 0.001f);
+	zassert_within(m.altitude, 235.f, 0.01f);
+
+	/* Quantities not requested do not fail the measurement */
+	zassert_ok(measure(CTR_S1_QUANTITY_HUMIDITY, &m));
+}
+
+ZTEST(drivers_ctr_s1_meas, test_half_sentinel)
+{
+	struct ctr_s1_measurement m;
+
+	/* Only both halves at their maximum mark an error */
+	m_regs[REG_ILLUM0] = UINT16_MAX;
+	m_regs[REG_ILLUM1] = 0;
+
+	zassert_ok(measure(CTR_S1_QUANTITY_ILLUMINANCE, &m));
+	zassert_within(m.illuminance, 65535.f, 0.5f);
+}
+
+ZTEST_SUITE(drivers_ctr_s1_meas, NULL, NULL, before, NULL, NULL);
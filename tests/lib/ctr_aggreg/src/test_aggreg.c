@@ -0,0 +1,272 @@
+/** @file
+ *  @brief streaming aggregation test suite
+ *
+ */
+
+#include <chester/ctr_aggreg.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SAMPLES 1000
+#define BENCH_ROUNDS 100
+
+static float m_samples[MAX_SAMPLES];
+static float m_work[MAX_SAMPLES];
+static uint32_t m_seed;
+
+static float rand_float(void)
+{
+	m_seed = m_seed * 1103515245 + 12345;
+
+	return (float)((m_seed >> 8) & 0xffff) / 0xffff;
+}
+
+enum shape {
+	SHAPE_UNIFORM,
+	SHAPE_NORMAL,
+	SHAPE_RAMP,
+	SHAPE_STEP,
+	SHAPE_CONST,
+	SHAPE_COUNT,
+};
+
+static void generate(enum shape shape, float *samples, size_t count)
+{
+	m_seed = 0x1234 + shape;
+
+	for (size_t i = 0; i < count; i++) {
+		switch (shape) {
+		case SHAPE_UNIFORM:
+			samples[i] = -20.f + 60.f * rand_float();
+			break;
+		case SHAPE_NORMAL:
+			/* Irwin-Hall approximation around 21.5 degrees */
+			samples[i] = 21.5f + (rand_float() + rand_float() + rand_float() +
+					      rand_float() - 2.f) * 3.f;
+			break;
+		case SHAPE_RAMP:
+			samples[i] = 0.1f * i;
+			break;
+		case SHAPE_STEP:
+			samples[i] = i < count / 3 ? 400.f : 1200.f + rand_float();
+			break;
+		default:
+			samples[i] = 42.f;
+			break;
+		}
+	}
+}
+
+/* Former per-application implementation used as the reference */
+static int compare(const void *a, const void *b)
+{
+	float fa = *(const float *)a;
+	float fb = *(const float *)b;
+
+	return (fa > fb) - (fa < fb);
+}
+
+static void aggreg(float *samples, size_t count, float *min, float *max, float *avg, float *mdn)
+{
+	*min = NAN;
+	*max = NAN;
+	*avg = NAN;
+	*mdn = NAN;
+
+	if (!count) {
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (isnan(samples[i])) {
+			return;
+		}
+	}
+
+	qsort(samples, count, sizeof(float), compare);
+
+	*min = samples[0];
+	*max = samples[count - 1];
+
+	double avg_ = 0;
+	for (size_t i = 0; i < count; i++) {
+		avg_ += (double)samples[i];
+	}
+	avg_ /= count;
+
+	*avg = avg_;
+	*mdn = samples[count / 2];
+}
+
+static void stream(const float *samples, size_t count, float *min, float *max, float *avg,
+		   float *mdn)
+{
+	struct ctr_aggreg aggreg;
+
+	ctr_aggreg_reset(&aggreg);
+
+	for (size_t i = 0; i < count; i++) {
+		ctr_aggreg_add(&aggreg, samples[i]);
+	}
+
+	ctr_aggreg_get(&aggreg, min, max, avg, mdn);
+}
+
+ZTEST(lib_ctr_aggreg, test_array_matches_qsort)
+{
+	static const size_t counts[] = {1, 2, 3, 4, 5, 6, 7, 31, 32, 33, 100, MAX_SAMPLES};
+
+	for (int shape = 0; shape < SHAPE_COUNT; shape++) {
+		for (size_t c = 0; c < ARRAY_SIZE(counts); c++) {
+			size_t count = counts[c];
+			float ref[4];
+			float res[4];
+
+			generate(shape, m_samples, count);
+
+			memcpy(m_work, m_samples, count * sizeof(float));
+			aggreg(m_work, count, &ref[0], &ref[1], &ref[2], &ref[3]);
+
+			memcpy(m_work, m_samples, count * sizeof(float));
+			ctr_aggreg_array(m_work, count, &res[0], &res[1], &res[2], &res[3]);
+
+			zassert_mem_equal(res, ref, sizeof(ref), "shape %d count %zu differs",
+					  shape, count);
+		}
+	}
+}
+
+ZTEST(lib_ctr_aggreg, test_stream_exact)
+{
+	for (int shape = 0; shape < SHAPE_COUNT; shape++) {
+		for (size_t count = 1; count <= MAX_SAMPLES; count += count < 8 ? 1 : count) {
+			float ref[4];
+			float res[4];
+
+			generate(shape, m_samples, count);
+
+			memcpy(m_work, m_samples, count * sizeof(float));
+			aggreg(m_work, count, &ref[0], &ref[1], &ref[2], &ref[3]);
+
+			stream(m_samples, count, &res[0], &res[1], &res[2], &res[3]);
+
+			zassert_equal(res[0], ref[0], "shape %d count %zu min", shape, count);
+			zassert_equal(res[1], ref[1], "shape %d count %zu max", shape, count);
+			zassert_within(res[2], ref[2], 1e-4f * fabsf(ref[2]) + 1e-6f,
+				       "shape %d count %zu avg", shape, count);
+
+			/* Up to five samples the median is not estimated */
+			if (count <= 5) {
+				zassert_equal(res[3], ref[3], "shape %d count %zu mdn", shape,
+					      count);
+			}
+		}
+	}
+}
+
+ZTEST(lib_ctr_aggreg, test_stream_median)
+{
+	static const size_t counts[] = {32, 100, MAX_SAMPLES};
+
+	for (int shape = 0; shape < SHAPE_COUNT; shape++) {
+		/* P-square assumes a stationary input - a step change is not estimated well */
+		if (shape == SHAPE_STEP) {
+			continue;
+		}
+
+		for (size_t c = 0; c < ARRAY_SIZE(counts); c++) {
+			size_t count = counts[c];
+			float ref[4];
+			float res[4];
+
+			generate(shape, m_samples, count);
+
+			memcpy(m_work, m_samples, count * sizeof(float));
+			aggreg(m_work, count, &ref[0], &ref[1], &ref[2], &ref[3]);
+
+			stream(m_samples, count, &res[0], &res[1], &res[2], &res[3]);
+
+			/* The estimate has to stay within 5 % of the sample range */
+			float tolerance = 0.05f * (ref[1] - ref[0]) + 1e-6f;
+
+			zassert_within(res[3], ref[3], tolerance,
+				       "shape %d count %zu mdn %f ref %f", shape, count,
+				       (double)res[3], (double)ref[3]);
+		}
+	}
+}
+
+ZTEST(lib_ctr_aggreg, test_nan)
+{
+	float res[4];
+	struct ctr_aggreg aggreg;
+
+	ctr_aggreg_reset(&aggreg);
+	ctr_aggreg_get(&aggreg, &res[0], &res[1], &res[2], &res[3]);
+
+	for (int i = 0; i < ARRAY_SIZE(res); i++) {
+		zassert_true(isnan(res[i]), "empty aggregation not NAN");
+	}
+
+	generate(SHAPE_UNIFORM, m_samples, 10);
+	m_samples[7] = NAN;
+
+	stream(m_samples, 10, &res[0], &res[1], &res[2], &res[3]);
+
+	for (int i = 0; i < ARRAY_SIZE(res); i++) {
+		zassert_true(isnan(res[i]), "stream with NAN sample not NAN");
+	}
+
+	ctr_aggreg_array(m_samples, 10, &res[0], &res[1], &res[2], &res[3]);
+
+	for (int i = 0; i < ARRAY_SIZE(res); i++) {
+		zassert_true(isnan(res[i]), "array with NAN sample not NAN");
+	}
+}
+
+ZTEST(lib_ctr_aggreg, test_benchmark)
+{
+	static const size_t counts[] = {32, 128, MAX_SAMPLES};
+
+	float res[4];
+	uint32_t start;
+
+	for (size_t c = 0; c < ARRAY_SIZE(counts); c++) {
+		size_t count = counts[c];
+
+		generate(SHAPE_NORMAL, m_samples, count);
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < BENCH_ROUNDS; r++) {
+			memcpy(m_work, m_samples, count * sizeof(float));
+			aggreg(m_work, count, &res[0], &res[1], &res[2], &res[3]);
+		}
+		uint32_t qsort_cyc = k_cycle_get_32() - start;
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < BENCH_ROUNDS; r++) {
+			memcpy(m_work, m_samples, count * sizeof(float));
+			ctr_aggreg_array(m_work, count, &res[0], &res[1], &res[2], &res[3]);
+		}
+		uint32_t array_cyc = k_cycle_get_32() - start;
+
+		start = k_cycle_get_32();
+		for (int r = 0; r < BENCH_ROUNDS; r++) {
+			stream(m_samples, count, &res[0], &res[1], &res[2], &res[3]);
+		}
+		uint32_t stream_cyc = k_cycle_get_32() - start;
+
+		printf("samples: %zu qsort: %u array: %u stream: %u cycles (%d rounds)\n", count,
+		       qsort_cyc, array_cyc, stream_cyc, BENCH_ROUNDS);
+		printf("samples: %zu memory qsort/array: %zu stream: %zu bytes\n", count,
+		       count * sizeof(float), sizeof(struct ctr_aggreg));
+	}
+}
+
+ZTEST_SUITE(lib_ctr_aggreg, NULL, NULL, NULL, NULL, NULL);
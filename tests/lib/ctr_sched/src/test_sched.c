@@ -0,0 +1,326 @@
+/** @file
+ *  @brief deadline-coalescing scheduler test suite
+ *
+ */
+
+#include <chester/ctr_sched.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TASKS 8
+#define MAX_LOG   64
+
+#define SECOND 1000LL
+#define MINUTE (60 * SECOND)
+#define HOUR   (60 * MINUTE)
+
+static struct ctr_sched m_sched;
+static struct ctr_sched_task m_tasks[MAX_TASKS];
+
+/* Simulated time */
+static int64_t m_now;
+
+static int64_t m_max_jitter[MAX_TASKS];
+static int64_t m_min_jitter[MAX_TASKS];
+
+/* Sequence of task indexes and group enter (100 + group) / leave (200 + group) markers */
+static int m_log[MAX_LOG];
+static int m_log_len;
+
+static int64_t sim_clock(void)
+{
+	return m_now;
+}
+
+static void log_event(int event)
+{
+	if (m_log_len < MAX_LOG) {
+		m_log[m_log_len++] = event;
+	}
+}
+
+static void task_cb(struct ctr_sched_task *task)
+{
+	int i = task - m_tasks;
+	int64_t jitter = m_now - task->deadline;
+
+	m_max_jitter[i] = MAX(m_max_jitter[i], jitter);
+	m_min_jitter[i] = MIN(m_min_jitter[i], jitter);
+
+	log_event(i);
+}
+
+static void group_cb(struct ctr_sched *sched, int group, bool enter)
+{
+	log_event((enter ? 100 : 200) + group);
+}
+
+static void add_task(int i, int64_t period, int64_t tolerance, int group)
+{
+	m_tasks[i].cb = task_cb;
+	m_tasks[i].period = period;
+	m_tasks[i].tolerance = tolerance;
+	m_tasks[i].group = group;
+
+	ctr_sched_add(&m_sched, &m_tasks[i]);
+}
+
+/* Advances the simulated time from wakeup to wakeup until the horizon */
+static void run_until(int64_t horizon)
+{
+	for (;;) {
+		int64_t next = ctr_sched_process(&m_sched);
+
+		if (next > horizon) {
+			m_now = horizon;
+			break;
+		}
+
+		zassert_true(next >= m_now, "wakeup in the past");
+		m_now = next;
+	}
+}
+
+static void before(void *fixture)
+{
+	memset(m_tasks, 0, sizeof(m_tasks));
+
+	for (int i = 0; i < MAX_TASKS; i++) {
+		m_max_jitter[i] = INT64_MIN;
+		m_min_jitter[i] = INT64_MAX;
+	}
+
+	m_log_len = 0;
+	m_now = 0;
+
+	ctr_sched_init(&m_sched, NULL, sim_clock, group_cb);
+}
+
+ZTEST(lib_ctr_sched, test_coalesce)
+{
+	/* Sample tasks sharing the interval but started at different phases */
+	for (int i = 0; i < MAX_TASKS; i++) {
+		add_task(i, MINUTE, 6 * SECOND, CTR_SCHED_GROUP_NONE);
+		ctr_sched_start(&m_sched, &m_tasks[i], MINUTE + i * 700);
+	}
+
+	run_until(HOUR + MINUTE / 2);
+
+	for (int i = 0; i < MAX_TASKS; i++) {
+		zassert_equal(m_tasks[i].runs, 60, "task %d runs %u", i, m_tasks[i].runs);
+		zassert_true(m_min_jitter[i] >= 0, "task %d ran early", i);
+		zassert_true(m_max_jitter[i] <= 6 * SECOND, "task %d jitter %lld", i,
+			     (long long)m_max_jitter[i]);
+	}
+
+	/* One wakeup per interval instead of one per task */
+	zassert_equal(m_sched.wakeups, 60, "wakeups %u", m_sched.wakeups);
+}
+
+ZTEST(lib_ctr_sched, test_mixed_intervals)
+{
+	/* Sample, aggregation and power tasks of the application */
+	add_task(0, MINUTE, 6 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(1, MINUTE, 6 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(2, 5 * MINUTE, 30 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(3, 5 * MINUTE, 30 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(4, 12 * HOUR, MINUTE, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], 0);
+	ctr_sched_start(&m_sched, &m_tasks[1], MINUTE);
+	ctr_sched_start(&m_sched, &m_tasks[2], 5 * MINUTE);
+	ctr_sched_start(&m_sched, &m_tasks[3], 5 * MINUTE + 5 * SECOND);
+	ctr_sched_start(&m_sched, &m_tasks[4], MINUTE);
+
+	run_until(24 * HOUR + MINUTE / 2);
+
+	uint32_t runs = 0;
+
+	for (int i = 0; i < 5; i++) {
+		zassert_true(m_min_jitter[i] >= 0, "task %d ran early", i);
+		zassert_true(m_max_jitter[i] <= m_tasks[i].tolerance, "task %d jitter %lld", i,
+			     (long long)m_max_jitter[i]);
+
+		runs += m_tasks[i].runs;
+	}
+
+	zassert_equal(m_tasks[0].runs, 24 * 60 + 1, "sample runs %u", m_tasks[0].runs);
+	zassert_equal(m_tasks[2].runs, 24 * 12, "aggregation runs %u", m_tasks[2].runs);
+	zassert_equal(m_tasks[4].runs, 2, "power runs %u", m_tasks[4].runs);
+
+	/* Everything rides on the sample wakeups */
+	zassert_equal(m_sched.wakeups, m_tasks[0].runs, "wakeups %u of %u runs", m_sched.wakeups,
+		      runs);
+}
+
+ZTEST(lib_ctr_sched, test_no_tolerance)
+{
+	add_task(0, MINUTE, 0, CTR_SCHED_GROUP_NONE);
+	add_task(1, MINUTE, 0, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], MINUTE);
+	ctr_sched_start(&m_sched, &m_tasks[1], MINUTE + SECOND);
+
+	run_until(10 * MINUTE + 30 * SECOND);
+
+	/* Deadlines one second apart cannot be merged */
+	zassert_equal(m_sched.wakeups, 20, "wakeups %u", m_sched.wakeups);
+
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(m_tasks[i].runs, 10, "task %d runs %u", i, m_tasks[i].runs);
+		zassert_equal(m_max_jitter[i], 0, "task %d jitter %lld", i,
+			      (long long)m_max_jitter[i]);
+		zassert_equal(m_min_jitter[i], 0, "task %d jitter %lld", i,
+			      (long long)m_min_jitter[i]);
+	}
+}
+
+ZTEST(lib_ctr_sched, test_group)
+{
+	/* Registration interleaves the 1-Wire (1) and ADC (2) tasks with ungrouped ones */
+	add_task(0, MINUTE, 10 * SECOND, 1);
+	add_task(1, MINUTE, 10 * SECOND, 2);
+	add_task(2, MINUTE, 10 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(3, MINUTE, 10 * SECOND, 1);
+	add_task(4, MINUTE, 10 * SECOND, 2);
+
+	for (int i = 0; i < 5; i++) {
+		ctr_sched_start(&m_sched, &m_tasks[i], MINUTE + i * SECOND);
+	}
+
+	run_until(MINUTE + 30 * SECOND);
+
+	static const int expected[] = {101, 0, 3, 201, 102, 1, 4, 202, 2};
+
+	zassert_equal(m_sched.wakeups, 1, "wakeups %u", m_sched.wakeups);
+	zassert_equal(m_log_len, ARRAY_SIZE(expected), "log length %d", m_log_len);
+	zassert_mem_equal(m_log, expected, sizeof(expected), "batch order mismatch");
+}
+
+ZTEST(lib_ctr_sched, test_one_shot)
+{
+	add_task(0, 0, 5 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(1, MINUTE, 10 * SECOND, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], 2 * MINUTE);
+	ctr_sched_start(&m_sched, &m_tasks[1], MINUTE);
+
+	run_until(10 * MINUTE + 30 * SECOND);
+
+	zassert_equal(m_tasks[0].runs, 1, "one-shot runs %u", m_tasks[0].runs);
+	zassert_equal(m_tasks[1].runs, 10, "periodic runs %u", m_tasks[1].runs);
+
+	/* The one-shot merges with the periodic wakeup at two minutes */
+	zassert_equal(m_sched.wakeups, 10, "wakeups %u", m_sched.wakeups);
+}
+
+ZTEST(lib_ctr_sched, test_start_stop)
+{
+	add_task(0, MINUTE, 0, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], MINUTE);
+	run_until(5 * MINUTE + 30 * SECOND);
+	zassert_equal(m_tasks[0].runs, 5, "runs %u", m_tasks[0].runs);
+
+	ctr_sched_stop(&m_sched, &m_tasks[0]);
+	zassert_equal(ctr_sched_process(&m_sched), INT64_MAX, "stopped task scheduled");
+
+	run_until(10 * MINUTE + 30 * SECOND);
+	zassert_equal(m_tasks[0].runs, 5, "stopped task ran");
+
+	/* Restart runs immediately and keeps the new phase */
+	ctr_sched_start(&m_sched, &m_tasks[0], 0);
+	run_until(12 * MINUTE + 30 * SECOND);
+	zassert_equal(m_tasks[0].runs, 8, "runs %u", m_tasks[0].runs);
+	zassert_equal(m_tasks[0].deadline, 12 * MINUTE + 30 * SECOND, "phase lost");
+}
+
+ZTEST(lib_ctr_sched, test_urgent)
+{
+	add_task(0, MINUTE, 10 * SECOND, CTR_SCHED_GROUP_NONE);
+	add_task(1, MINUTE, 10 * SECOND, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], MINUTE);
+	run_until(55 * SECOND);
+
+	/* On-demand start skips the tolerance of the first run only */
+	ctr_sched_start(&m_sched, &m_tasks[1], 0);
+	zassert_equal(ctr_sched_process(&m_sched), MINUTE + 10 * SECOND, "next wakeup");
+	zassert_equal(m_tasks[1].runs, 1, "urgent task not run");
+	zassert_equal(m_tasks[1].deadline, 55 * SECOND, "deadline %lld",
+		      (long long)m_tasks[1].deadline);
+
+	run_until(2 * MINUTE + 30 * SECOND);
+
+	/* The second run of the task joins the batch of the other one */
+	zassert_equal(m_tasks[0].runs, 2, "runs %u", m_tasks[0].runs);
+	zassert_equal(m_tasks[1].runs, 2, "runs %u", m_tasks[1].runs);
+	zassert_equal(m_sched.wakeups, 3, "wakeups %u", m_sched.wakeups);
+}
+
+ZTEST(lib_ctr_sched, test_late)
+{
+	add_task(0, MINUTE, SECOND, CTR_SCHED_GROUP_NONE);
+
+	ctr_sched_start(&m_sched, &m_tasks[0], MINUTE);
+	run_until(MINUTE);
+	zassert_equal(m_tasks[0].runs, 0, "ran before the tolerance elapsed");
+
+	/* The system was busy for several intervals - missed runs are skipped, not bunched */
+	m_now = 5 * MINUTE + 30 * SECOND;
+	ctr_sched_process(&m_sched);
+	zassert_equal(m_tasks[0].runs, 1, "runs %u", m_tasks[0].runs);
+
+	run_until(6 * MINUTE + 30 * SECOND);
+	zassert_equal(m_tasks[0].runs, 2, "runs %u", m_tasks[0].runs);
+	zassert_equal(m_tasks[0].deadline, 6 * MINUTE, "deadline %lld",
+		      (long long)m_tasks[0].deadline);
+}
+
+static bool m_is_locked;
+
+static void unlocked_cb(struct ctr_sched_task *task)
+{
+	/* A callback may wait for a thread that starts or stops tasks itself */
+	m_is_locked |= m_sched.lock.owner != NULL;
+
+	task_cb(task);
+}
+
+static void unlocked_group_cb(struct ctr_sched *sched, int group, bool enter)
+{
+	m_is_locked |= sched->lock.owner != NULL;
+
+	group_cb(sched, group, enter);
+}
+
+ZTEST(lib_ctr_sched, test_unlocked)
+{
+	ctr_sched_init(&m_sched, NULL, sim_clock, unlocked_group_cb);
+
+	add_task(0, MINUTE, 0, 1);
+	add_task(1, MINUTE, 0, CTR_SCHED_GROUP_NONE);
+
+	for (int i = 0; i < 2; i++) {
+		m_tasks[i].cb = unlocked_cb;
+		ctr_sched_start(&m_sched, &m_tasks[i], MINUTE);
+	}
+
+	m_is_locked = false;
+
+	run_until(MINUTE);
+
+	static const int expected[] = {101, 0, 201, 1};
+
+	zassert_equal(m_log_len, ARRAY_SIZE(expected), "log length %d", m_log_len);
+	zassert_mem_equal(m_log, expected, sizeof(expected), "batch order mismatch");
+	zassert_false(m_is_locked, "callback run with the lock held");
+}
+
+ZTEST_SUITE(lib_ctr_sched, NULL, NULL, before, NULL, NULL);
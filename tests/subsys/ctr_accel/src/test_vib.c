@@ -0,0 +1,136 @@
+/** @file
+ *  @brief vibration feature extraction test suite
+ *
+ */
+
+#include "ctr_accel_vib.h"
+
+#include <chester/ctr_accel.h>
+
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+
+#define SAMPLE_RATE 400
+#define WINDOW      256
+#define GRAVITY     9.80665f
+
+static struct ctr_accel_vib_ctx m_ctx;
+static struct ctr_accel_vib m_vib;
+
+/* Feeds one window and returns the number of completed windows */
+static int feed_sine(float freq_x, float amp_x, float freq_z, float amp_z)
+{
+	int completed = 0;
+
+	for (int n = 0; n < WINDOW; n++) {
+		float t = (float)n / SAMPLE_RATE;
+		float xyz[3] = {
+			amp_x * sinf(2.f * (float)M_PI * freq_x * t),
+			0.f,
+			GRAVITY + amp_z * sinf(2.f * (float)M_PI * freq_z * t),
+		};
+
+		if (ctr_accel_vib_feed(&m_ctx, xyz, &m_vib)) {
+			completed++;
+		}
+	}
+
+	return completed;
+}
+
+static float band_sum(const struct ctr_accel_vib_axis *axis)
+{
+	float sum = 0.f;
+
+	for (int b = 0; b < CTR_ACCEL_VIB_BAND_COUNT; b++) {
+		sum += axis->band[b];
+	}
+
+	return sum;
+}
+
+static void before(void *fixture)
+{
+	zassert_ok(ctr_accel_vib_init(&m_ctx, SAMPLE_RATE, WINDOW), "ctr_accel_vib_init failed");
+}
+
+ZTEST(subsus_ctr_accel_vib, test_band)
+{
+	/* Bin-centered tones - 25 Hz (bin 16) falls into band 0, 125 Hz (bin 80) into band 2 */
+	zassert_equal(feed_sine(25.f, 2.f, 125.f, 1.f), 1, "window not completed");
+
+	zassert_equal(m_vib.sample_rate, SAMPLE_RATE, "sample rate mismatch");
+	zassert_equal(m_vib.window, WINDOW, "window mismatch");
+
+	const struct ctr_accel_vib_axis *x = &m_vib.axis[CTR_ACCEL_AXIS_X];
+	const struct ctr_accel_vib_axis *z = &m_vib.axis[CTR_ACCEL_AXIS_Z];
+
+	zassert_within(x->band[0], 2.f, 0.01f, "x band 0 %f", (double)x->band[0]);
+	zassert_within(x->band[1], 0.f, 0.01f, "x band 1 %f", (double)x->band[1]);
+	zassert_within(x->band[2], 0.f, 0.01f, "x band 2 %f", (double)x->band[2]);
+	zassert_within(x->band[3], 0.f, 0.01f, "x band 3 %f", (double)x->band[3]);
+
+	zassert_within(z->band[0], 0.f, 0.01f, "z band 0 %f", (double)z->band[0]);
+	zassert_within(z->band[1], 0.f, 0.01f, "z band 1 %f", (double)z->band[1]);
+	zassert_within(z->band[2], 0.5f, 0.01f, "z band 2 %f", (double)z->band[2]);
+	zassert_within(z->band[3], 0.f, 0.01f, "z band 3 %f", (double)z->band[3]);
+
+	/* Gravity is removed, the bands add up to the AC mean square */
+	zassert_within(band_sum(z), z->rms * z->rms, 0.01f, "parseval mismatch");
+	zassert_within(z->rms, 1.f / (float)M_SQRT2, 0.01f, "z rms %f", (double)z->rms);
+
+	zassert_within(m_vib.axis[CTR_ACCEL_AXIS_Y].rms, 0.f, 1e-6f, "y rms not zero");
+}
+
+ZTEST(subsus_ctr_accel_vib, test_statistics)
+{
+	zassert_equal(feed_sine(50.f, 3.f, 50.f, 0.f), 1, "window not completed");
+
+	const struct ctr_accel_vib_axis *x = &m_vib.axis[CTR_ACCEL_AXIS_X];
+
+	zassert_within(x->rms, 3.f / (float)M_SQRT2, 0.01f, "rms %f", (double)x->rms);
+	zassert_within(x->p2p, 6.f, 0.01f, "p2p %f", (double)x->p2p);
+
+	/* Kurtosis of a sine is 1.5 */
+	zassert_within(x->kurtosis, 1.5f, 0.01f, "kurtosis %f", (double)x->kurtosis);
+}
+
+ZTEST(subsus_ctr_accel_vib, test_impulse)
+{
+	/* Bearing-fault-like impacts raise the kurtosis well above a sine */
+	for (int n = 0; n < WINDOW; n++) {
+		float xyz[3] = {n % 64 == 0 ? 10.f : 0.f, 0.f, GRAVITY};
+
+		ctr_accel_vib_feed(&m_ctx, xyz, &m_vib);
+	}
+
+	zassert_true(m_vib.axis[CTR_ACCEL_AXIS_X].kurtosis > 10.f, "kurtosis %f",
+		     (double)m_vib.axis[CTR_ACCEL_AXIS_X].kurtosis);
+}
+
+ZTEST(subsus_ctr_accel_vib, test_window)
+{
+	zassert_equal(ctr_accel_vib_init(&m_ctx, SAMPLE_RATE, 100), -EINVAL,
+		      "window not a power of two accepted");
+	zassert_equal(ctr_accel_vib_init(&m_ctx, SAMPLE_RATE, 512), -EINVAL,
+		      "window over maximum accepted");
+
+	zassert_ok(ctr_accel_vib_init(&m_ctx, SAMPLE_RATE, 64), "ctr_accel_vib_init failed");
+
+	int completed = 0;
+
+	for (int n = 0; n < 200; n++) {
+		float xyz[3] = {0.f, 0.f, GRAVITY};
+
+		if (ctr_accel_vib_feed(&m_ctx, xyz, &m_vib)) {
+			completed++;
+		}
+	}
+
+	zassert_equal(completed, 3, "expected 3 windows of 64 samples");
+}
+
+ZTEST_SUITE(subsus_ctr_accel_vib, NULL, NULL, before, NULL, NULL);
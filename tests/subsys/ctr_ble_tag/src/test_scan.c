@@ -0,0 +1,264 @@
+/** @file
+ *  @brief BLE tag periodic scan test suite
+ *
+ */
+
+/*
+ * Test cases:
+ *
+ * - test_find:        Enrolled addresses are found in their slots, others are not
+ * - test_collision:   Addresses hashing to the same bucket are probed in turn
+ * - test_period:      Shorter gap replaces the learned period, longer one drifts it
+ * - test_scan_rsp:    Scan response is only counted for tags without primary data
+ * - test_window:      Window spans the slowest period, until all are learned it is the duration
+ * - test_early_stop:  Cycle may stop once every enrolled tag is fresh
+ * - test_radio_on:    Ended cycle accounts the radio-on time and relearns the missed tags
+ */
+
+#include "ctr_ble_tag_scan.h"
+
+#include <chester/ctr_ble_tag.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define DURATION 12000
+
+static struct ctr_ble_tag_scan m_scan;
+static uint8_t m_addr[CTR_BLE_TAG_COUNT][BT_ADDR_SIZE];
+
+/* The hash only covers the low three bytes, the high byte makes the address unique */
+static void set_addr(int slot, uint8_t low, uint8_t high)
+{
+	uint8_t addr[BT_ADDR_SIZE] = {low, 0x22, 0x33, 0x44, 0x55, high};
+
+	memcpy(m_addr[slot], addr, BT_ADDR_SIZE);
+}
+
+/* Hears the primary advert of the slot at the given times */
+static bool hear(int slot, const int64_t *times, int count)
+{
+	bool stop = false;
+
+	for (int i = 0; i < count; i++) {
+		stop = ctr_ble_tag_scan_track(&m_scan, slot, false, times[i], DURATION);
+	}
+
+	return stop;
+}
+
+static void before(void *fixture)
+{
+	memset(&m_scan, 0, sizeof(m_scan));
+	memset(m_addr, 0, sizeof(m_addr));
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_find)
+{
+	set_addr(0, 0x01, 0x01);
+	set_addr(2, 0x02, 0x01);
+	set_addr(5, 0x03, 0x01);
+
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	zassert_equal(m_scan.enrolled_mask, BIT(0) | BIT(2) | BIT(5), "mask 0x%x",
+		      m_scan.enrolled_mask);
+
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, m_addr[0]), 0, "slot 0");
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, m_addr[2]), 2, "slot 2");
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, m_addr[5]), 5, "slot 5");
+
+	uint8_t unknown[BT_ADDR_SIZE] = {0x04, 0x22, 0x33, 0x44, 0x55, 0x01};
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, unknown), -ENOENT, "unknown found");
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_collision)
+{
+	/* Every slot lands in the same bucket, the probe chain spans all of them */
+	for (int slot = 0; slot < CTR_BLE_TAG_COUNT; slot++) {
+		set_addr(slot, 0x01, slot + 1);
+	}
+
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	int used = 0;
+	for (int i = 0; i < CTR_BLE_TAG_SCAN_MAP_SIZE; i++) {
+		used += m_scan.map[i] ? 1 : 0;
+	}
+
+	zassert_equal(used, CTR_BLE_TAG_COUNT, "used buckets %d", used);
+
+	for (int slot = 0; slot < CTR_BLE_TAG_COUNT; slot++) {
+		zassert_equal(ctr_ble_tag_scan_find(&m_scan, m_addr[slot]), slot, "slot %d", slot);
+	}
+
+	/* Same bucket, not enrolled - the probe ends at the first free bucket */
+	uint8_t unknown[BT_ADDR_SIZE] = {0x01, 0x22, 0x33, 0x44, 0x55, 0xff};
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, unknown), -ENOENT, "unknown found");
+
+	/* A removed address leaves its bucket free after the rebuild */
+	memset(m_addr[3], 0, BT_ADDR_SIZE);
+
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	zassert_false(m_scan.enrolled_mask & BIT(3), "removed slot enrolled");
+	zassert_equal(ctr_ble_tag_scan_find(&m_scan, m_addr[7]), 7, "slot 7");
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_period)
+{
+	set_addr(0, 0x01, 0x01);
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	/* Not counted outside a cycle */
+	zassert_false(ctr_ble_tag_scan_track(&m_scan, 0, false, 0, DURATION), "stop");
+	zassert_equal(m_scan.heard_mask, 0, "heard outside cycle");
+
+	ctr_ble_tag_scan_begin(&m_scan, 0);
+
+	hear(0, (int64_t[]){0, 1000}, 2);
+	zassert_equal(m_scan.slots[0].period, 1000, "period %d", m_scan.slots[0].period);
+
+	/* Two adverts lost - the estimate only drifts */
+	hear(0, (int64_t[]){4000}, 1);
+	zassert_equal(m_scan.slots[0].period, 1250, "period %d", m_scan.slots[0].period);
+
+	/* Faster advertising is taken at once */
+	hear(0, (int64_t[]){4800}, 1);
+	zassert_equal(m_scan.slots[0].period, 800, "period %d", m_scan.slots[0].period);
+
+	/* Gap capped at the scan duration */
+	m_scan.slots[0].period = 0;
+	hear(0, (int64_t[]){4800 + 2 * DURATION}, 1);
+	zassert_equal(m_scan.slots[0].period, DURATION, "period %d", m_scan.slots[0].period);
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_scan_rsp)
+{
+	set_addr(0, 0x01, 0x01);
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+	ctr_ble_tag_scan_begin(&m_scan, 0);
+
+	/* Without primary data the scan response carries the readings */
+	ctr_ble_tag_scan_track(&m_scan, 0, true, 0, DURATION);
+	zassert_equal(m_scan.heard_mask, BIT(0), "scan response not counted");
+	zassert_false(m_scan.slots[0].primary, "primary");
+
+	ctr_ble_tag_scan_track(&m_scan, 0, false, 500, DURATION);
+	zassert_true(m_scan.slots[0].primary, "primary not learned");
+	zassert_equal(m_scan.slots[0].period, 500, "period %d", m_scan.slots[0].period);
+
+	/* Response to the advert just counted */
+	zassert_false(ctr_ble_tag_scan_track(&m_scan, 0, true, 510, DURATION), "stop");
+	zassert_equal(m_scan.slots[0].last_heard, 500, "last heard %lld",
+		      m_scan.slots[0].last_heard);
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_window)
+{
+	bool passive;
+
+	/* Nothing enrolled */
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, DURATION, &passive), 0, "window");
+	zassert_true(passive, "passive");
+
+	set_addr(0, 0x01, 0x01);
+	set_addr(1, 0x02, 0x01);
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, DURATION, &passive), DURATION,
+		      "window");
+	zassert_false(passive, "passive");
+
+	ctr_ble_tag_scan_begin(&m_scan, 0);
+	hear(0, (int64_t[]){0, 1000}, 2);
+
+	/* One period still unknown */
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, DURATION, &passive), DURATION,
+		      "window");
+
+	hear(1, (int64_t[]){0, 2000}, 2);
+
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, DURATION, &passive),
+		      2000 * CTR_BLE_TAG_SCAN_WINDOW_PERIODS, "window");
+	zassert_true(passive, "passive");
+
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, 5000, &passive), 5000, "window");
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_early_stop)
+{
+	set_addr(0, 0x01, 0x01);
+	set_addr(1, 0x02, 0x01);
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+	ctr_ble_tag_scan_begin(&m_scan, 0);
+
+	zassert_false(hear(0, (int64_t[]){0, 1000}, 2), "stop with a tag missing");
+
+	/* Heard once, period not known yet */
+	zassert_false(hear(1, (int64_t[]){1100}, 1), "stop with a tag not fresh");
+	zassert_equal(m_scan.fresh_mask, BIT(0), "fresh 0x%x", m_scan.fresh_mask);
+
+	zassert_true(hear(1, (int64_t[]){2100}, 1), "no stop with all tags fresh");
+
+	/* A new cycle starts from nothing heard, the learned periods make the tags fresh again */
+	ctr_ble_tag_scan_begin(&m_scan, 10000);
+	zassert_equal(m_scan.heard_mask, 0, "heard 0x%x", m_scan.heard_mask);
+
+	zassert_false(hear(0, (int64_t[]){10000}, 1), "stop with a tag missing");
+	zassert_true(hear(1, (int64_t[]){10100}, 1), "no stop with all tags fresh");
+}
+
+ZTEST(subsys_ctr_ble_tag_scan, test_radio_on)
+{
+	set_addr(0, 0x01, 0x01);
+	set_addr(1, 0x02, 0x01);
+	set_addr(2, 0x03, 0x01);
+	ctr_ble_tag_scan_build(&m_scan, m_addr);
+
+	ctr_ble_tag_scan_begin(&m_scan, 1000);
+	hear(0, (int64_t[]){1000, 2000}, 2);
+	hear(1, (int64_t[]){1500, 2500}, 2);
+	hear(2, (int64_t[]){1200, 2200}, 2);
+
+	zassert_true(ctr_ble_tag_scan_end(&m_scan, 2300), "cycle not complete");
+	zassert_false(m_scan.cycle_active, "cycle active");
+	zassert_equal(m_scan.stats.last_radio_on, 1300, "radio on %lld",
+		      m_scan.stats.last_radio_on);
+	zassert_equal(m_scan.stats.early_cycles, 1, "early cycles %u", m_scan.stats.early_cycles);
+
+	/* Tag 2 missed and tag 1 heard once - only the missed one is relearned */
+	ctr_ble_tag_scan_begin(&m_scan, 10000);
+	hear(0, (int64_t[]){10000}, 1);
+	hear(1, (int64_t[]){10500}, 1);
+
+	zassert_false(ctr_ble_tag_scan_end(&m_scan, 10000 + DURATION), "cycle complete");
+	zassert_equal(m_scan.stats.last_radio_on, DURATION, "radio on %lld",
+		      m_scan.stats.last_radio_on);
+	zassert_equal(m_scan.stats.total_radio_on, 1300 + DURATION, "total %lld",
+		      m_scan.stats.total_radio_on);
+	zassert_equal(m_scan.stats.cycles, 2, "cycles %u", m_scan.stats.cycles);
+	zassert_equal(m_scan.stats.early_cycles, 1, "early cycles %u", m_scan.stats.early_cycles);
+	zassert_equal(m_scan.stats.last_heard, 2, "heard %d", m_scan.stats.last_heard);
+	zassert_equal(m_scan.stats.last_enrolled, 3, "enrolled %d", m_scan.stats.last_enrolled);
+
+	zassert_equal(m_scan.slots[1].period, 1000, "period %d", m_scan.slots[1].period);
+	zassert_equal(m_scan.slots[2].period, 0, "period %d", m_scan.slots[2].period);
+	zassert_false(m_scan.slots[2].primary, "primary");
+
+	/* The relearned tag makes the next window active and as long as the duration */
+	bool passive;
+	zassert_equal(ctr_ble_tag_scan_get_window(&m_scan, DURATION, &passive), DURATION,
+		      "window");
+	zassert_false(passive, "passive");
+}
+
+ZTEST_SUITE(subsys_ctr_ble_tag_scan, NULL, NULL, before, NULL, NULL);
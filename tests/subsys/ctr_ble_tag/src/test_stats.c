@@ -0,0 +1,58 @@
+/** @file
+ *  @brief BLE tag scan statistics test suite
+ *
+ */
+
+#include "ctr_ble_tag_stats.h"
+
+#include <chester/ctr_ble_tag.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+static struct ctr_ble_tag_scan_stats m_stats;
+
+static void before(void *fixture)
+{
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+ZTEST(subsys_ctr_ble_tag_stats, test_cycles)
+{
+	ctr_ble_tag_stats_add(&m_stats, 12000, 2, 3, false);
+	ctr_ble_tag_stats_add(&m_stats, 850, 3, 3, true);
+	ctr_ble_tag_stats_add(&m_stats, 920, 3, 3, true);
+
+	zassert_equal(m_stats.cycles, 3, "cycles %u", m_stats.cycles);
+	zassert_equal(m_stats.early_cycles, 2, "early cycles %u", m_stats.early_cycles);
+	zassert_equal(m_stats.total_radio_on, 13770, "total %lld", m_stats.total_radio_on);
+	zassert_equal(m_stats.last_radio_on, 920, "last %lld", m_stats.last_radio_on);
+	zassert_equal(m_stats.last_heard, 3, "heard %d", m_stats.last_heard);
+	zassert_equal(m_stats.last_enrolled, 3, "enrolled %d", m_stats.last_enrolled);
+}
+
+ZTEST(subsys_ctr_ble_tag_stats, test_missed)
+{
+	ctr_ble_tag_stats_add(&m_stats, 12000, 1, 4, false);
+
+	zassert_equal(m_stats.cycles, 1, "cycles %u", m_stats.cycles);
+	zassert_equal(m_stats.early_cycles, 0, "early cycles %u", m_stats.early_cycles);
+	zassert_equal(m_stats.last_heard, 1, "heard %d", m_stats.last_heard);
+	zassert_equal(m_stats.last_enrolled, 4, "enrolled %d", m_stats.last_enrolled);
+}
+
+ZTEST(subsys_ctr_ble_tag_stats, test_negative)
+{
+	/* Uptime going backwards must not reduce the total */
+	ctr_ble_tag_stats_add(&m_stats, 500, 1, 1, true);
+	ctr_ble_tag_stats_add(&m_stats, -10, 1, 1, true);
+
+	zassert_equal(m_stats.total_radio_on, 500, "total %lld", m_stats.total_radio_on);
+	zassert_equal(m_stats.last_radio_on, 0, "last %lld", m_stats.last_radio_on);
+}
+
+ZTEST_SUITE(subsys_ctr_ble_tag_stats, NULL, NULL, before, NULL, NULL);
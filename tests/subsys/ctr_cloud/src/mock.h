@@ -1,8 +1,19 @@
 #ifndef TESTS_SUBSYS_CTR_CLOUD_SRC_MOCK_H_
 #define TESTS_SUBSYS_CTR_CLOUD_SRC_MOCK_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 void *mock_global_setup_suite(void);
 
 void mock_ctr_lte_v2_set_send_recv(char **list, int size);
 
+void mock_ctr_lte_v2_set_server(const uint8_t token[16], int send_delay_ms, int rtt_ms,
+				int drop_packet);
+void mock_ctr_lte_v2_get_server_stats(const uint8_t **data, size_t *len, int *packets,
+				      int *responses);
+/* Frames as received by the server in order, including the dropped ones */
+int mock_ctr_lte_v2_get_server_frame(int index, uint16_t *sequence, uint8_t *flags, size_t *len,
+				     uint32_t *crc);
+
 #endif
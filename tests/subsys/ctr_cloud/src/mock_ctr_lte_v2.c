@@ -2,6 +2,8 @@
 #include "mock.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/base64.h>
 #include <zephyr/ztest.h>
 
 #include <chester/ctr_buf.h>
@@ -73,8 +75,156 @@ void mock_ctr_lte_v2_set_send_recv(char **list, int size)
 	mock_com.list = list;
 }
 
+#define SERVER_MAX_FRAMES 64
+
+struct server_frame {
+	uint16_t sequence;
+	uint8_t flags;
+	size_t len;
+	uint32_t crc;
+};
+
+static struct {
+	bool enabled;
+	uint8_t token[16];
+	int send_delay_ms;
+	int rtt_ms;
+	int drop_packet;
+
+	int packets;
+	int responses;
+	uint16_t expect;
+	bool in_order;
+	uint8_t data[16384];
+	size_t len;
+	struct server_frame frames[SERVER_MAX_FRAMES];
+} mock_server;
+
+void mock_ctr_lte_v2_set_server(const uint8_t token[16], int send_delay_ms, int rtt_ms,
+				int drop_packet)
+{
+	memset(&mock_server, 0, sizeof(mock_server));
+
+	mock_server.enabled = token != NULL;
+	if (token) {
+		memcpy(mock_server.token, token, sizeof(mock_server.token));
+	}
+
+	mock_server.send_delay_ms = send_delay_ms;
+	mock_server.rtt_ms = rtt_ms;
+	mock_server.drop_packet = drop_packet;
+}
+
+void mock_ctr_lte_v2_get_server_stats(const uint8_t **data, size_t *len, int *packets,
+				      int *responses)
+{
+	*data = mock_server.data;
+	*len = mock_server.len;
+	*packets = mock_server.packets;
+	*responses = mock_server.responses;
+}
+
+int mock_ctr_lte_v2_get_server_frame(int index, uint16_t *sequence, uint8_t *flags, size_t *len,
+				     uint32_t *crc)
+{
+	if (index < 0 || index >= MIN(mock_server.packets, SERVER_MAX_FRAMES)) {
+		return -ENOENT;
+	}
+
+	*sequence = mock_server.frames[index].sequence;
+	*flags = mock_server.frames[index].flags;
+	*len = mock_server.frames[index].len;
+	*crc = mock_server.frames[index].crc;
+
+	return 0;
+}
+
+/* Emulates the cloud server side of the uplink: reassembles fragments received in order and
+ * responds with the sequence it expects next. A response acknowledging all received fragments
+ * consumes its own sequence number, a response pointing at a gap does not. */
+static int server_send_recv(const struct ctr_lte_v2_send_recv_param *param)
+{
+	static uint8_t pck_mem[CTR_CLOUD_PACKET_MAX_SIZE];
+	struct ctr_buf pck_buf = {.mem = pck_mem, .size = sizeof(pck_mem)};
+	struct ctr_cloud_packet pck;
+	size_t len;
+
+	k_msleep(mock_server.send_delay_ms);
+
+	if (param->send_as_string) {
+		zassert_ok(base64_decode(pck_buf.mem, pck_buf.size, &len, param->send_buf,
+					 param->send_len));
+	} else {
+		zassert_true(param->send_len <= pck_buf.size);
+		memcpy(pck_buf.mem, param->send_buf, param->send_len);
+		len = param->send_len;
+	}
+	pck_buf.len = len;
+
+	zassert_ok(ctr_cloud_packet_unpack(&pck, mock_server.token, &pck_buf));
+
+	if (mock_server.packets < SERVER_MAX_FRAMES) {
+		struct server_frame *frame = &mock_server.frames[mock_server.packets];
+
+		frame->sequence = pck.sequence;
+		frame->flags = pck.flags;
+		frame->len = pck.data_len;
+		frame->crc = crc32_ieee(pck.data, pck.data_len);
+	}
+
+	bool dropped = mock_server.packets++ == mock_server.drop_packet;
+
+	if (!dropped) {
+		if (pck.flags & CTR_CLOUD_PACKET_FLAG_FIRST) {
+			mock_server.len = 0;
+			mock_server.expect = pck.sequence;
+		}
+
+		mock_server.in_order = pck.sequence == mock_server.expect;
+		if (mock_server.in_order) {
+			memcpy(&mock_server.data[mock_server.len], pck.data, pck.data_len);
+			mock_server.len += pck.data_len;
+			mock_server.expect = ctr_cloud_packet_sequence_inc(pck.sequence);
+		}
+	}
+
+	if (!param->recv_buf) {
+		return 0;
+	}
+
+	k_msleep(mock_server.rtt_ms);
+
+	mock_server.responses++;
+
+	struct ctr_cloud_packet ack = {
+		.serial_number = pck.serial_number,
+		.sequence = mock_server.expect,
+	};
+
+	if (!dropped && mock_server.in_order) {
+		mock_server.expect = ctr_cloud_packet_sequence_inc(mock_server.expect);
+	}
+
+	zassert_ok(ctr_cloud_packet_pack(&ack, mock_server.token, &pck_buf));
+
+	if (param->send_as_string) {
+		zassert_ok(base64_encode(param->recv_buf, param->recv_size, param->recv_len,
+					 pck_buf.mem, pck_buf.len));
+	} else {
+		zassert_true(pck_buf.len <= param->recv_size);
+		memcpy(param->recv_buf, pck_buf.mem, pck_buf.len);
+		*param->recv_len = pck_buf.len;
+	}
+
+	return 0;
+}
+
 int ctr_lte_v2_send_recv(const struct ctr_lte_v2_send_recv_param *param)
 {
+	if (mock_server.enabled) {
+		return server_send_recv(param);
+	}
+
 	printf("mock: ctr_lte_v2_send_recv %d\n", mock_com.index);
 
 	for (size_t i = 0; i < param->send_len; i++) {
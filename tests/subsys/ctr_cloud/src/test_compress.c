@@ -0,0 +1,102 @@
+/** @file
+ *  @brief cloud compression test suite
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <ctr_cloud_compress.h>
+
+#include <stdint.h>
+#include <string.h>
+
+static uint8_t m_src[2048];
+static uint8_t m_packed[CTR_CLOUD_COMPRESS_BOUND(sizeof(m_src))];
+static uint8_t m_unpacked[sizeof(m_src)];
+
+static size_t round_trip(size_t len)
+{
+	size_t packed_len;
+	size_t unpacked_len;
+
+	int ret = ctr_cloud_compress(m_src, len, m_packed, sizeof(m_packed), &packed_len);
+	zassert_ok(ret, "ctr_cloud_compress failed");
+	zassert_true(packed_len <= CTR_CLOUD_COMPRESS_BOUND(len), "bound exceeded");
+
+	ret = ctr_cloud_decompress(m_packed, packed_len, m_unpacked, sizeof(m_unpacked),
+				   &unpacked_len);
+	zassert_ok(ret, "ctr_cloud_decompress failed");
+	zassert_equal(unpacked_len, len, "length not equal");
+	zassert_mem_equal(m_unpacked, m_src, len, "data not equal");
+
+	return packed_len;
+}
+
+ZTEST(subsus_ctr_cloud_4_compress, test_round_trip_cbor_like)
+{
+	size_t len = 0;
+
+	/* Nested maps with integer keys and aggregated quadruples - mimics app_cbor.c */
+	while (len + 16 <= sizeof(m_src)) {
+		uint8_t record[] = {0xa4, 0x00, 0x19, 0x01, 0x2c, 0x01, 0x84, 0x18,
+				    0xd2, 0x18, 0xd7, 0x18, 0xd4, 0x18, 0xd5, 0xff};
+
+		record[4] = len / 16;
+		memcpy(&m_src[len], record, sizeof(record));
+		len += sizeof(record);
+	}
+
+	size_t packed_len = round_trip(len);
+
+	printf("cbor-like: %zu -> %zu bytes\n", len, packed_len);
+
+	zassert_true(packed_len * 2 < len, "poor compression ratio");
+}
+
+ZTEST(subsus_ctr_cloud_4_compress, test_round_trip_incompressible)
+{
+	uint32_t x = 0x12345678;
+
+	for (size_t i = 0; i < sizeof(m_src); i++) {
+		x = x * 1103515245 + 12345;
+		m_src[i] = x >> 24;
+	}
+
+	size_t packed_len = round_trip(sizeof(m_src));
+
+	printf("random: %zu -> %zu bytes\n", sizeof(m_src), packed_len);
+}
+
+ZTEST(subsus_ctr_cloud_4_compress, test_round_trip_short)
+{
+	memcpy(m_src, "abcabcabcabcabcab", 17);
+
+	for (size_t len = 0; len <= 17; len++) {
+		round_trip(len);
+	}
+}
+
+ZTEST(subsus_ctr_cloud_4_compress, test_compress_no_space)
+{
+	size_t packed_len;
+
+	memset(m_src, 0x55, 64);
+
+	int ret = ctr_cloud_compress(m_src, 64, m_packed, 4, &packed_len);
+	zassert_equal(ret, -ENOSPC, "ctr_cloud_compress should fail");
+}
+
+ZTEST(subsus_ctr_cloud_4_compress, test_decompress_bad_distance)
+{
+	size_t unpacked_len;
+
+	/* Match referencing data before the start of the output */
+	uint8_t packed[] = {0x01, 0x10, 0x00};
+
+	int ret = ctr_cloud_decompress(packed, sizeof(packed), m_unpacked, sizeof(m_unpacked),
+				       &unpacked_len);
+	zassert_equal(ret, -EBADMSG, "ctr_cloud_decompress should fail");
+}
+
+ZTEST_SUITE(subsus_ctr_cloud_4_compress, NULL, NULL, NULL, NULL, NULL);
@@ -25,7 +25,7 @@ ZTEST(subsus_ctr_cloud_1_msg, test_pack_create_session)
 		"00bf0000101a80b00001016948415244574152494f0269434845535445522d4d036443474c53046452"
 		"332e32057818636f6d2e68617264776172696f2e6d6f636b75702d617070066a6d6f636b75702d6170"
 		"70076676302e302e3108663635343132330a1b0003824430f85009091b00007048860ddf7511743839"
-		"3838323339303030303236323832363535380b6676312e352e30ff";
+		"3838323339303030303236323832363535380b6676312e352e30120416f5ff";
 
 	// PRINT_CTR_BUF(buffer);
 
@@ -58,6 +58,8 @@ ZTEST(subsus_ctr_cloud_1_msg, test_unpack_set_session)
 	zassert_equal(session.config_hash, 0, "config_hash");
 	zassert_true(strcmp(session.device_id, "01890b66-c8f5-70ea-9f43-afe24edf9f55") == 0, "id");
 	zassert_true(strcmp(session.device_name, "karel-dev") == 0, "name");
+	zassert_equal(session.transfer_window, 0, "transfer_window");
+	zassert_equal(session.batch_size, 0, "batch_size");
 }
 
 ZTEST(subsus_ctr_cloud_1_msg, test_pack_get_timestamp)
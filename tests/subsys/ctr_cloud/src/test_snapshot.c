@@ -0,0 +1,268 @@
+/** @file
+ *  @brief cloud configuration snapshot test suite
+ *
+ */
+
+#include "helper.h"
+#include "mock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <chester/ctr_buf.h>
+#include <chester/ctr_config.h>
+#include <ctr_cloud_msg.h>
+#include <ctr_cloud_snapshot.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+#define SETTINGS_PFX "snap-test"
+
+struct snap_config {
+	int interval;
+	float threshold;
+	bool enabled;
+	int mode;
+	char name[16];
+	uint8_t key[4];
+	int band;
+};
+
+static const char *m_enum_mode[] = {"off", "slow", "fast"};
+static const char *m_enum_band[] = {"low", "", "high"};
+static const uint8_t m_default_key[] = {0xde, 0xad, 0xbe, 0xef};
+
+static struct snap_config m_config;
+
+static const struct ctr_config_item m_items[] = {
+	CTR_CONFIG_ITEM_INT("interval", m_config.interval, 1, 86400, "Interval", 60),
+	CTR_CONFIG_ITEM_FLOAT("threshold", m_config.threshold, -40, 125, "Threshold", 21.5f),
+	CTR_CONFIG_ITEM_BOOL("enabled", m_config.enabled, "Enabled", true),
+	CTR_CONFIG_ITEM_ENUM("mode", m_config.mode, m_enum_mode, "Mode", 1),
+	CTR_CONFIG_ITEM_STRING("name", m_config.name, "Name", "chester"),
+	CTR_CONFIG_ITEM_HEX("key", m_config.key, "Key", m_default_key),
+	CTR_CONFIG_ITEM_ENUM("band", m_config.band, m_enum_band, "Band", 0),
+};
+
+static struct ctr_cloud_snapshot m_snapshot;
+static struct ctr_cloud_snapshot m_base;
+
+static void *setup(void)
+{
+	mock_global_setup_suite();
+
+	ctr_config_append_items(m_items, ARRAY_SIZE(m_items));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	for (int i = 0; i < ARRAY_SIZE(m_items); i++) {
+		ctr_config_init_item(&m_items[i]);
+	}
+}
+
+static size_t encode(uint8_t *buf, size_t size, const struct ctr_cloud_snapshot *base)
+{
+	ZCBOR_STATE_E(zs, 2, buf, size, 1);
+
+	int ret = ctr_cloud_snapshot_encode(zs, &m_snapshot, base);
+	zassert_ok(ret, "ctr_cloud_snapshot_encode failed: %d", ret);
+
+	return zs->payload - buf;
+}
+
+static int decode(const uint8_t *buf, size_t len)
+{
+	ZCBOR_STATE_D(zs, 2, buf, len, 1, 0);
+
+	return ctr_cloud_snapshot_decode(zs);
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_round_trip)
+{
+	static uint8_t buf[256];
+
+	m_config.interval = 900;
+	m_config.threshold = -12.25f;
+	m_config.enabled = false;
+	m_config.mode = 2;
+	strcpy(m_config.name, "boiler room");
+	memcpy(m_config.key, (uint8_t[]){0x01, 0x02, 0x03, 0x04}, sizeof(m_config.key));
+
+	struct snap_config expected = m_config;
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+	zassert_equal(m_snapshot.count, ARRAY_SIZE(m_items), "count %u", m_snapshot.count);
+
+	size_t len = encode(buf, sizeof(buf), NULL);
+
+	/* Back to the defaults, every item differs from the encoded value */
+	before(NULL);
+
+	int ret = decode(buf, len);
+	zassert_ok(ret, "ctr_cloud_snapshot_decode failed: %d", ret);
+
+	zassert_equal(m_config.interval, expected.interval, "interval");
+	zassert_equal(m_config.threshold, expected.threshold, "threshold");
+	zassert_equal(m_config.enabled, expected.enabled, "enabled");
+	zassert_equal(m_config.mode, expected.mode, "mode");
+	zassert_true(strcmp(m_config.name, expected.name) == 0, "name");
+	zassert_mem_equal(m_config.key, expected.key, sizeof(m_config.key), "key");
+
+	uint64_t hash = m_snapshot.hash;
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+	zassert_equal(m_snapshot.hash, hash, "hash changed by round trip");
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_delta)
+{
+	static uint8_t buf[256];
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_base), "ctr_cloud_snapshot_take failed");
+
+	m_config.interval = 300;
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+	zassert_not_equal(m_snapshot.hash, m_base.hash, "hash not changed");
+	zassert_true(ctr_cloud_snapshot_is_delta_base(&m_snapshot, &m_base), "not a delta base");
+
+	size_t len = encode(buf, sizeof(buf), &m_base);
+
+	/* {"snap": {"interval": 300}} */
+	CTR_BUF_DEFINE(expect, 64);
+	char *expect_hex = "bf64736e6170bf68696e74657276616c19012cffff";
+	expect.len = hex2bin(expect_hex, strlen(expect_hex), expect.mem, expect.size);
+
+	zassert_equal(len, expect.len, "len %u", len);
+	zassert_mem_equal(buf, expect.mem, expect.len, "mem equal");
+
+	/* Unchanged configuration gives an empty delta */
+	zassert_ok(ctr_cloud_snapshot_take(&m_base), "ctr_cloud_snapshot_take failed");
+	len = encode(buf, sizeof(buf), &m_base);
+	zassert_equal(len, 2, "len %u", len);
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_pack)
+{
+	CTR_BUF_DEFINE(buffer, 256);
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_base), "ctr_cloud_snapshot_take failed");
+
+	strcpy(m_config.name, "cellar");
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+
+	int ret = ctr_cloud_msg_pack_config_snapshot(&buffer, &m_snapshot, &m_base);
+	zassert_ok(ret, "ctr_cloud_msg_pack_config_snapshot failed: %d", ret);
+
+	uint64_t hash;
+	zassert_ok(ctr_cloud_msg_get_hash(&buffer, &hash), "ctr_cloud_msg_get_hash failed");
+	zassert_equal(hash, m_snapshot.hash, "hash");
+
+	uint8_t *p = ctr_buf_get_mem(&buffer);
+
+	zassert_equal(p[0], 0x02, "type 0x%02x", p[0]);
+	zassert_equal(p[9], 0x60, "header 0x%02x", p[9]);
+	zassert_equal(sys_get_be64(&p[10]), m_base.hash, "base hash");
+
+	strcpy(m_config.name, "chester");
+
+	ret = decode(p + 18, ctr_buf_get_used(&buffer) - 18);
+	zassert_ok(ret, "ctr_cloud_snapshot_decode failed: %d", ret);
+	zassert_true(strcmp(m_config.name, "cellar") == 0, "name");
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_decode_invalid)
+{
+	CTR_BUF_DEFINE(buffer, 64);
+
+	/* {"snap": {"unknown": 1, "mode": "fast"}} */
+	char *hex = "bf64736e6170bf67756e6b6e6f776e01646d6f64656466617374ffff";
+	buffer.len = hex2bin(hex, strlen(hex), buffer.mem, buffer.size);
+
+	int ret = decode(buffer.mem, buffer.len);
+	zassert_ok(ret, "ctr_cloud_snapshot_decode failed: %d", ret);
+	zassert_equal(m_config.mode, 2, "mode %d", m_config.mode);
+
+	/* {"snap": {"interval": 100000}} */
+	hex = "bf64736e6170bf68696e74657276616c1a000186a0ffff";
+	buffer.len = hex2bin(hex, strlen(hex), buffer.mem, buffer.size);
+
+	ret = decode(buffer.mem, buffer.len);
+	zassert_equal(ret, -ERANGE, "unexpected result: %d", ret);
+	zassert_equal(m_config.interval, 60, "interval %d", m_config.interval);
+
+	/* {"snap": {"mode": "turbo"}} */
+	hex = "bf64736e6170bf646d6f646565747572626fffff";
+	buffer.len = hex2bin(hex, strlen(hex), buffer.mem, buffer.size);
+
+	ret = decode(buffer.mem, buffer.len);
+	zassert_equal(ret, -EINVAL, "unexpected result: %d", ret);
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_sparse_enum)
+{
+	CTR_BUF_DEFINE(buffer, 64);
+
+	/* {"snap": {"band": "high"}} */
+	char *hex = "bf64736e6170bf6462616e646468696768ffff";
+	buffer.len = hex2bin(hex, strlen(hex), buffer.mem, buffer.size);
+
+	int ret = decode(buffer.mem, buffer.len);
+	zassert_ok(ret, "ctr_cloud_snapshot_decode failed: %d", ret);
+	zassert_equal(m_config.band, 2, "band %d", m_config.band);
+
+	/* {"snap": {"band": ""}} - the gap is not a value */
+	hex = "bf64736e6170bf6462616e6460ffff";
+	buffer.len = hex2bin(hex, strlen(hex), buffer.mem, buffer.size);
+
+	ret = decode(buffer.mem, buffer.len);
+	zassert_equal(ret, -EINVAL, "unexpected result: %d", ret);
+	zassert_equal(m_config.band, 2, "band %d", m_config.band);
+
+	static uint8_t buf[256];
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_base), "ctr_cloud_snapshot_take failed");
+
+	m_config.band = 1;
+
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+
+	size_t len = encode(buf, sizeof(buf), &m_base);
+
+	/* {"snap": {"band": 1}} */
+	CTR_BUF_DEFINE(expect, 64);
+	char *expect_hex = "bf64736e6170bf6462616e6401ffff";
+	expect.len = hex2bin(expect_hex, strlen(expect_hex), expect.mem, expect.size);
+
+	zassert_equal(len, expect.len, "len %u", len);
+	zassert_mem_equal(buf, expect.mem, expect.len, "mem equal");
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_persistence)
+{
+	zassert_ok(ctr_cloud_snapshot_take(&m_snapshot), "ctr_cloud_snapshot_take failed");
+	zassert_ok(ctr_cloud_snapshot_save(&m_snapshot), "ctr_cloud_snapshot_save failed");
+
+	memset(&m_base, 0xff, sizeof(m_base));
+
+	zassert_ok(ctr_cloud_snapshot_load(&m_base), "ctr_cloud_snapshot_load failed");
+	zassert_equal(m_base.hash, m_snapshot.hash, "hash");
+	zassert_equal(m_base.layout, m_snapshot.layout, "layout");
+	zassert_equal(m_base.count, m_snapshot.count, "count");
+	zassert_mem_equal(m_base.digests, m_snapshot.digests,
+			  m_snapshot.count * sizeof(m_snapshot.digests[0]), "digests");
+}
+
+ZTEST(subsus_ctr_cloud_5_snapshot, test_items_complete)
+{
+	/* The mocked "app" module registers its show callback only */
+	zassert_false(ctr_config_is_items_complete(), "module without item table not detected");
+}
+
+ZTEST_SUITE(subsus_ctr_cloud_5_snapshot, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,168 @@
+/** @file
+ *  @brief cloud transfer test suite
+ *
+ */
+
+#include "mock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+#include <chester/ctr_buf.h>
+#include <ctr_cloud_packet.h>
+#include <ctr_cloud_transfer.h>
+
+#define SEND_DELAY_MS 100
+#define RTT_MS        2000
+
+static uint8_t m_claim_token[16] = {0x98, 0xa8, 0x85, 0x6b, 0xa6, 0x53, 0x4b, 0xd5,
+				    0x21, 0x21, 0x76, 0xb2, 0x2f, 0x3a, 0xcb, 0xb3};
+
+CTR_BUF_DEFINE_STATIC(m_payload, 4096);
+
+static int64_t upload(int window, bool binary, int drop_packet, int *packets)
+{
+	int ret;
+
+	ret = ctr_cloud_transfer_init(2159017985, m_claim_token, NULL);
+	zassert_ok(ret, "ctr_cloud_transfer_init failed");
+
+	ret = ctr_cloud_transfer_set_window(window);
+	zassert_ok(ret, "ctr_cloud_transfer_set_window failed");
+
+	ret = ctr_cloud_transfer_set_binary(binary);
+	zassert_ok(ret, "ctr_cloud_transfer_set_binary failed");
+
+	mock_ctr_lte_v2_set_server(m_claim_token, SEND_DELAY_MS, RTT_MS, drop_packet);
+
+	int64_t start = k_uptime_get();
+
+	ret = ctr_cloud_transfer_uplink(&m_payload, NULL, K_FOREVER);
+	zassert_ok(ret, "ctr_cloud_transfer_uplink failed");
+
+	int64_t elapsed = k_uptime_get() - start;
+
+	const uint8_t *data;
+	size_t len;
+	int responses;
+
+	mock_ctr_lte_v2_get_server_stats(&data, &len, packets, &responses);
+
+	printf("window: %d binary: %d drop: %d elapsed: %lld ms packets: %d responses: %d\n",
+	       window, binary, drop_packet, elapsed, *packets, responses);
+
+	zassert_equal(len, ctr_buf_get_used(&m_payload), "len not equal");
+	zassert_mem_equal(data, ctr_buf_get_mem(&m_payload), len, "data not equal");
+
+	mock_ctr_lte_v2_set_server(NULL, 0, 0, -1);
+
+	return elapsed;
+}
+
+/* Checks that the frame carries the given fragment under the given sequence */
+static void assert_frame(int index, int part, uint16_t sequence)
+{
+	uint16_t frame_sequence;
+	uint8_t flags;
+	size_t len;
+	uint32_t crc;
+	uint16_t first_sequence;
+	uint8_t first_flags;
+	size_t fragment_size;
+	uint32_t first_crc;
+
+	zassert_ok(mock_ctr_lte_v2_get_server_frame(0, &first_sequence, &first_flags,
+						    &fragment_size, &first_crc));
+	zassert_ok(mock_ctr_lte_v2_get_server_frame(index, &frame_sequence, &flags, &len, &crc));
+
+	size_t offset = part * fragment_size;
+	size_t expected_len = MIN(ctr_buf_get_used(&m_payload) - offset, fragment_size);
+
+	zassert_equal(frame_sequence, sequence, "frame %d sequence", index);
+	zassert_equal(len, expected_len, "frame %d length", index);
+	zassert_equal(crc, crc32_ieee(ctr_buf_get_mem(&m_payload) + offset, len),
+		      "frame %d payload", index);
+	zassert_equal(!!(flags & CTR_CLOUD_PACKET_FLAG_FIRST), part == 0, "frame %d flags", index);
+}
+
+static int fragment_count(void)
+{
+	uint16_t sequence;
+	uint8_t flags;
+	size_t fragment_size;
+	uint32_t crc;
+
+	zassert_ok(mock_ctr_lte_v2_get_server_frame(0, &sequence, &flags, &fragment_size, &crc));
+
+	return DIV_ROUND_UP(ctr_buf_get_used(&m_payload), fragment_size);
+}
+
+static void *setup(void)
+{
+	ctr_buf_reset(&m_payload);
+
+	for (size_t i = 0; i < ctr_buf_get_free(&m_payload); i++) {
+		m_payload.mem[i] = i * 7;
+	}
+
+	ctr_buf_seek(&m_payload, ctr_buf_get_free(&m_payload));
+
+	return NULL;
+}
+
+ZTEST(subsus_ctr_cloud_3_transfer, test_uplink_window_faster)
+{
+	int packets;
+
+	int64_t stop_and_wait = upload(1, false, -1, &packets);
+	int64_t windowed = upload(CONFIG_CTR_CLOUD_TRANSFER_WINDOW, false, -1, &packets);
+
+	zassert_true(windowed * 2 < stop_and_wait, "windowed uplink not faster");
+}
+
+ZTEST(subsus_ctr_cloud_3_transfer, test_uplink_window_gap)
+{
+	int packets;
+
+	/* Lose the second fragment of the first window */
+	upload(CONFIG_CTR_CLOUD_TRANSFER_WINDOW, false, 1, &packets);
+
+	/* The server points at the gap and the window restarts from the lost fragment */
+	assert_frame(1, 1, 1);
+	assert_frame(CONFIG_CTR_CLOUD_TRANSFER_WINDOW, 1, 1);
+	assert_frame(CONFIG_CTR_CLOUD_TRANSFER_WINDOW + 1, 2, 2);
+
+	/* Only the fragments after the gap in the first window are sent twice */
+	zassert_equal(packets, fragment_count() + CONFIG_CTR_CLOUD_TRANSFER_WINDOW - 1,
+		      "frames sent");
+}
+
+ZTEST(subsus_ctr_cloud_3_transfer, test_uplink_window_first_lost)
+{
+	int packets;
+
+	upload(CONFIG_CTR_CLOUD_TRANSFER_WINDOW, false, 0, &packets);
+
+	/* Without the first fragment the server resets the sequence, the whole window is resent */
+	assert_frame(0, 0, 0);
+	assert_frame(CONFIG_CTR_CLOUD_TRANSFER_WINDOW, 0, 0);
+	assert_frame(CONFIG_CTR_CLOUD_TRANSFER_WINDOW + 1, 1, 1);
+
+	zassert_equal(packets, fragment_count() + CONFIG_CTR_CLOUD_TRANSFER_WINDOW, "frames sent");
+}
+
+ZTEST(subsus_ctr_cloud_3_transfer, test_uplink_binary)
+{
+	int base64_packets;
+	int binary_packets;
+
+	upload(1, false, -1, &base64_packets);
+	upload(1, true, -1, &binary_packets);
+
+	zassert_true(binary_packets < base64_packets, "binary uplink not smaller");
+	zassert_equal(binary_packets, DIV_ROUND_UP(4096, CTR_CLOUD_DATA_MAX_SIZE),
+		      "binary packets");
+}
+
+ZTEST_SUITE(subsus_ctr_cloud_3_transfer, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,5 @@
+#include <ctr_cloud_config.h>
+
+struct ctr_cloud_config g_ctr_cloud_config = {
+	.spool_size = 1000,
+};
@@ -0,0 +1,10 @@
+#include <chester/ctr_rtc.h>
+
+/* Every call returns a later time - the LittleFS backend derives file names from it */
+static int64_t m_ts_ms = 1767225600000;
+
+int ctr_rtc_get_ts_ms(int64_t *ts_ms)
+{
+	*ts_ms = m_ts_ms++;
+	return 0;
+}
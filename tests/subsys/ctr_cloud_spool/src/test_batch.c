@@ -0,0 +1,222 @@
+/** @file
+ *  @brief cloud spool batch drain test suite
+ *
+ */
+
+#include <ctr_cloud_batch.h>
+#include <ctr_cloud_config.h>
+#include <ctr_cloud_msg.h>
+#include <ctr_cloud_spool.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <chester/ctr_buf.h>
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MESSAGE_SIZE 120
+#define RECORD_SIZE  (UL_UPLOAD_BATCH_RECORD_HEADER_SIZE + MESSAGE_SIZE)
+#define BUDGET       4096
+
+CTR_BUF_DEFINE_STATIC(m_buf, 8192);
+
+static ctr_cloud_spool_id m_ids[CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT + 2];
+static int m_fail_load = -1;
+static int m_send_ret;
+static int m_sends;
+static int m_sent_count;
+
+static void fill(uint8_t *msg, int index)
+{
+	for (int i = 0; i < MESSAGE_SIZE; i++) {
+		msg[i] = index * 31 + i;
+	}
+}
+
+static void save_messages(int count)
+{
+	int ret;
+	uint8_t msg[MESSAGE_SIZE];
+
+	zassert_true(count <= ARRAY_SIZE(m_ids));
+
+	for (int i = 0; i < count; i++) {
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), &m_ids[i]);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+	}
+}
+
+static int load(ctr_cloud_spool_id id, struct ctr_buf *buf, void *user_data)
+{
+	if (m_fail_load >= 0 && id == m_ids[m_fail_load]) {
+		return -EIO;
+	}
+
+	return ctr_cloud_spool_load(id, buf);
+}
+
+static int send(struct ctr_buf *buf, int count, void *user_data)
+{
+	m_sends++;
+	m_sent_count = count;
+
+	return m_send_ret;
+}
+
+/* Checks that the batch frame holds the messages first..first+count-1 */
+static void assert_batch(int first, int count)
+{
+	uint8_t msg[MESSAGE_SIZE];
+	const uint8_t *p = ctr_buf_get_mem(&m_buf);
+
+	zassert_equal(m_sent_count, count, "batch count not equal");
+	zassert_equal(ctr_buf_get_used(&m_buf), 1 + count * RECORD_SIZE, "batch size not equal");
+	zassert_equal(p[0], UL_UPLOAD_BATCH, "batch type not equal");
+
+	p++;
+
+	for (int i = 0; i < count; i++) {
+		fill(msg, first + i);
+
+		zassert_equal(sys_get_be16(p), MESSAGE_SIZE, "record length not equal");
+		zassert_mem_equal(p + UL_UPLOAD_BATCH_RECORD_HEADER_SIZE, msg, MESSAGE_SIZE,
+				  "record data not equal");
+
+		p += RECORD_SIZE;
+	}
+}
+
+static int get_count(void)
+{
+	int count;
+
+	zassert_ok(ctr_cloud_spool_count(&count), "ctr_cloud_spool_count failed");
+
+	return count;
+}
+
+ZTEST(subsus_ctr_cloud_spool_batch, test_partial)
+{
+	int ret;
+
+	save_messages(3);
+
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], BUDGET, load, send, NULL);
+	zassert_equal(ret, 3, "messages sent not equal");
+	zassert_equal(m_sends, 1, "sends not equal");
+
+	assert_batch(0, 3);
+	zassert_equal(get_count(), 0, "spool not empty");
+}
+
+ZTEST(subsus_ctr_cloud_spool_batch, test_full)
+{
+	int ret;
+
+	save_messages(CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT + 2);
+
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], BUDGET, load, send, NULL);
+	zassert_equal(ret, CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT, "messages sent not equal");
+
+	assert_batch(0, CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT);
+	zassert_equal(get_count(), 2, "messages left not equal");
+
+	ctr_cloud_spool_id id;
+	zassert_ok(ctr_cloud_spool_peek(&id), "ctr_cloud_spool_peek failed");
+
+	ret = ctr_cloud_batch_drain(&m_buf, id, BUDGET, load, send, NULL);
+	zassert_equal(ret, 2, "messages sent not equal");
+
+	assert_batch(CONFIG_CTR_CLOUD_SPOOL_BATCH_COUNT, 2);
+	zassert_equal(get_count(), 0, "spool not empty");
+}
+
+ZTEST(subsus_ctr_cloud_spool_batch, test_budget)
+{
+	int ret;
+
+	save_messages(3);
+
+	/* Room for two records only */
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], 1 + 2 * RECORD_SIZE + RECORD_SIZE / 2, load,
+				    send, NULL);
+	zassert_equal(ret, 2, "messages sent not equal");
+
+	assert_batch(0, 2);
+	zassert_equal(get_count(), 1, "messages left not equal");
+
+	/* Not even one record fits - nothing is sent */
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[2], RECORD_SIZE, load, send, NULL);
+	zassert_equal(ret, 0, "messages sent not equal");
+	zassert_equal(m_sends, 1, "sends not equal");
+	zassert_equal(get_count(), 1, "messages left not equal");
+}
+
+ZTEST(subsus_ctr_cloud_spool_batch, test_send_error)
+{
+	int ret;
+
+	save_messages(3);
+
+	m_send_ret = -ETIMEDOUT;
+
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], BUDGET, load, send, NULL);
+	zassert_equal(ret, -ETIMEDOUT, "send error not returned");
+
+	/* Nothing is deleted before the batch is acknowledged */
+	zassert_equal(get_count(), 3, "messages left not equal");
+
+	m_send_ret = 0;
+
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], BUDGET, load, send, NULL);
+	zassert_equal(ret, 3, "messages sent not equal");
+
+	assert_batch(0, 3);
+	zassert_equal(get_count(), 0, "spool not empty");
+}
+
+ZTEST(subsus_ctr_cloud_spool_batch, test_load_error)
+{
+	int ret;
+
+	save_messages(3);
+
+	/* The batch ends before the unreadable message, it is left for a single uplink */
+	m_fail_load = 1;
+
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[0], BUDGET, load, send, NULL);
+	zassert_equal(ret, 1, "messages sent not equal");
+
+	assert_batch(0, 1);
+	zassert_equal(get_count(), 2, "messages left not equal");
+
+	ctr_cloud_spool_id id;
+	zassert_ok(ctr_cloud_spool_peek(&id), "ctr_cloud_spool_peek failed");
+	zassert_equal(id, m_ids[1], "unreadable message not kept");
+
+	/* An unreadable first message gives an empty batch */
+	ret = ctr_cloud_batch_drain(&m_buf, m_ids[1], BUDGET, load, send, NULL);
+	zassert_equal(ret, 0, "messages sent not equal");
+	zassert_equal(m_sends, 1, "sends not equal");
+}
+
+static void before(void *fixture)
+{
+	g_ctr_cloud_config.spool_size = 1000;
+
+	int ret = ctr_cloud_spool_clear();
+	zassert_ok(ret, "ctr_cloud_spool_clear failed");
+
+	m_fail_load = -1;
+	m_send_ret = 0;
+	m_sends = 0;
+	m_sent_count = 0;
+}
+
+ZTEST_SUITE(subsus_ctr_cloud_spool_batch, NULL, NULL, before, NULL, NULL);
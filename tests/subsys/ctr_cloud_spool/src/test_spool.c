@@ -0,0 +1,328 @@
+/** @file
+ *  @brief cloud spool benchmark test suite
+ *
+ */
+
+/* west build -b native_sim -- -DCONFIG_TEST_FEATURE_SPOOL_LOG=y && ./build/zephyr/zephyr.elf */
+
+#include <ctr_cloud_config.h>
+#include <ctr_cloud_spool.h>
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <chester/ctr_buf.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define MESSAGES     1000
+#define MESSAGE_SIZE 120
+
+#if defined(CONFIG_TEST_FEATURE_SPOOL_LOG)
+#define BACKEND "log"
+#else
+#define BACKEND "littlefs"
+#endif
+
+CTR_BUF_DEFINE_STATIC(m_buf, 512);
+
+static void fill(uint8_t *msg, int index)
+{
+	for (int i = 0; i < MESSAGE_SIZE; i++) {
+		msg[i] = index * 31 + i;
+	}
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_save_drain)
+{
+	int ret;
+	int count;
+	uint8_t msg[MESSAGE_SIZE];
+
+	int64_t start = k_uptime_get();
+
+	for (int i = 0; i < MESSAGES; i++) {
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), NULL);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+	}
+
+	int64_t save_ms = k_uptime_get() - start;
+
+	ret = ctr_cloud_spool_count(&count);
+	zassert_ok(ret, "ctr_cloud_spool_count failed");
+	zassert_equal(count, MESSAGES, "count not equal");
+
+	start = k_uptime_get();
+
+	ctr_cloud_spool_id id;
+	int drained = 0;
+
+	/* Same access pattern as drain_spool in ctr_cloud.c */
+	while (!ctr_cloud_spool_peek(&id)) {
+		ctr_buf_reset(&m_buf);
+
+		ret = ctr_cloud_spool_load(id, &m_buf);
+		zassert_ok(ret, "ctr_cloud_spool_load failed");
+
+		fill(msg, drained);
+		zassert_equal(ctr_buf_get_used(&m_buf), sizeof(msg), "len not equal");
+		zassert_mem_equal(ctr_buf_get_mem(&m_buf), msg, sizeof(msg), "data not equal");
+
+		ret = ctr_cloud_spool_delete(id);
+		zassert_ok(ret, "ctr_cloud_spool_delete failed");
+
+		drained++;
+	}
+
+	int64_t drain_ms = k_uptime_get() - start;
+
+	printf("backend: %s save: %lld ms drain: %lld ms (%d messages)\n", BACKEND, save_ms,
+	       drain_ms, MESSAGES);
+
+	zassert_equal(drained, MESSAGES, "drained not equal");
+
+	ret = ctr_cloud_spool_count(&count);
+	zassert_ok(ret, "ctr_cloud_spool_count failed");
+	zassert_equal(count, 0, "spool not empty");
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_save_delete)
+{
+	int ret;
+	int count;
+	uint8_t msg[MESSAGE_SIZE];
+
+	int64_t start = k_uptime_get();
+
+	/* Uplink path of ctr_cloud_send_data - store first, delete once sent */
+	for (int i = 0; i < MESSAGES; i++) {
+		ctr_cloud_spool_id id;
+
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), &id);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+
+		ret = ctr_cloud_spool_delete(id);
+		zassert_ok(ret, "ctr_cloud_spool_delete failed");
+	}
+
+	int64_t elapsed_ms = k_uptime_get() - start;
+
+	printf("backend: %s save+delete: %lld ms (%d messages)\n", BACKEND, elapsed_ms,
+	       MESSAGES);
+
+	ret = ctr_cloud_spool_count(&count);
+	zassert_ok(ret, "ctr_cloud_spool_count failed");
+	zassert_equal(count, 0, "spool not empty");
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_drop_oldest)
+{
+	int ret;
+	int count;
+	uint8_t msg[MESSAGE_SIZE];
+
+	g_ctr_cloud_config.spool_size = 10;
+
+	for (int i = 0; i < 25; i++) {
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), NULL);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+	}
+
+	ret = ctr_cloud_spool_count(&count);
+	zassert_ok(ret, "ctr_cloud_spool_count failed");
+	zassert_equal(count, 10, "count not equal");
+
+	ctr_cloud_spool_id id;
+
+	ret = ctr_cloud_spool_peek(&id);
+	zassert_ok(ret, "ctr_cloud_spool_peek failed");
+
+	ctr_buf_reset(&m_buf);
+
+	ret = ctr_cloud_spool_load(id, &m_buf);
+	zassert_ok(ret, "ctr_cloud_spool_load failed");
+
+	fill(msg, 15);
+	zassert_mem_equal(ctr_buf_get_mem(&m_buf), msg, sizeof(msg), "oldest not kept");
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_next)
+{
+	int ret;
+	uint8_t msg[MESSAGE_SIZE];
+	ctr_cloud_spool_id ids[5];
+
+	for (int i = 0; i < ARRAY_SIZE(ids); i++) {
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), &ids[i]);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+	}
+
+	ctr_cloud_spool_id id;
+
+	ret = ctr_cloud_spool_peek(&id);
+	zassert_ok(ret, "ctr_cloud_spool_peek failed");
+	zassert_equal(id, ids[0], "oldest not equal");
+
+	/* Batched drain walks the spool without deleting */
+	for (int i = 1; i < ARRAY_SIZE(ids); i++) {
+		ret = ctr_cloud_spool_next(id, &id);
+		zassert_ok(ret, "ctr_cloud_spool_next failed");
+		zassert_equal(id, ids[i], "next not equal");
+	}
+
+	ret = ctr_cloud_spool_next(id, &id);
+	zassert_equal(ret, 1, "ctr_cloud_spool_next should find nothing");
+
+	ret = ctr_cloud_spool_delete(ids[2]);
+	zassert_ok(ret, "ctr_cloud_spool_delete failed");
+
+	ret = ctr_cloud_spool_next(ids[1], &id);
+	zassert_ok(ret, "ctr_cloud_spool_next failed");
+	zassert_equal(id, ids[3], "deleted message not skipped");
+}
+
+#if defined(CONFIG_TEST_FEATURE_SPOOL_LOG)
+
+/* First segment written after the spool is cleared */
+#define SEGMENT_PATH "/lfs1/spool-log/00000000"
+
+static void save_messages(int count)
+{
+	int ret;
+	uint8_t msg[MESSAGE_SIZE];
+
+	for (int i = 0; i < count; i++) {
+		fill(msg, i);
+
+		ret = ctr_cloud_spool_save(msg, sizeof(msg), NULL);
+		zassert_ok(ret, "ctr_cloud_spool_save failed");
+	}
+}
+
+static size_t get_segment_size(void)
+{
+	struct fs_dirent entry;
+
+	zassert_ok(fs_stat(SEGMENT_PATH, &entry), "fs_stat failed");
+
+	return entry.size;
+}
+
+/* Checks the messages kept after the replay, oldest first */
+static void assert_messages(int count)
+{
+	int ret;
+	int stored;
+	uint8_t msg[MESSAGE_SIZE];
+	ctr_cloud_spool_id id;
+
+	ret = ctr_cloud_spool_count(&stored);
+	zassert_ok(ret, "ctr_cloud_spool_count failed");
+	zassert_equal(stored, count, "count not equal");
+
+	ret = ctr_cloud_spool_peek(&id);
+	zassert_ok(ret, "ctr_cloud_spool_peek failed");
+
+	for (int i = 0; i < count; i++) {
+		if (i) {
+			ret = ctr_cloud_spool_next(id, &id);
+			zassert_ok(ret, "ctr_cloud_spool_next failed");
+		}
+
+		ctr_buf_reset(&m_buf);
+
+		ret = ctr_cloud_spool_load(id, &m_buf);
+		zassert_ok(ret, "ctr_cloud_spool_load failed");
+
+		fill(msg, i);
+		zassert_equal(ctr_buf_get_used(&m_buf), sizeof(msg), "len not equal");
+		zassert_mem_equal(ctr_buf_get_mem(&m_buf), msg, sizeof(msg), "data not equal");
+	}
+
+	ret = ctr_cloud_spool_next(id, &id);
+	zassert_equal(ret, 1, "ctr_cloud_spool_next should find nothing");
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_replay_truncated_tail)
+{
+	int ret;
+	struct fs_file_t file;
+
+	save_messages(3);
+
+	size_t size = get_segment_size();
+	size_t record_size = size / 3;
+
+	ctr_cloud_spool_reload();
+
+	/* Power loss in the middle of the last payload */
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, SEGMENT_PATH, FS_O_WRITE), "fs_open failed");
+	zassert_ok(fs_truncate(&file, size - MESSAGE_SIZE / 2), "fs_truncate failed");
+	fs_close(&file);
+
+	assert_messages(2);
+	zassert_equal(get_segment_size(), 2 * record_size, "torn record not truncated");
+
+	/* The spool keeps working and the torn record does not come back */
+	uint8_t msg[MESSAGE_SIZE];
+	fill(msg, 2);
+
+	ret = ctr_cloud_spool_save(msg, sizeof(msg), NULL);
+	zassert_ok(ret, "ctr_cloud_spool_save failed");
+
+	ctr_cloud_spool_reload();
+
+	assert_messages(3);
+}
+
+ZTEST(subsus_ctr_cloud_spool, test_replay_corrupted_record)
+{
+	struct fs_file_t file;
+
+	save_messages(3);
+
+	size_t size = get_segment_size();
+	size_t record_size = size / 3;
+
+	ctr_cloud_spool_reload();
+
+	/* Flip a payload byte of the second record */
+	uint8_t c;
+	off_t offset = record_size + record_size / 2;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, SEGMENT_PATH, FS_O_READ | FS_O_WRITE), "fs_open failed");
+	zassert_ok(fs_seek(&file, offset, FS_SEEK_SET), "fs_seek failed");
+	zassert_equal(fs_read(&file, &c, 1), 1, "fs_read failed");
+	c ^= 0xff;
+	zassert_ok(fs_seek(&file, offset, FS_SEEK_SET), "fs_seek failed");
+	zassert_equal(fs_write(&file, &c, 1), 1, "fs_write failed");
+	fs_close(&file);
+
+	/* Everything from the first bad record on is dropped */
+	assert_messages(1);
+	zassert_equal(get_segment_size(), record_size, "corrupted record not truncated");
+}
+
+#endif /* defined(CONFIG_TEST_FEATURE_SPOOL_LOG) */
+
+static void before(void *fixture)
+{
+	g_ctr_cloud_config.spool_size = MESSAGES;
+
+	int ret = ctr_cloud_spool_clear();
+	zassert_ok(ret, "ctr_cloud_spool_clear failed");
+}
+
+ZTEST_SUITE(subsus_ctr_cloud_spool, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,259 @@
+/** @file
+ *  @brief configuration apply test suite
+ *
+ */
+
+/* west build -b native_sim && ./build/zephyr/zephyr.elf */
+
+/*
+ * Test cases (run sequentially, depend on each other):
+ *
+ * - test_unchanged: Module with show callback and item table counts as complete, nothing written
+ * - test_hot:       Changed hot item written alone and committed without reboot
+ * - test_cold:      Changed cold item written, reboot reported instead of commit
+ * - test_pending:   Hot change after a cold one waits for the reboot as well
+ * - test_untracked: Show-only module next to the table one makes all settings saved with reboot
+ */
+
+#include <chester/ctr_config.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define SETTINGS_PFX       "apply-test"
+#define SETTINGS_PFX_EXTRA "apply-extra"
+
+struct apply_config {
+	int interval;
+	int limit;
+	int mode;
+};
+
+static const char *m_enum_mode[] = {"off", "slow", "fast"};
+
+static struct apply_config m_config;
+static struct apply_config m_config_interim;
+
+static const struct ctr_config_item m_items[] = {
+	CTR_CONFIG_ITEM_INT("interval", m_config_interim.interval, 1, 86400, "Interval", 60),
+	CTR_CONFIG_ITEM_INT("limit", m_config_interim.limit, 0, 100, "Limit", 10),
+	CTR_CONFIG_ITEM_ENUM("mode", m_config_interim.mode, m_enum_mode, "Mode", 1),
+};
+
+static const char *const m_hot_items[] = {
+	"interval",
+	"limit",
+	NULL,
+};
+
+static int m_commit_count;
+
+/* Names of the keys found in the storage */
+static char m_keys[8][16];
+static int m_keys_count;
+
+static int commit(void)
+{
+	m_commit_count++;
+
+	memcpy(&m_config, &m_config_interim, sizeof(m_config));
+
+	return 0;
+}
+
+static int load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		   void *param)
+{
+	if (m_keys_count >= ARRAY_SIZE(m_keys)) {
+		return -ENOSPC;
+	}
+
+	strncpy(m_keys[m_keys_count], key, sizeof(m_keys[0]) - 1);
+
+	for (int i = 0; i < ARRAY_SIZE(m_items); i++) {
+		if (strcmp(key, m_items[i].name) == 0) {
+			int value;
+			ssize_t n = read_cb(cb_arg, &value, sizeof(value));
+			zassert_equal(n, sizeof(value), "read %d", (int)n);
+			zassert_equal(value, *(int *)m_items[i].variable, "value of %s", key);
+		}
+	}
+
+	m_keys_count++;
+
+	return 0;
+}
+
+static void assert_stored(const char *const *expected, int count)
+{
+	memset(m_keys, 0, sizeof(m_keys));
+	m_keys_count = 0;
+
+	int ret = settings_load_subtree_direct(SETTINGS_PFX, load_cb, NULL);
+	zassert_ok(ret, "settings_load_subtree_direct failed: %d", ret);
+	zassert_equal(m_keys_count, count, "stored keys %d", m_keys_count);
+
+	for (int i = 0; i < count; i++) {
+		bool found = false;
+
+		for (int j = 0; j < m_keys_count; j++) {
+			if (strcmp(m_keys[j], expected[i]) == 0) {
+				found = true;
+			}
+		}
+
+		zassert_true(found, "key %s not stored", expected[i]);
+	}
+}
+
+static void apply(bool expected_reboot)
+{
+	bool is_reboot_needed;
+	int ret = ctr_config_apply(false, &is_reboot_needed);
+	zassert_ok(ret, "ctr_config_apply failed: %d", ret);
+	zassert_equal(is_reboot_needed, expected_reboot, "unexpected reboot: %d",
+		      is_reboot_needed);
+}
+
+static int show(const struct shell *shell, size_t argc, char **argv)
+{
+	return 0;
+}
+
+static void test_unchanged(void)
+{
+	zassert_true(ctr_config_is_items_complete(), "table module not complete");
+
+	apply(false);
+
+	zassert_equal(m_commit_count, 0, "commit count %d", m_commit_count);
+	assert_stored(NULL, 0);
+}
+
+static void test_hot(void)
+{
+	m_config_interim.interval = 300;
+
+	apply(false);
+
+	zassert_equal(m_commit_count, 1, "commit count %d", m_commit_count);
+	zassert_equal(m_config.interval, 300, "interval not committed");
+
+	static const char *const keys[] = {"interval"};
+	assert_stored(keys, ARRAY_SIZE(keys));
+
+	/* Already written, the second apply has nothing to do */
+	apply(false);
+	zassert_equal(m_commit_count, 1, "commit count %d", m_commit_count);
+}
+
+static void test_cold(void)
+{
+	m_config_interim.mode = 2;
+
+	apply(true);
+
+	zassert_equal(m_commit_count, 1, "commit count %d", m_commit_count);
+	zassert_equal(m_config.mode, 1, "cold item committed");
+
+	static const char *const keys[] = {"interval", "mode"};
+	assert_stored(keys, ARRAY_SIZE(keys));
+}
+
+static void test_pending(void)
+{
+	m_config_interim.limit = 20;
+
+	apply(true);
+
+	zassert_equal(m_commit_count, 1, "commit count %d", m_commit_count);
+	zassert_equal(m_config.limit, 10, "hot item committed before reboot");
+
+	static const char *const keys[] = {"interval", "limit", "mode"};
+	assert_stored(keys, ARRAY_SIZE(keys));
+}
+
+static int m_extra_value = 42;
+static int m_extra_count;
+
+static int extra_h_export(int (*export_func)(const char *name, const void *val, size_t val_len))
+{
+	return export_func(SETTINGS_PFX_EXTRA "/value", &m_extra_value, sizeof(m_extra_value));
+}
+
+static int extra_show(const struct shell *shell, size_t argc, char **argv)
+{
+	return 0;
+}
+
+static int extra_load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			 void *param)
+{
+	m_extra_count++;
+
+	return 0;
+}
+
+static void test_untracked(void)
+{
+	static struct settings_handler sh = {
+		.name = SETTINGS_PFX_EXTRA,
+		.h_export = extra_h_export,
+	};
+
+	int ret = settings_register(&sh);
+	zassert_ok(ret, "settings_register failed: %d", ret);
+
+	/* Registered with a show callback only, so its changes are invisible to the diff */
+	ctr_config_append_show(SETTINGS_PFX_EXTRA, extra_show);
+
+	zassert_false(ctr_config_is_items_complete(), "untracked module not detected");
+
+	apply(true);
+
+	zassert_equal(m_commit_count, 1, "commit count %d", m_commit_count);
+
+	ret = settings_load_subtree_direct(SETTINGS_PFX_EXTRA, extra_load_cb, NULL);
+	zassert_ok(ret, "settings_load_subtree_direct failed: %d", ret);
+	zassert_equal(m_extra_count, 1, "untracked setting not saved");
+}
+
+static void *setup(void)
+{
+	/* A previous run may have left the keys in the simulated flash */
+	settings_delete(SETTINGS_PFX "/interval");
+	settings_delete(SETTINGS_PFX "/limit");
+	settings_delete(SETTINGS_PFX "/mode");
+	settings_delete(SETTINGS_PFX_EXTRA "/value");
+
+	for (int i = 0; i < ARRAY_SIZE(m_items); i++) {
+		ctr_config_init_item(&m_items[i]);
+	}
+
+	memcpy(&m_config, &m_config_interim, sizeof(m_config));
+
+	/* Registered like the product modules - show callback and item table */
+	ctr_config_append_show(SETTINGS_PFX, show);
+	ctr_config_append_items(m_items, ARRAY_SIZE(m_items));
+
+	int ret = ctr_config_set_hot_items(m_items, m_hot_items, commit);
+	zassert_ok(ret, "ctr_config_set_hot_items failed: %d", ret);
+
+	return NULL;
+}
+
+ZTEST(subsys_ctr_config_apply, test_apply_sequence)
+{
+	test_unchanged();
+	test_hot();
+	test_cold();
+	test_pending();
+	test_untracked();
+}
+
+ZTEST_SUITE(subsys_ctr_config_apply, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,170 @@
+/** @file
+ *  @brief GNSS session termination test suite
+ *
+ */
+
+#include "ctr_gnss_session.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+static struct ctr_gnss_session m_session;
+
+static const struct ctr_gnss_session_config m_config = {
+	.accuracy = 5.f,
+	.min_satellites = 6,
+	.max_duration = 120,
+};
+
+static struct ctr_gnss_data_update fix(int satellites, float h_acc)
+{
+	return (struct ctr_gnss_data_update){
+		.fix_quality = 1,
+		.satellites_tracked = satellites,
+		.latitude = 50.0755381f,
+		.longitude = 14.4378005f,
+		.altitude = 235.4f,
+		.h_acc = h_acc,
+		.v_acc = h_acc * 1.5f,
+	};
+}
+
+static const struct ctr_gnss_data_update m_no_fix = {
+	.fix_quality = 0,
+	.satellites_tracked = 2,
+	.latitude = NAN,
+	.longitude = NAN,
+	.altitude = NAN,
+	.h_acc = NAN,
+	.v_acc = NAN,
+};
+
+static void before(void *fixture)
+{
+	ctr_gnss_session_init(&m_session);
+}
+
+ZTEST(subsys_ctr_gnss_session, test_target)
+{
+	struct ctr_gnss_data_update update;
+	struct ctr_gnss_data_session_end end;
+
+	ctr_gnss_session_begin(&m_session, &m_config, 7, 1000);
+
+	zassert_false(ctr_gnss_session_feed(&m_session, &m_no_fix, 2000), "no fix accepted");
+
+	/* First fix, not accurate enough */
+	update = fix(7, 25.f);
+	zassert_false(ctr_gnss_session_feed(&m_session, &update, 31000), "inaccurate accepted");
+
+	/* Accurate, too few satellites */
+	update = fix(5, 3.f);
+	zassert_false(ctr_gnss_session_feed(&m_session, &update, 32000), "satellites accepted");
+
+	update = fix(8, 4.5f);
+	zassert_true(ctr_gnss_session_feed(&m_session, &update, 40000), "target not met");
+
+	ctr_gnss_session_end(&m_session, true, 40100, &end);
+
+	zassert_false(m_session.active, "session active");
+	zassert_equal(end.corr_id, 7, "corr_id %d", end.corr_id);
+	zassert_true(end.fix, "fix");
+	zassert_equal(end.ttff, 30000, "ttff %d", end.ttff);
+	zassert_equal(end.duration, 39100, "duration %d", end.duration);
+	zassert_equal(end.update.satellites_tracked, 8, "satellites %d",
+		      end.update.satellites_tracked);
+
+	/* Updates after the end are ignored */
+	zassert_false(ctr_gnss_session_feed(&m_session, &update, 41000), "inactive accepted");
+}
+
+ZTEST(subsys_ctr_gnss_session, test_timeout)
+{
+	struct ctr_gnss_data_update update;
+	struct ctr_gnss_data_session_end end;
+
+	ctr_gnss_session_begin(&m_session, &m_config, 1, 0);
+
+	update = fix(9, 12.f);
+	zassert_false(ctr_gnss_session_feed(&m_session, &update, 45000), "inaccurate accepted");
+
+	update = fix(9, 30.f);
+	zassert_false(ctr_gnss_session_feed(&m_session, &update, 50000), "inaccurate accepted");
+
+	zassert_false(ctr_gnss_session_is_expired(&m_session, 119999), "expired early");
+	zassert_true(ctr_gnss_session_is_expired(&m_session, 120000), "not expired");
+
+	ctr_gnss_session_end(&m_session, false, 120000, &end);
+
+	/* The most accurate fix is reported */
+	zassert_false(end.fix, "fix");
+	zassert_equal(end.ttff, 45000, "ttff %d", end.ttff);
+	zassert_within(end.update.h_acc, 12.f, 1e-3f, "h_acc %f", (double)end.update.h_acc);
+
+	/* No fix at all */
+	ctr_gnss_session_begin(&m_session, &m_config, 2, 200000);
+	zassert_false(ctr_gnss_session_feed(&m_session, &m_no_fix, 210000), "no fix accepted");
+	ctr_gnss_session_end(&m_session, false, 320000, &end);
+
+	zassert_equal(end.ttff, -1, "ttff %d", end.ttff);
+	zassert_true(isnan(end.update.latitude), "latitude");
+}
+
+ZTEST(subsys_ctr_gnss_session, test_unreported)
+{
+	/* The nRF9160 backend reports neither fix quality nor satellites */
+	struct ctr_gnss_data_update update = fix(-1, 4.f);
+	update.fix_quality = -1;
+
+	ctr_gnss_session_begin(&m_session, &m_config, 1, 0);
+	zassert_true(ctr_gnss_session_feed(&m_session, &update, 20000), "target not met");
+
+	/* NMEA reports no accuracy */
+	update = fix(7, NAN);
+
+	ctr_gnss_session_begin(&m_session, &m_config, 2, 0);
+	zassert_true(ctr_gnss_session_feed(&m_session, &update, 20000), "target not met");
+}
+
+ZTEST(subsys_ctr_gnss_session, test_stats)
+{
+	struct ctr_gnss_data_update update = fix(8, 3.f);
+	struct ctr_gnss_data_session_end end;
+
+	zassert_equal(m_session.stats.last_ttff, -1, "last_ttff %d", m_session.stats.last_ttff);
+	zassert_equal(m_session.stats.avg_ttff, -1, "avg_ttff %d", m_session.stats.avg_ttff);
+
+	/* Cold start */
+	ctr_gnss_session_begin(&m_session, &m_config, 1, 0);
+	ctr_gnss_session_feed(&m_session, &update, 32000);
+	ctr_gnss_session_end(&m_session, true, 32000, &end);
+
+	/* Hot start with the backup domain kept */
+	ctr_gnss_session_begin(&m_session, &m_config, 2, 100000);
+	ctr_gnss_session_feed(&m_session, &update, 102000);
+	ctr_gnss_session_end(&m_session, true, 102000, &end);
+
+	/* Timeout without fix does not affect the time to first fix */
+	ctr_gnss_session_begin(&m_session, &m_config, 3, 200000);
+	ctr_gnss_session_end(&m_session, false, 320000, &end);
+
+	/* Cancelled session is not counted */
+	ctr_gnss_session_begin(&m_session, &m_config, 4, 400000);
+	ctr_gnss_session_cancel(&m_session);
+
+	const struct ctr_gnss_session_stats *stats = &m_session.stats;
+
+	zassert_equal(stats->sessions, 3, "sessions %d", stats->sessions);
+	zassert_equal(stats->fixes, 2, "fixes %d", stats->fixes);
+	zassert_equal(stats->timeouts, 1, "timeouts %d", stats->timeouts);
+	zassert_equal(stats->last_ttff, 2000, "last_ttff %d", stats->last_ttff);
+	zassert_equal(stats->min_ttff, 2000, "min_ttff %d", stats->min_ttff);
+	zassert_equal(stats->max_ttff, 32000, "max_ttff %d", stats->max_ttff);
+	zassert_equal(stats->avg_ttff, 17000, "avg_ttff %d", stats->avg_ttff);
+}
+
+ZTEST_SUITE(subsys_ctr_gnss_session, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,188 @@
+/** @file
+ *  @brief u-blox UBX protocol test suite
+ *
+ */
+
+#include "ctr_gnss_ubx.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Captured from the DDC port right after the reconfiguration: the tail of the NMEA output, the
+ * CFG-PRT acknowledgement, a NAV-PVT without fix and a NAV-PVT with a 3D fix */
+static const uint8_t m_capture[] = {
+	0x24, 0x47, 0x4e, 0x47, 0x47, 0x41, 0x2c, 0x30, 0x39, 0x34, 0x31, 0x31,
+	0x31, 0x2e, 0x30, 0x30, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x30, 0x2c, 0x30,
+	0x32, 0x2c, 0x39, 0x39, 0x2e, 0x39, 0x39, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+	0x2c, 0x2a, 0x37, 0x43, 0x0d, 0x0a, 0xb5, 0x62, 0x05, 0x01, 0x02, 0x00,
+	0x06, 0x00, 0x0e, 0x37, 0xb5, 0x62, 0x01, 0x07, 0x5c, 0x00, 0x28, 0xcd,
+	0xad, 0x16, 0xea, 0x07, 0x0a, 0x11, 0x09, 0x29, 0x0c, 0x37, 0x19, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x37, 0x89, 0x41, 0x00, 0x70, 0x38, 0x39, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0x00, 0x00, 0x20, 0xaa, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x60, 0xb5, 0x62, 0x01, 0x07,
+	0x5c, 0x00, 0x10, 0xd1, 0xad, 0x16, 0xea, 0x07, 0x0a, 0x11, 0x09, 0x29,
+	0x0c, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01,
+	0xe0, 0x09, 0x95, 0x08, 0x9b, 0x08, 0xb5, 0xeb, 0xd8, 0x1d, 0x3c, 0x42,
+	0x04, 0x00, 0x88, 0x97, 0x03, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x1e, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x20, 0xaa, 0x44, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x83,
+};
+
+#define CAPTURE_NMEA_LEN  42
+#define CAPTURE_ACK_LEN   10
+#define CAPTURE_NOFIX_LEN 100
+
+/* CFG-MSG enabling NAV-PVT on the current port */
+static const uint8_t m_cfg_msg[] = {
+	0xb5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51,
+};
+
+static struct ctr_gnss_ubx_parser m_parser;
+static int m_acks;
+static int m_updates;
+static struct ctr_gnss_data_update m_updates_buf[4];
+
+static void frame_cb(uint8_t cls, uint8_t id, const uint8_t *payload, size_t len,
+		     void *user_data)
+{
+	if (cls == CTR_GNSS_UBX_CLASS_ACK && id == CTR_GNSS_UBX_ID_ACK_ACK) {
+		zassert_equal(len, 2, "len %u", len);
+		zassert_equal(payload[0], CTR_GNSS_UBX_CLASS_CFG, "class 0x%02x", payload[0]);
+		zassert_equal(payload[1], CTR_GNSS_UBX_ID_CFG_PRT, "id 0x%02x", payload[1]);
+		m_acks++;
+
+	} else if (cls == CTR_GNSS_UBX_CLASS_NAV && id == CTR_GNSS_UBX_ID_NAV_PVT) {
+		struct ctr_gnss_ubx_nav_pvt pvt;
+		zassert_ok(ctr_gnss_ubx_decode_nav_pvt(payload, len, &pvt), "decode failed");
+		zassert_true(m_updates < ARRAY_SIZE(m_updates_buf), "too many updates");
+		ctr_gnss_ubx_nav_pvt_to_update(&pvt, &m_updates_buf[m_updates++]);
+
+	} else {
+		zassert_unreachable("unexpected frame 0x%02x 0x%02x", cls, id);
+	}
+}
+
+static void before(void *fixture)
+{
+	ctr_gnss_ubx_parser_init(&m_parser, frame_cb, NULL);
+
+	m_acks = 0;
+	m_updates = 0;
+}
+
+static void check_fix(const struct ctr_gnss_data_update *update)
+{
+	zassert_equal(update->fix_quality, 1, "fix quality %d", update->fix_quality);
+	zassert_equal(update->satellites_tracked, 9, "satellites %d",
+		      update->satellites_tracked);
+	zassert_within(update->latitude, 50.0755381f, 1e-5f, "latitude %f",
+		       (double)update->latitude);
+	zassert_within(update->longitude, 14.4378005f, 1e-5f, "longitude %f",
+		       (double)update->longitude);
+	zassert_within(update->altitude, 235.4f, 1e-3f, "altitude %f", (double)update->altitude);
+	zassert_within(update->h_acc, 2.35f, 1e-3f, "h_acc %f", (double)update->h_acc);
+	zassert_within(update->v_acc, 3.87f, 1e-3f, "v_acc %f", (double)update->v_acc);
+}
+
+static void check_capture(void)
+{
+	zassert_equal(m_parser.frames, 3, "frames %u", m_parser.frames);
+	zassert_equal(m_parser.checksum_errors, 0, "checksum errors %u", m_parser.checksum_errors);
+	zassert_equal(m_acks, 1, "acks %d", m_acks);
+	zassert_equal(m_updates, 2, "updates %d", m_updates);
+
+	zassert_equal(m_updates_buf[0].fix_quality, 0, "fix quality %d",
+		      m_updates_buf[0].fix_quality);
+	zassert_equal(m_updates_buf[0].satellites_tracked, 2, "satellites %d",
+		      m_updates_buf[0].satellites_tracked);
+	zassert_true(isnan(m_updates_buf[0].latitude), "latitude");
+	zassert_true(isnan(m_updates_buf[0].h_acc), "h_acc");
+
+	check_fix(&m_updates_buf[1]);
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_capture)
+{
+	ctr_gnss_ubx_parser_feed(&m_parser, m_capture, sizeof(m_capture));
+
+	check_capture();
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_capture_split)
+{
+	/* I2C bursts end anywhere within a frame */
+	for (size_t i = 0; i < sizeof(m_capture); i++) {
+		ctr_gnss_ubx_parser_feed(&m_parser, &m_capture[i], 1);
+	}
+
+	check_capture();
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_checksum)
+{
+	static uint8_t buf[sizeof(m_capture)];
+
+	memcpy(buf, m_capture, sizeof(buf));
+
+	/* Corrupt the number of satellites of the NAV-PVT without fix */
+	buf[CAPTURE_NMEA_LEN + CAPTURE_ACK_LEN + 6 + 23] ^= 0x40;
+
+	ctr_gnss_ubx_parser_feed(&m_parser, buf, sizeof(buf));
+
+	zassert_equal(m_parser.frames, 2, "frames %u", m_parser.frames);
+	zassert_equal(m_parser.checksum_errors, 1, "checksum errors %u", m_parser.checksum_errors);
+	zassert_equal(m_updates, 1, "updates %d", m_updates);
+
+	check_fix(&m_updates_buf[0]);
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_oversized)
+{
+	/* NAV-SAT with 48 satellites does not fit into the payload buffer */
+	static const uint8_t header[] = {0xb5, 0x62, 0x01, 0x35, 0x48, 0x02};
+
+	ctr_gnss_ubx_parser_feed(&m_parser, header, sizeof(header));
+	ctr_gnss_ubx_parser_feed(&m_parser, &m_capture[CAPTURE_NMEA_LEN + CAPTURE_ACK_LEN],
+				 sizeof(m_capture) - CAPTURE_NMEA_LEN - CAPTURE_ACK_LEN);
+
+	zassert_equal(m_parser.oversized, 1, "oversized %u", m_parser.oversized);
+	zassert_equal(m_updates, 2, "updates %d", m_updates);
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_encode)
+{
+	uint8_t buf[16];
+	uint8_t payload[] = {CTR_GNSS_UBX_CLASS_NAV, CTR_GNSS_UBX_ID_NAV_PVT, 1};
+
+	int ret = ctr_gnss_ubx_encode(buf, sizeof(buf), CTR_GNSS_UBX_CLASS_CFG,
+				      CTR_GNSS_UBX_ID_CFG_MSG, payload, sizeof(payload));
+	zassert_equal(ret, sizeof(m_cfg_msg), "unexpected result: %d", ret);
+	zassert_mem_equal(buf, m_cfg_msg, sizeof(m_cfg_msg), "mem equal");
+
+	ret = ctr_gnss_ubx_encode(buf, sizeof(m_cfg_msg) - 1, CTR_GNSS_UBX_CLASS_CFG,
+				  CTR_GNSS_UBX_ID_CFG_MSG, payload, sizeof(payload));
+	zassert_equal(ret, -ENOBUFS, "unexpected result: %d", ret);
+}
+
+ZTEST(subsys_ctr_gnss_ubx, test_decode_invalid)
+{
+	struct ctr_gnss_ubx_nav_pvt pvt;
+
+	int ret = ctr_gnss_ubx_decode_nav_pvt(&m_capture[CAPTURE_NMEA_LEN + CAPTURE_ACK_LEN + 6],
+					      CTR_GNSS_UBX_NAV_PVT_LEN - 1, &pvt);
+	zassert_equal(ret, -EINVAL, "unexpected result: %d", ret);
+}
+
+ZTEST_SUITE(subsys_ctr_gnss_ubx, NULL, NULL, before, NULL, NULL);
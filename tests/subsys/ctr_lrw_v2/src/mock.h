@@ -0,0 +1,24 @@
+#ifndef TESTS_SUBSYS_CTR_LRW_V2_SRC_MOCK_H_
+#define TESTS_SUBSYS_CTR_LRW_V2_SRC_MOCK_H_
+
+/* Zephyr includes */
+#include <zephyr/kernel.h>
+
+/* Standard includes */
+#include <stddef.h>
+
+/*
+ * Scripted modem dialog - an item with tx is expected as the next command and answered with rx
+ * (and rx2), items without tx are URCs sent delay_ms after the previous item was consumed
+ */
+struct mock_link_item {
+	const char *tx;
+	const char *rx;
+	const char *rx2;
+	int delay_ms;
+};
+
+void mock_ctr_lrw_link_start(struct mock_link_item *items, size_t count);
+size_t mock_ctr_lrw_link_get_remaining(void);
+
+#endif
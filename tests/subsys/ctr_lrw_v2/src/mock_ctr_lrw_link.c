@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "mock.h"
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_lrw_link.h>
+
+/* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+/* Standard includes */
+#include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DT_DRV_COMPAT hardwario_ctr_lrw_link
+
+LOG_MODULE_REGISTER(ctr_lrw_link, LOG_LEVEL_INF);
+
+#define TX_LINE_BUF_SIZE 1024
+#define RX_HEAP_MEM_SIZE 4096
+#define STACK_SIZE       1024
+#define WORKQ_PRIORITY   K_PRIO_COOP(7)
+
+struct ctr_lrw_link_data {
+	bool enabled;
+	struct k_mutex lock;
+	atomic_t in_dialog;
+	char tx_line_buf[TX_LINE_BUF_SIZE];
+	const struct device *dev;
+	ctr_lrw_link_user_cb user_cb;
+	void *user_data;
+	struct k_work event_dispatch_work;
+	struct k_work_delayable urc_dispatch_work;
+
+	struct k_work_q workq;
+	K_KERNEL_STACK_MEMBER(workq_stack, STACK_SIZE);
+	struct k_fifo rx_fifo;
+	struct k_heap rx_heap;
+	uint8_t rx_heap_mem[RX_HEAP_MEM_SIZE];
+
+	struct mock_link_item *items;
+	size_t items_count;
+	size_t items_index;
+};
+
+static inline struct ctr_lrw_link_data *get_data(const struct device *dev)
+{
+	return dev->data;
+}
+
+static int ctr_lrw_link_set_callback_(const struct device *dev, ctr_lrw_link_user_cb user_cb,
+				      void *user_data)
+{
+	k_mutex_lock(&get_data(dev)->lock, K_FOREVER);
+
+	get_data(dev)->user_cb = user_cb;
+	get_data(dev)->user_data = user_data;
+
+	k_mutex_unlock(&get_data(dev)->lock);
+
+	return 0;
+}
+
+static void ctr_lrw_link_lock_(const struct device *dev)
+{
+	k_mutex_lock(&get_data(dev)->lock, K_FOREVER);
+}
+
+static void ctr_lrw_link_unlock_(const struct device *dev)
+{
+	k_mutex_unlock(&get_data(dev)->lock);
+}
+
+static int ctr_lrw_link_reset_(const struct device *dev)
+{
+	LOG_DBG("Reset");
+
+	return 0;
+}
+
+static int rx(const struct device *dev, const char line[])
+{
+	struct ctr_lrw_link_data *data = get_data(dev);
+
+	size_t len = strlen(line);
+
+	char *p = k_heap_alloc(&data->rx_heap, len + 1, K_NO_WAIT);
+	if (!p) {
+		LOG_ERR("Call `k_heap_alloc` failed");
+		if (data->user_cb) {
+			data->user_cb(data->dev, CTR_LRW_LINK_EVENT_RX_LOSS, data->user_data);
+		}
+
+		return -ENOMEM;
+	}
+
+	strcpy(p, line);
+
+	int ret = k_fifo_alloc_put(&data->rx_fifo, p);
+	if (ret) {
+		LOG_ERR("Call `k_fifo_alloc_put` failed: %d", ret);
+		k_heap_free(&data->rx_heap, p);
+		return -ENOMEM;
+	}
+
+	if (data->user_cb && !atomic_get(&data->in_dialog)) {
+		k_work_submit_to_queue(&data->workq, &data->event_dispatch_work);
+	}
+
+	return 0;
+}
+
+/* Schedules the URC following the consumed item, if any */
+static void schedule_urc(struct ctr_lrw_link_data *data)
+{
+	if (data->items_index < data->items_count) {
+		const struct mock_link_item *item = &data->items[data->items_index];
+		if (item->tx == NULL) {
+			k_work_schedule_for_queue(&data->workq, &data->urc_dispatch_work,
+						  K_MSEC(item->delay_ms));
+		}
+	}
+}
+
+static void event_dispatch_work_handler(struct k_work *work)
+{
+	struct ctr_lrw_link_data *data =
+		CONTAINER_OF(work, struct ctr_lrw_link_data, event_dispatch_work);
+
+	if (data->user_cb) {
+		data->user_cb(data->dev, CTR_LRW_LINK_EVENT_RX_LINE, data->user_data);
+	}
+}
+
+static void urc_dispatch_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ctr_lrw_link_data *data =
+		CONTAINER_OF(dwork, struct ctr_lrw_link_data, urc_dispatch_work);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (data->items_index < data->items_count) {
+		const struct mock_link_item *item = &data->items[data->items_index];
+		if (item->tx == NULL) {
+			data->items_index++;
+			if (item->rx) {
+				rx(data->dev, item->rx);
+			}
+			schedule_urc(data);
+		}
+	}
+
+	k_mutex_unlock(&data->lock);
+}
+
+static int ctr_lrw_link_enable_uart_(const struct device *dev)
+{
+	LOG_DBG("Enable UART");
+
+	k_mutex_lock(&get_data(dev)->lock, K_FOREVER);
+
+	atomic_set(&get_data(dev)->in_dialog, false);
+	get_data(dev)->enabled = true;
+
+	k_mutex_unlock(&get_data(dev)->lock);
+
+	return 0;
+}
+
+static int ctr_lrw_link_disable_uart_(const struct device *dev)
+{
+	LOG_DBG("Disable UART");
+
+	k_mutex_lock(&get_data(dev)->lock, K_FOREVER);
+
+	get_data(dev)->enabled = false;
+
+	k_mutex_unlock(&get_data(dev)->lock);
+
+	return 0;
+}
+
+static int ctr_lrw_link_enter_dialog_(const struct device *dev)
+{
+	k_mutex_lock(&get_data(dev)->lock, K_FOREVER);
+
+	if (!get_data(dev)->enabled) {
+		k_mutex_unlock(&get_data(dev)->lock);
+		return -EBUSY;
+	}
+
+	atomic_set(&get_data(dev)->in_dialog, true);
+
+	k_mutex_unlock(&get_data(dev)->lock);
+
+	return 0;
+}
+
+static int ctr_lrw_link_exit_dialog_(const struct device *dev)
+{
+	struct ctr_lrw_link_data *data = get_data(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (!data->enabled) {
+		k_mutex_unlock(&data->lock);
+		return -EBUSY;
+	}
+
+	atomic_set(&data->in_dialog, false);
+
+	/* Lines received after the dialog finished are URCs */
+	if (data->user_cb && !k_fifo_is_empty(&data->rx_fifo)) {
+		k_work_submit_to_queue(&data->workq, &data->event_dispatch_work);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return 0;
+}
+
+static int ctr_lrw_link_send_line_(const struct device *dev, k_timeout_t timeout,
+				   const char *format, va_list ap)
+{
+	struct ctr_lrw_link_data *data = get_data(dev);
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (!data->enabled) {
+		k_mutex_unlock(&data->lock);
+		return -EBUSY;
+	}
+
+	int ret = vsnprintf(data->tx_line_buf, sizeof(data->tx_line_buf), format, ap);
+	if (ret < 0 || ret >= sizeof(data->tx_line_buf)) {
+		k_mutex_unlock(&data->lock);
+		return -ENOBUFS;
+	}
+
+	LOG_INF("Send line: %s", data->tx_line_buf);
+
+	if (data->items_index < data->items_count) {
+		const struct mock_link_item *item = &data->items[data->items_index];
+
+		zassert_not_null(item->tx, "unexpected TX line while waiting for URC: %s",
+				 data->tx_line_buf);
+		zassert_true(strcmp(data->tx_line_buf, item->tx) == 0,
+			     "unexpected TX line: get %s, expected %s", data->tx_line_buf,
+			     item->tx);
+
+		data->items_index++;
+
+		if (item->rx) {
+			rx(dev, item->rx);
+		}
+
+		if (item->rx2) {
+			rx(dev, item->rx2);
+		}
+
+		schedule_urc(data);
+	} else {
+		zassert_unreachable("unexpected TX line: %s", data->tx_line_buf);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return 0;
+}
+
+static int ctr_lrw_link_recv_line_(const struct device *dev, k_timeout_t timeout, char **line)
+{
+	*line = k_fifo_get(&get_data(dev)->rx_fifo, timeout);
+	if (*line) {
+		LOG_INF("Receive line: %s", *line);
+	}
+
+	return 0;
+}
+
+static int ctr_lrw_link_free_line_(const struct device *dev, char *line)
+{
+	k_heap_free(&get_data(dev)->rx_heap, line);
+
+	return 0;
+}
+
+static int ctr_lrw_link_drv_init(const struct device *dev)
+{
+	struct ctr_lrw_link_data *data = get_data(dev);
+
+	k_mutex_init(&data->lock);
+	k_fifo_init(&data->rx_fifo);
+	k_heap_init(&data->rx_heap, data->rx_heap_mem, RX_HEAP_MEM_SIZE);
+
+	struct k_work_queue_config cfg = {
+		.name = "ctr_lrw_link_drv_workq",
+	};
+
+	k_work_queue_start(&data->workq, data->workq_stack,
+			   K_THREAD_STACK_SIZEOF(data->workq_stack), WORKQ_PRIORITY, &cfg);
+
+	k_work_init(&data->event_dispatch_work, event_dispatch_work_handler);
+	k_work_init_delayable(&data->urc_dispatch_work, urc_dispatch_work_handler);
+
+	return 0;
+}
+
+static const struct ctr_lrw_link_driver_api ctr_lrw_link_driver_api = {
+	.set_callback = ctr_lrw_link_set_callback_,
+	.lock = ctr_lrw_link_lock_,
+	.unlock = ctr_lrw_link_unlock_,
+	.reset = ctr_lrw_link_reset_,
+	.enable_uart = ctr_lrw_link_enable_uart_,
+	.disable_uart = ctr_lrw_link_disable_uart_,
+	.enter_dialog = ctr_lrw_link_enter_dialog_,
+	.exit_dialog = ctr_lrw_link_exit_dialog_,
+	.send_line = ctr_lrw_link_send_line_,
+	.recv_line = ctr_lrw_link_recv_line_,
+	.free_line = ctr_lrw_link_free_line_,
+};
+
+#define CTR_LRW_LINK_INIT(n)                                                                       \
+	static struct ctr_lrw_link_data inst_##n##_data = {                                        \
+		.dev = DEVICE_DT_INST_GET(n),                                                      \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(n, ctr_lrw_link_drv_init, NULL, &inst_##n##_data, NULL, POST_KERNEL, \
+			      CONFIG_SERIAL_INIT_PRIORITY, &ctr_lrw_link_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(CTR_LRW_LINK_INIT)
+
+void mock_ctr_lrw_link_start(struct mock_link_item *items, size_t count)
+{
+	struct ctr_lrw_link_data *data = get_data(DEVICE_DT_INST_GET(0));
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	data->items = items;
+	data->items_count = count;
+	data->items_index = 0;
+
+	k_mutex_unlock(&data->lock);
+}
+
+size_t mock_ctr_lrw_link_get_remaining(void)
+{
+	struct ctr_lrw_link_data *data = get_data(DEVICE_DT_INST_GET(0));
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	size_t remaining = data->items_count - data->items_index;
+	k_mutex_unlock(&data->lock);
+
+	return remaining;
+}
@@ -0,0 +1,273 @@
+/* west build -b native_sim && ./build/zephyr/zephyr.elf */
+
+/*
+ * Test cases:
+ *
+ * - test_unconfirmed:  Unconfirmed uplink completes on +OK
+ * - test_confirmed:    Confirmed uplink completes on the +ACK URC without polling the modem
+ * - test_backoff:      +NOACK retries the uplink after the backoff
+ * - test_dutycycle:    Back-to-back uplinks are spaced by the EU868 duty-cycle off-time
+ * - test_priority:     Queued messages are sent by priority, expired ones are dropped
+ * - test_queue_full:   Full queue rejects or evicts by priority
+ * - test_unlocked:     Callback runs without the send lock, another thread may queue from it
+ */
+
+#include "mock.h"
+
+#include <chester/ctr_lrw_v2.h>
+#include <chester/drivers/ctr_lrw_link.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "ctr_lrw_v2_config.h"
+
+K_MSGQ_DEFINE(m_events, sizeof(enum ctr_lrw_v2_event), 16, 4);
+
+/* Queues a message from a separate thread while the callback waits for it */
+static K_SEM_DEFINE(m_probe_start, 0, 1);
+static K_SEM_DEFINE(m_probe_done, 0, 1);
+static bool m_probe;
+static int m_probe_ret;
+
+static void probe_thread(void *p1, void *p2, void *p3)
+{
+	for (;;) {
+		k_sem_take(&m_probe_start, K_FOREVER);
+
+		struct ctr_lrw_send_opts opts = CTR_LRW_SEND_OPTS_DEFAULTS;
+		uint8_t payload = 0x02;
+
+		m_probe_ret = ctr_lrw_v2_send(&opts, &payload, sizeof(payload));
+
+		k_sem_give(&m_probe_done);
+	}
+}
+
+K_THREAD_DEFINE(m_probe_thread, 1024, probe_thread, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, 0);
+
+static void lrw_event_handler(enum ctr_lrw_v2_event event, const char *line, void *param)
+{
+	if (event == CTR_LRW_V2_EVENT_SEND_OK || event == CTR_LRW_V2_EVENT_SEND_ERR) {
+		if (m_probe) {
+			m_probe = false;
+			k_sem_give(&m_probe_start);
+
+			/* Blocks on the send lock if the callback is invoked with it held */
+			if (k_sem_take(&m_probe_done, K_MSEC(500))) {
+				m_probe_ret = -EDEADLK;
+			}
+		}
+
+		k_msgq_put(&m_events, &event, K_NO_WAIT);
+	}
+}
+
+static void wait_event(enum ctr_lrw_v2_event expected, k_timeout_t timeout)
+{
+	enum ctr_lrw_v2_event event;
+
+	int ret = k_msgq_get(&m_events, &event, timeout);
+	zassert_ok(ret, "event %d not received", expected);
+	zassert_equal(event, expected, "unexpected event: %d", event);
+}
+
+static void send(int priority, int64_t ttl, bool confirmed, uint8_t payload)
+{
+	struct ctr_lrw_send_opts opts = CTR_LRW_SEND_OPTS_DEFAULTS;
+	opts.priority = priority;
+	opts.ttl = ttl;
+	opts.confirmed = confirmed;
+
+	int ret = ctr_lrw_v2_send(&opts, &payload, sizeof(payload));
+	zassert_ok(ret, "ctr_lrw_v2_send failed: %d", ret);
+}
+
+static void *setup(void)
+{
+	zassert_ok(ctr_lrw_v2_init(lrw_event_handler), "ctr_lrw_v2_init failed");
+
+	/* The modem is expected to be set up, start with the UART enabled */
+	const struct device *dev = DEVICE_DT_GET(DT_CHOSEN(ctr_lrw_link));
+	zassert_ok(ctr_lrw_link_enable_uart(dev), "ctr_lrw_link_enable_uart failed");
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	g_ctr_lrw_v2_config.test = false;
+	g_ctr_lrw_v2_config.band = CTR_LRW_V2_CONFIG_BAND_EU868;
+	g_ctr_lrw_v2_config.dutycycle = false;
+
+	k_msgq_purge(&m_events);
+}
+
+static void after(void *fixture)
+{
+	zassert_equal(mock_ctr_lrw_link_get_remaining(), 0, "commands skipped");
+	zassert_equal(k_msgq_num_used_get(&m_events), 0, "unexpected events");
+}
+
+ZTEST(lrw_send, test_unconfirmed)
+{
+	static struct mock_link_item items[] = {
+		{"AT+UTX 1\r01", "+OK"},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	send(0, 0, false, 0x01);
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+}
+
+ZTEST(lrw_send, test_confirmed)
+{
+	static struct mock_link_item items[] = {
+		{"AT+CTX 1\r01", "+OK"},
+		{NULL, "+ACK", NULL, 3000},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	int64_t start = k_uptime_get();
+
+	/* Any AT poll while waiting for the URC fails the script */
+	send(0, 0, true, 0x01);
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(10));
+
+	int64_t elapsed = k_uptime_get() - start;
+	zassert_true(elapsed >= 3000 && elapsed < 3500, "elapsed %lld ms", (long long)elapsed);
+}
+
+ZTEST(lrw_send, test_backoff)
+{
+	static struct mock_link_item items[] = {
+		{"AT+CTX 1\r02", "+OK"},
+		{NULL, "+NOACK", NULL, 100},
+		{"AT+CTX 1\r02", "+OK"},
+		{NULL, "+ACK", NULL, 100},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	int64_t start = k_uptime_get();
+
+	send(0, 0, true, 0x02);
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(15));
+
+	int64_t elapsed = k_uptime_get() - start;
+	zassert_true(elapsed >= 5000 && elapsed < 6000, "elapsed %lld ms", (long long)elapsed);
+}
+
+ZTEST(lrw_send, test_dutycycle)
+{
+	static struct mock_link_item items[] = {
+		{"AT+UTX 1\r03", "+OK"},
+		{"AT+UTX 1\r04", "+OK"},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	/* DR5 (SF7) with 1 byte of payload is 47 ms on air, 4653 ms off at 1 % duty cycle */
+	g_ctr_lrw_v2_config.dutycycle = true;
+	g_ctr_lrw_v2_config.adr = false;
+	g_ctr_lrw_v2_config.datarate = 5;
+
+	send(0, 0, false, 0x03);
+	send(0, 0, false, 0x04);
+
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+	int64_t start = k_uptime_get();
+
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(10));
+
+	int64_t elapsed = k_uptime_get() - start;
+	zassert_true(elapsed >= 4500 && elapsed < 5000, "elapsed %lld ms", (long long)elapsed);
+
+	/* Let the sub-band reopen for the following tests */
+	k_sleep(K_SECONDS(5));
+}
+
+ZTEST(lrw_send, test_priority)
+{
+	static struct mock_link_item items[] = {
+		{"AT+CTX 1\r05", "+OK"},
+		{NULL, "+ACK", NULL, 1000},
+		{"AT+UTX 1\r08", "+OK"},
+		{"AT+UTX 1\r07", "+OK"},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	send(0, 0, true, 0x05);
+
+	/* Queued while the confirmation is pending */
+	k_sleep(K_MSEC(200));
+	send(0, k_uptime_get() + 500, false, 0x06);
+	send(1, 0, false, 0x07);
+	send(2, 0, false, 0x08);
+
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(5));
+	wait_event(CTR_LRW_V2_EVENT_SEND_ERR, K_SECONDS(1));
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+}
+
+ZTEST(lrw_send, test_queue_full)
+{
+	static struct mock_link_item items[] = {
+		{"AT+CTX 1\r10", "+OK"},
+		{NULL, "+ACK", NULL, 1000},
+		{"AT+UTX 1\r15", "+OK"},
+		{"AT+UTX 1\r12", "+OK"},
+		{"AT+UTX 1\r13", "+OK"},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	send(0, 0, true, 0x10);
+	k_sleep(K_MSEC(200));
+
+	/* CONFIG_CTR_LRW_V2_SEND_QUEUE_SIZE=4, the pending confirmed message takes one slot */
+	send(0, 0, false, 0x11);
+	send(0, 0, false, 0x12);
+	send(0, 0, false, 0x13);
+
+	struct ctr_lrw_send_opts opts = CTR_LRW_SEND_OPTS_DEFAULTS;
+	uint8_t payload = 0x14;
+
+	int ret = ctr_lrw_v2_send(&opts, &payload, sizeof(payload));
+	zassert_equal(ret, -ENOBUFS, "unexpected result: %d", ret);
+
+	/* Evicts the oldest message of the lowest priority */
+	send(1, 0, false, 0x15);
+	wait_event(CTR_LRW_V2_EVENT_SEND_ERR, K_NO_WAIT);
+
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(5));
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+}
+
+ZTEST(lrw_send, test_unlocked)
+{
+	static struct mock_link_item items[] = {
+		{"AT+UTX 1\r01", "+OK"},
+		{"AT+UTX 1\r02", "+OK"},
+	};
+
+	mock_ctr_lrw_link_start(items, ARRAY_SIZE(items));
+
+	m_probe_ret = -EINPROGRESS;
+	m_probe = true;
+
+	send(0, 0, false, 0x01);
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+	zassert_ok(m_probe_ret, "send from callback failed: %d", m_probe_ret);
+
+	wait_event(CTR_LRW_V2_EVENT_SEND_OK, K_SECONDS(1));
+}
+
+ZTEST_SUITE(lrw_send, NULL, setup, before, after, NULL);
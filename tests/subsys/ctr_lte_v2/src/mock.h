@@ -23,5 +23,6 @@ struct mock_link_item {
 typedef char **list;
 
 void mock_ctr_lte_link_start(struct mock_link_item *items, size_t count);
+size_t mock_ctr_lte_link_get_remaining(void);
 
 #endif
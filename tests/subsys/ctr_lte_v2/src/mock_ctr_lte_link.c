@@ -557,3 +557,14 @@ void mock_ctr_lte_link_start(struct mock_link_item *items, size_t count)
 
 	k_mutex_unlock(&data->lock);
 }
+
+size_t mock_ctr_lte_link_get_remaining(void)
+{
+	struct ctr_lte_link_data *data = get_data(DEVICE_DT_INST_GET(0));
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	size_t remaining = data->items_count - data->items_index;
+	k_mutex_unlock(&data->lock);
+
+	return remaining;
+}
@@ -0,0 +1,239 @@
+/* west build -b native_sim -- -DCONFIG_TEST_FEATURE_PREPARE=y && ./build/zephyr/zephyr.elf */
+
+/*
+ * Test cases (run sequentially, depend on each other):
+ *
+ * - test_full:             Empty cache, identity queried and configuration applied
+ * - test_cached:           Same modem and configuration, redundant commands skipped
+ * - test_firmware_changed: Version mismatch falls back to the full sequence
+ * - test_config_changed:   Identity reused, configuration applied again
+ * - test_failure:          Failed prepare drops the cache
+ */
+
+#include "mock.h"
+
+#include <chester/ctr_lte_v2.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "ctr_lte_v2_config.h"
+#include "ctr_lte_v2_flow.h"
+#include "ctr_lte_v2_state.h"
+
+#define IMEI 351358815178345ULL
+
+/* clang-format off */
+#define ITEMS_IDENTITY                                                                             \
+	{"AT+CGSN=1", "+CGSN: \"351358815178345\"", "OK"},                                         \
+	{"AT%HWVERSION", "%HWVERSION: nRF9160 SICA B1A", "OK"},                                    \
+	{"AT%SHORTSWVER", "%SHORTSWVER: nrf9160_1.3.2", "OK"},                                     \
+	{"AT#XSLMVER", "#XSLMVER: \"2.5.2\",\"2.5.0-lte-5ccd2d4dd54c\"", "OK"}
+
+#define ITEMS_POWER                                                                                \
+	{"AT+CFUN=0", "OK"},                                                                       \
+	{"AT%XPOFWARN=1,30", "OK"},                                                                \
+	{"AT%XTEMPHIGHLVL=70", "OK"},                                                              \
+	{"AT%XTEMP=1", "OK"}
+
+#define ITEMS_SYSTEM                                                                               \
+	{"AT%XSYSTEMMODE=1,1,0,1", "OK"},                                                          \
+	{"AT%XDATAPRFL=0", "OK"},                                                                  \
+	{"AT%XBANDLOCK=0", "OK"}
+
+#define ITEMS_NOTIFY                                                                               \
+	{"AT+CEPPI=1", "OK"},                                                                      \
+	{"AT+CEREG=5", "OK"},                                                                      \
+	{"AT+CGEREP=1", "OK"},                                                                     \
+	{"AT+CMEE=1", "OK"},                                                                       \
+	{"AT+CNEC=24", "OK"},                                                                      \
+	{"AT+CSCON=1", "OK"},                                                                      \
+	{"AT+COPS=0", "OK"}
+/* clang-format on */
+
+static void prepare(struct mock_link_item *items, size_t count, bool expected_cached)
+{
+	mock_ctr_lte_link_start(items, count);
+
+	bool cached;
+	int ret = ctr_lte_v2_flow_prepare(&cached);
+	zassert_ok(ret, "ctr_lte_v2_flow_prepare failed: %d", ret);
+	zassert_equal(cached, expected_cached, "unexpected cached: %d", cached);
+	zassert_equal(mock_ctr_lte_link_get_remaining(), 0, "commands skipped");
+}
+
+static void assert_identity(const char *version)
+{
+	uint64_t imei;
+	zassert_ok(ctr_lte_v2_state_get_imei(&imei), "ctr_lte_v2_state_get_imei failed");
+	zassert_equal(imei, IMEI, "unexpected IMEI");
+
+	char *fw_version;
+	zassert_ok(ctr_lte_v2_state_get_modem_fw_version(&fw_version),
+		   "ctr_lte_v2_state_get_modem_fw_version failed");
+	zassert_equal(strcmp(fw_version, version), 0, "unexpected version: %s", fw_version);
+}
+
+static void test_full(void)
+{
+	/* clang-format off */
+	static struct mock_link_item items[] = {
+		{"AT", "OK"},
+		ITEMS_IDENTITY,
+		{"AT#XVERSION", "#XVERSION: \"v1.7.0\"", "OK"},
+		ITEMS_POWER,
+		ITEMS_SYSTEM,
+		{"AT%XSIM=1", "OK"},
+		{"AT%XNETTIME=1", "OK"},
+		{"AT%MDMEV=1", "OK"},
+		{"AT%REL14FEAT=1,1,1,1,0", "OK"},
+		{"AT%RAI=1", "OK"},
+		{"AT+CPSMS=1,,,\"00111000\",\"00000000\"", "OK"},
+		ITEMS_NOTIFY,
+		{"AT+CGDCONT=0,\"IP\"", "OK"},
+		{"AT+CGAUTH=0,0", "OK"},
+		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+		{"AT+CFUN=0", "OK"},
+	};
+	/* clang-format on */
+
+	prepare(items, ARRAY_SIZE(items), false);
+	assert_identity("v1.7.0");
+}
+
+static void test_cached(void)
+{
+	/* clang-format off */
+	static struct mock_link_item items[] = {
+		{"AT", "OK"},
+		{"AT#XVERSION", "#XVERSION: \"v1.7.0\"", "OK"},
+		ITEMS_POWER,
+		{"AT%XSIM=1", "OK"},
+		{"AT%XNETTIME=1", "OK"},
+		{"AT%MDMEV=1", "OK"},
+		{"AT%RAI=1", "OK"},
+		ITEMS_NOTIFY,
+		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+	};
+	/* clang-format on */
+
+	ctr_lte_v2_state_set_imei(0);
+
+	prepare(items, ARRAY_SIZE(items), true);
+	assert_identity("v1.7.0");
+}
+
+static void test_firmware_changed(void)
+{
+	/* clang-format off */
+	static struct mock_link_item items[] = {
+		{"AT", "OK"},
+		{"AT#XVERSION", "#XVERSION: \"v1.8.0\"", "OK"},
+		ITEMS_IDENTITY,
+		ITEMS_POWER,
+		ITEMS_SYSTEM,
+		{"AT%XSIM=1", "OK"},
+		{"AT%XNETTIME=1", "OK"},
+		{"AT%MDMEV=1", "OK"},
+		{"AT%REL14FEAT=1,1,1,1,0", "OK"},
+		{"AT%RAI=1", "OK"},
+		{"AT+CPSMS=1,,,\"00111000\",\"00000000\"", "OK"},
+		ITEMS_NOTIFY,
+		{"AT+CGDCONT=0,\"IP\"", "OK"},
+		{"AT+CGAUTH=0,0", "OK"},
+		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+		{"AT+CFUN=0", "OK"},
+	};
+	/* clang-format on */
+
+	prepare(items, ARRAY_SIZE(items), false);
+	assert_identity("v1.8.0");
+}
+
+static void test_config_changed(void)
+{
+	/* clang-format off */
+	static struct mock_link_item items[] = {
+		{"AT", "OK"},
+		{"AT#XVERSION", "#XVERSION: \"v1.8.0\"", "OK"},
+		ITEMS_POWER,
+		ITEMS_SYSTEM,
+		{"AT%XSIM=1", "OK"},
+		{"AT%XNETTIME=1", "OK"},
+		{"AT%MDMEV=1", "OK"},
+		{"AT%REL14FEAT=1,1,1,1,0", "OK"},
+		{"AT%RAI=1", "OK"},
+		{"AT+CPSMS=1,,,\"00111000\",\"00000000\"", "OK"},
+		ITEMS_NOTIFY,
+		{"AT+CGDCONT=0,\"IP\",\"hardwario\"", "OK"},
+		{"AT+CGAUTH=0,0", "OK"},
+		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+		{"AT+CFUN=0", "OK"},
+	};
+	/* clang-format on */
+
+	strcpy(g_ctr_lte_v2_config.apn, "hardwario");
+
+	prepare(items, ARRAY_SIZE(items), false);
+	assert_identity("v1.8.0");
+}
+
+static void test_failure(void)
+{
+	/* clang-format off */
+	static struct mock_link_item failing[] = {
+		{"AT", "OK"},
+		{"AT#XVERSION", "#XVERSION: \"v1.8.0\"", "OK"},
+		ITEMS_POWER,
+		{"AT%XSIM=1", "ERROR"},
+	};
+	/* clang-format on */
+
+	mock_ctr_lte_link_start(failing, ARRAY_SIZE(failing));
+
+	bool cached;
+	int ret = ctr_lte_v2_flow_prepare(&cached);
+	zassert_not_equal(ret, 0, "ctr_lte_v2_flow_prepare succeeded");
+	zassert_false(cached, "failed prepare reported as cached");
+
+	/* clang-format off */
+	static struct mock_link_item items[] = {
+		{"AT", "OK"},
+		ITEMS_IDENTITY,
+		{"AT#XVERSION", "#XVERSION: \"v1.8.0\"", "OK"},
+		ITEMS_POWER,
+		ITEMS_SYSTEM,
+		{"AT%XSIM=1", "OK"},
+		{"AT%XNETTIME=1", "OK"},
+		{"AT%MDMEV=1", "OK"},
+		{"AT%REL14FEAT=1,1,1,1,0", "OK"},
+		{"AT%RAI=1", "OK"},
+		{"AT+CPSMS=1,,,\"00111000\",\"00000000\"", "OK"},
+		ITEMS_NOTIFY,
+		{"AT+CGDCONT=0,\"IP\",\"hardwario\"", "OK"},
+		{"AT+CGAUTH=0,0", "OK"},
+		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+		{"AT+CFUN=0", "OK"},
+	};
+	/* clang-format on */
+
+	prepare(items, ARRAY_SIZE(items), false);
+	assert_identity("v1.8.0");
+}
+
+ZTEST(prepare, test_full_sequence)
+{
+	/* A previous run may have left the cache in the simulated flash */
+	ctr_lte_v2_flow_prepare_invalidate();
+
+	int ret = ctr_lte_v2_flow_enable(false);
+	zassert_ok(ret, "ctr_lte_v2_flow_enable failed: %d", ret);
+
+	test_full();
+	test_cached();
+	test_firmware_changed();
+	test_config_changed();
+	test_failure();
+}
+
+ZTEST_SUITE(prepare, NULL, NULL, NULL, NULL, NULL);
@@ -22,6 +22,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/settings/settings.h>
 
+#include "ctr_lte_v2_flow.h"
 #include "ctr_lte_v2_state.h"
 
 /* clang-format off */
@@ -80,6 +81,7 @@ static void test_attach(void)
 		#endif
 		{"AT+CGAUTH=0,0", "OK"},
 		{"AT%XMODEMSLEEP=1,500,10240", "OK"},
+		{"AT+CFUN=0", "OK"},
 		{"AT+CFUN=1", "%XMODEMSLEEP: 4", "OK"},
 		URC(0, "%XMODEMSLEEP: 4,0"),
 		URC(0, "+CEREG: 0"),
@@ -108,6 +110,9 @@ static void test_attach(void)
 	};
 	/* clang-format on */
 
+	/* Start with the full prepare sequence regardless of the simulated flash content */
+	ctr_lte_v2_flow_prepare_invalidate();
+
 	mock_ctr_lte_link_start(items, ARRAY_SIZE(items));
 
 	ctr_lte_v2_enable();
@@ -115,6 +120,12 @@ static void test_attach(void)
 	int ret = ctr_lte_v2_wait_for_connected(K_MSEC(6000));
 	zassert_ok(ret, "ctr_lte_v2_wait_for_connected failed");
 
+	struct ctr_lte_v2_metrics metrics;
+	ret = ctr_lte_v2_get_metrics(&metrics);
+	zassert_ok(ret, "ctr_lte_v2_get_metrics failed");
+	zassert_equal(metrics.prepare_count, 1, "prepare count incorrect");
+	zassert_equal(metrics.prepare_cached_count, 0, "prepare cached count incorrect");
+
 	k_sleep(K_MSEC(500));
 }
 
@@ -0,0 +1,128 @@
+/** @file
+ *  @brief pulse counter test suite
+ *
+ */
+
+#include <chester/ctr_pulse.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <stdint.h>
+
+static struct ctr_pulse m_pulse;
+
+static int m_cb_calls;
+static uint64_t m_cb_count;
+
+static void callback(struct ctr_pulse *pulse, uint64_t count, void *user_data)
+{
+	zassert_equal_ptr(pulse, &m_pulse, "unexpected instance");
+	zassert_equal_ptr(user_data, &m_cb_calls, "unexpected user data");
+
+	m_cb_calls++;
+	m_cb_count = count;
+}
+
+static uint64_t read(void)
+{
+	uint64_t count;
+
+	zassert_ok(ctr_pulse_read(&m_pulse, &count), "ctr_pulse_read failed");
+
+	return count;
+}
+
+static void before(void *fixture)
+{
+	m_cb_calls = 0;
+	m_cb_count = 0;
+
+	zassert_ok(ctr_pulse_init(&m_pulse, NULL, CTR_PULSE_EDGE_RISING, 0),
+		   "ctr_pulse_init failed");
+}
+
+ZTEST(subsus_ctr_pulse, test_count)
+{
+	/* Not started yet */
+	ctr_pulse_mock_inject(&m_pulse, 5);
+	zassert_equal(read(), 0, "counted while stopped");
+
+	zassert_ok(ctr_pulse_start(&m_pulse), "ctr_pulse_start failed");
+
+	ctr_pulse_mock_inject(&m_pulse, 1);
+	ctr_pulse_mock_inject(&m_pulse, 41);
+	zassert_equal(read(), 42, "count mismatch");
+
+	zassert_ok(ctr_pulse_stop(&m_pulse), "ctr_pulse_stop failed");
+
+	ctr_pulse_mock_inject(&m_pulse, 100);
+	zassert_equal(read(), 42, "counted while stopped");
+
+	zassert_ok(ctr_pulse_start(&m_pulse), "ctr_pulse_start failed");
+
+	ctr_pulse_mock_inject(&m_pulse, 8);
+	zassert_equal(read(), 50, "count not kept over stop/start");
+}
+
+ZTEST(subsus_ctr_pulse, test_wrap)
+{
+	zassert_ok(ctr_pulse_start(&m_pulse), "ctr_pulse_start failed");
+
+	/* The 32-bit raw counter wraps between the reads */
+	ctr_pulse_mock_inject(&m_pulse, 0xf0000000);
+	zassert_equal(read(), 0xf0000000ULL, "count mismatch");
+
+	ctr_pulse_mock_inject(&m_pulse, 0x20000000);
+	zassert_equal(read(), 0x110000000ULL, "count not extended over wrap");
+}
+
+ZTEST(subsus_ctr_pulse, test_threshold)
+{
+	zassert_ok(ctr_pulse_set_callback(&m_pulse, 100, callback, &m_cb_calls),
+		   "ctr_pulse_set_callback failed");
+	zassert_ok(ctr_pulse_start(&m_pulse), "ctr_pulse_start failed");
+
+	for (int i = 0; i < 25; i++) {
+		ctr_pulse_mock_inject(&m_pulse, 10);
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_equal(m_cb_calls, 2, "expected callbacks at 100 and 200");
+	zassert_equal(m_cb_count, 200, "callback count mismatch");
+
+	/* Crossing several thresholds at once is reported once, then rearmed relative to it */
+	ctr_pulse_mock_inject(&m_pulse, 1000);
+	k_sleep(K_MSEC(1));
+
+	zassert_equal(m_cb_calls, 3, "expected a single callback");
+	zassert_equal(m_cb_count, 1250, "callback count mismatch");
+
+	ctr_pulse_mock_inject(&m_pulse, 99);
+	k_sleep(K_MSEC(1));
+	zassert_equal(m_cb_calls, 3, "callback before threshold");
+
+	ctr_pulse_mock_inject(&m_pulse, 1);
+	k_sleep(K_MSEC(1));
+	zassert_equal(m_cb_calls, 4, "callback missing at threshold");
+	zassert_equal(m_cb_count, 1350, "callback count mismatch");
+
+	/* Disabled threshold */
+	zassert_ok(ctr_pulse_set_callback(&m_pulse, 0, NULL, NULL),
+		   "ctr_pulse_set_callback failed");
+
+	ctr_pulse_mock_inject(&m_pulse, 1000);
+	k_sleep(K_MSEC(1));
+	zassert_equal(m_cb_calls, 4, "callback while disabled");
+	zassert_equal(read(), 2350, "count mismatch");
+}
+
+ZTEST(subsus_ctr_pulse, test_holdoff_invalid)
+{
+	struct ctr_pulse pulse;
+
+	zassert_equal(ctr_pulse_init(&pulse, NULL, CTR_PULSE_EDGE_RISING, -1), -EINVAL,
+		      "negative hold-off accepted");
+}
+
+ZTEST_SUITE(subsus_ctr_pulse, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,142 @@
+/** @file
+ *  @brief platinum RTD conversion test suite
+ *
+ */
+
+#include "ctr_rtd_conv.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define BENCH_ROUNDS 10
+
+struct reference {
+	float t;
+	float r;
+};
+
+/* IEC 60751 Pt100 table (ohm, rounded to 10 mohm) */
+static const struct reference m_reference[] = {
+	{-200.f, 18.52f}, {-100.f, 60.26f},  {-50.f, 80.31f},  {0.f, 100.f},	{50.f, 119.40f},
+	{100.f, 138.51f}, {200.f, 175.86f},  {400.f, 247.09f}, {600.f, 313.71f}, {850.f, 390.48f},
+};
+
+/* Double precision conversion the engine replaced (valid from 0 °C only), kept as the benchmark
+ * baseline */
+static double legacy_convert_r_to_t(double r, double r0, double a, double b)
+{
+	return (-r0 * a + sqrt(r0 * r0 * a * a - 4 * r0 * b * (r0 - r))) / (2 * r0 * b);
+}
+
+ZTEST(subsus_ctr_rtd_conv, test_forward)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(m_reference); i++) {
+		const struct reference *r = &m_reference[i];
+		float ratio;
+
+		zassert_ok(ctr_rtd_conv_ratio(r->t, &ratio), "ctr_rtd_conv_ratio failed");
+		zassert_within(100.f * ratio, r->r, 0.006f, "at %.0f C: %.4f ohm", (double)r->t,
+			       (double)(100.f * ratio));
+	}
+}
+
+ZTEST(subsus_ctr_rtd_conv, test_inverse)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(m_reference); i++) {
+		const struct reference *r = &m_reference[i];
+		float t;
+
+		/* Clamp the rounded table endpoints into the range */
+		float ratio = fminf(fmaxf(r->r / 100.f, 0.1852008f), 3.9048113f);
+
+		zassert_ok(ctr_rtd_conv_temperature(ratio, &t), "ctr_rtd_conv_temperature failed");
+
+		/* Table rounding over the sensitivity, which drops to 0.33 ohm/°C at 850 °C */
+		zassert_within(t, r->t, 0.02f, "at %.0f C: %.4f C", (double)r->t, (double)t);
+	}
+}
+
+ZTEST(subsus_ctr_rtd_conv, test_round_trip)
+{
+	for (float t = -200.f; t <= 850.f; t += 0.25f) {
+		float ratio;
+		float result;
+
+		zassert_ok(ctr_rtd_conv_ratio(t, &ratio), "ctr_rtd_conv_ratio failed");
+		zassert_ok(ctr_rtd_conv_temperature(ratio, &result),
+			   "ctr_rtd_conv_temperature failed");
+		zassert_within(result, t, 0.005f, "at %.2f C: %.4f C", (double)t, (double)result);
+	}
+}
+
+ZTEST(subsus_ctr_rtd_conv, test_range)
+{
+	float value;
+
+	zassert_equal(ctr_rtd_conv_temperature(0.18f, &value), -ERANGE,
+		      "ratio under range accepted");
+	zassert_equal(ctr_rtd_conv_temperature(3.91f, &value), -ERANGE,
+		      "ratio over range accepted");
+	zassert_equal(ctr_rtd_conv_temperature(NAN, &value), -ERANGE, "NAN ratio accepted");
+	zassert_equal(ctr_rtd_conv_ratio(-201.f, &value), -ERANGE,
+		      "temperature under range accepted");
+	zassert_equal(ctr_rtd_conv_ratio(851.f, &value), -ERANGE,
+		      "temperature over range accepted");
+}
+
+ZTEST(subsus_ctr_rtd_conv, test_benchmark)
+{
+	static float r[1000];
+
+	/* Pt1000 from 0 to 849 °C, the range the double code covered */
+	for (size_t i = 0; i < ARRAY_SIZE(r); i++) {
+		float ratio;
+
+		zassert_ok(ctr_rtd_conv_ratio(0.849f * i, &ratio), "ctr_rtd_conv_ratio failed");
+
+		r[i] = 1000.f * ratio;
+	}
+
+	volatile float sink;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	for (int n = 0; n < BENCH_ROUNDS; n++) {
+		for (size_t i = 0; i < ARRAY_SIZE(r); i++) {
+			sink = legacy_convert_r_to_t(r[i], 1000.0, 3.9083e-3, -5.775e-7);
+		}
+	}
+	uint32_t double_cyc = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (int n = 0; n < BENCH_ROUNDS; n++) {
+		for (size_t i = 0; i < ARRAY_SIZE(r); i++) {
+			float t;
+
+			ctr_rtd_conv_temperature(r[i] / 1000.f, &t);
+			sink = t;
+		}
+	}
+	uint32_t float_cyc = k_cycle_get_32() - start;
+
+	(void)sink;
+
+	for (size_t i = 0; i < ARRAY_SIZE(r); i++) {
+		float t;
+
+		zassert_ok(ctr_rtd_conv_temperature(r[i] / 1000.f, &t),
+			   "ctr_rtd_conv_temperature failed");
+		zassert_within(t, (float)legacy_convert_r_to_t(r[i], 1000.0, 3.9083e-3, -5.775e-7),
+			       0.005f, "mismatch at %.3f ohm", (double)r[i]);
+	}
+
+	printf("conversions: %zu double: %u float: %u cycles (%d rounds)\n", ARRAY_SIZE(r),
+	       double_cyc, float_cyc, BENCH_ROUNDS);
+}
+
+ZTEST_SUITE(subsus_ctr_rtd_conv, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,16 @@
+#ifndef TESTS_SUBSYS_CTR_SPS30_SRC_MOCK_H_
+#define TESTS_SUBSYS_CTR_SPS30_SRC_MOCK_H_
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_x0.h>
+
+/* Values reported by the mocked sensor for every channel (channel index + 1) */
+#define MOCK_SPS30_VALUE(_index) ((_index) + 1)
+
+enum ctr_x0_mode mock_ctr_x0_get_mode(void);
+int mock_ctr_x0_get_set_count(void);
+void mock_ctr_x0_reset(void);
+
+int mock_sps30_get_fetch_count(void);
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "mock.h"
+
+/* CHESTER includes */
+#include <chester/drivers/ctr_x0.h>
+
+/* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
+
+/* Standard includes */
+#include <errno.h>
+
+static enum ctr_x0_mode m_mode;
+static int m_set_count;
+
+enum ctr_x0_mode mock_ctr_x0_get_mode(void)
+{
+	return m_mode;
+}
+
+int mock_ctr_x0_get_set_count(void)
+{
+	return m_set_count;
+}
+
+void mock_ctr_x0_reset(void)
+{
+	m_mode = CTR_X0_MODE_DEFAULT;
+	m_set_count = 0;
+}
+
+static int set_mode(const struct device *dev, enum ctr_x0_channel channel, enum ctr_x0_mode mode)
+{
+	if (channel != CTR_X0_CHANNEL_1) {
+		return -EINVAL;
+	}
+
+	m_mode = mode;
+	m_set_count++;
+
+	return 0;
+}
+
+static int get_spec(const struct device *dev, enum ctr_x0_channel channel,
+		    const struct gpio_dt_spec **spec)
+{
+	return -ENOTSUP;
+}
+
+static int init(const struct device *dev)
+{
+	return 0;
+}
+
+static const struct ctr_x0_driver_api m_api = {
+	.set_mode = set_mode,
+	.get_spec = get_spec,
+};
+
+DEVICE_DT_DEFINE(DT_NODELABEL(ctr_x0_a), init, NULL, NULL, NULL, POST_KERNEL,
+		 CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &m_api);
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 HARDWARIO a.s.
+ *
+ * SPDX-License-Identifier: LicenseRef-HARDWARIO-5-Clause
+ */
+
+#include "mock.h"
+
+/* CHESTER includes */
+#include <chester/drivers/sensor/sps30.h>
+
+/* Zephyr includes */
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+
+/* Standard includes */
+#include <errno.h>
+
+static const enum sensor_channel m_channels[] = {
+	SENSOR_CHAN_PM_1_0,
+	SENSOR_CHAN_PM_2_5,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_PM_4_0,
+	SENSOR_CHAN_PM_10,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_0_5,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_1_0,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_2_5,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_4_0,
+	(enum sensor_channel)SENSOR_CHAN_SPS30_NUM_CONCENTRATION_PM_10_0,
+};
+
+static int m_fetch_count;
+
+int mock_sps30_get_fetch_count(void)
+{
+	return m_fetch_count;
+}
+
+int sps30_power_on_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int sample_fetch(const struct device *dev, enum sensor_channel chan)
+{
+	m_fetch_count++;
+
+	return 0;
+}
+
+static int channel_get(const struct device *dev, enum sensor_channel chan,
+		       struct sensor_value *val)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(m_channels); i++) {
+		if (m_channels[i] == chan) {
+			val->val1 = MOCK_SPS30_VALUE(i);
+			val->val2 = 0;
+			return 0;
+		}
+	}
+
+	return -ENOTSUP;
+}
+
+static int init(const struct device *dev)
+{
+	return 0;
+}
+
+static const struct sensor_driver_api m_api = {
+	.sample_fetch = sample_fetch,
+	.channel_get = channel_get,
+};
+
+DEVICE_DT_DEFINE(DT_NODELABEL(sps30_ext), init, NULL, NULL, NULL, POST_KERNEL,
+		 CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &m_api);
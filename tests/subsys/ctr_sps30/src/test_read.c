@@ -0,0 +1,86 @@
+/* west build -b native_sim && ./build/zephyr/zephyr.elf */
+
+/*
+ * Test cases:
+ *
+ * - test_read:         Blocking read from a thread powers the sensor, waits and powers it off
+ * - test_sys_work_q:   Blocking read from the system work queue fails instead of deadlocking
+ */
+
+#include "mock.h"
+
+#include <chester/ctr_sps30.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+
+struct read_result {
+	struct k_work work;
+	struct k_sem done;
+	int ret;
+	float mass_conc_pm_1_0;
+	float num_conc_pm_10_0;
+};
+
+static struct read_result m_result;
+
+static void read_work_handler(struct k_work *work)
+{
+	struct read_result *result = CONTAINER_OF(work, struct read_result, work);
+
+	result->ret = ctr_sps30_read(&result->mass_conc_pm_1_0, NULL, NULL, NULL, NULL, NULL, NULL,
+				     NULL, &result->num_conc_pm_10_0);
+
+	k_sem_give(&result->done);
+}
+
+static void before(void *fixture)
+{
+	mock_ctr_x0_reset();
+}
+
+ZTEST(subsys_ctr_sps30, test_read)
+{
+	float mass_conc_pm_1_0;
+	float num_conc_pm_10_0;
+
+	int64_t start = k_uptime_get();
+
+	int ret = ctr_sps30_read(&mass_conc_pm_1_0, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+				 &num_conc_pm_10_0);
+	zassert_ok(ret, "ctr_sps30_read failed: %d", ret);
+
+	int64_t elapsed = k_uptime_get() - start;
+	zassert_true(elapsed >= 16000, "warm-up skipped: %lld ms", elapsed);
+
+	zassert_equal(mass_conc_pm_1_0, MOCK_SPS30_VALUE(0), "pm1.0 %f", (double)mass_conc_pm_1_0);
+	zassert_equal(num_conc_pm_10_0, MOCK_SPS30_VALUE(8), "nc10 %f", (double)num_conc_pm_10_0);
+
+	zassert_equal(mock_ctr_x0_get_set_count(), 2, "power not cycled");
+	zassert_equal(mock_ctr_x0_get_mode(), CTR_X0_MODE_DEFAULT, "sensor left powered");
+}
+
+ZTEST(subsys_ctr_sps30, test_sys_work_q)
+{
+	int fetch_count = mock_sps30_get_fetch_count();
+
+	k_work_init(&m_result.work, read_work_handler);
+	k_sem_init(&m_result.done, 0, 1);
+
+	k_work_submit(&m_result.work);
+
+	int ret = k_sem_take(&m_result.done, K_SECONDS(1));
+	zassert_ok(ret, "read from the system work queue did not return");
+
+	zassert_equal(m_result.ret, -EDEADLK, "unexpected result: %d", m_result.ret);
+	zassert_true(isnan(m_result.mass_conc_pm_1_0), "output not invalidated");
+	zassert_true(isnan(m_result.num_conc_pm_10_0), "output not invalidated");
+
+	zassert_equal(mock_ctr_x0_get_set_count(), 0, "sensor powered");
+	zassert_equal(mock_sps30_get_fetch_count(), fetch_count, "sensor fetched");
+}
+
+ZTEST_SUITE(subsys_ctr_sps30, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,386 @@
+/** @file
+ *  @brief thermocouple conversion test suite
+ *
+ */
+
+#include "ctr_tc_conv.h"
+
+#include <chester/ctr_tc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define BENCH_ROUNDS 10
+
+struct reference {
+	enum ctr_tc_type type;
+	float t;
+	float mv;
+};
+
+/* NIST ITS-90 thermocouple tables (mV, rounded to 1 uV) */
+static const struct reference m_reference[] = {
+	{CTR_TC_TYPE_J, -200.f, -7.890f},  {CTR_TC_TYPE_J, -100.f, -4.633f},
+	{CTR_TC_TYPE_J, 100.f, 5.269f},	   {CTR_TC_TYPE_J, 200.f, 10.779f},
+	{CTR_TC_TYPE_J, 500.f, 27.393f},   {CTR_TC_TYPE_J, 1000.f, 57.953f},
+	{CTR_TC_TYPE_J, 1200.f, 69.553f},  {CTR_TC_TYPE_K, -200.f, -5.891f},
+	{CTR_TC_TYPE_K, -100.f, -3.554f},  {CTR_TC_TYPE_K, 25.f, 1.000f},
+	{CTR_TC_TYPE_K, 100.f, 4.096f},	   {CTR_TC_TYPE_K, 200.f, 8.138f},
+	{CTR_TC_TYPE_K, 500.f, 20.644f},   {CTR_TC_TYPE_K, 1000.f, 41.276f},
+	{CTR_TC_TYPE_K, 1372.f, 54.886f},  {CTR_TC_TYPE_T, -200.f, -5.603f},
+	{CTR_TC_TYPE_T, -100.f, -3.379f},  {CTR_TC_TYPE_T, 100.f, 4.279f},
+	{CTR_TC_TYPE_T, 200.f, 9.288f},	   {CTR_TC_TYPE_T, 400.f, 20.872f},
+	{CTR_TC_TYPE_E, -200.f, -8.825f},  {CTR_TC_TYPE_E, -100.f, -5.237f},
+	{CTR_TC_TYPE_E, 100.f, 6.319f},	   {CTR_TC_TYPE_E, 200.f, 13.421f},
+	{CTR_TC_TYPE_E, 500.f, 37.005f},   {CTR_TC_TYPE_E, 1000.f, 76.373f},
+	{CTR_TC_TYPE_N, -200.f, -3.990f},  {CTR_TC_TYPE_N, -100.f, -2.407f},
+	{CTR_TC_TYPE_N, 100.f, 2.774f},	   {CTR_TC_TYPE_N, 500.f, 16.748f},
+	{CTR_TC_TYPE_N, 1000.f, 36.256f},  {CTR_TC_TYPE_N, 1300.f, 47.513f},
+	{CTR_TC_TYPE_R, -50.f, -0.226f},   {CTR_TC_TYPE_R, 100.f, 0.647f},
+	{CTR_TC_TYPE_R, 500.f, 4.471f},	   {CTR_TC_TYPE_R, 1000.f, 10.506f},
+	{CTR_TC_TYPE_R, 1500.f, 17.451f},  {CTR_TC_TYPE_R, 1700.f, 20.222f},
+	{CTR_TC_TYPE_S, -50.f, -0.236f},   {CTR_TC_TYPE_S, 100.f, 0.646f},
+	{CTR_TC_TYPE_S, 500.f, 4.233f},	   {CTR_TC_TYPE_S, 1000.f, 9.587f},
+	{CTR_TC_TYPE_S, 1500.f, 15.582f},  {CTR_TC_TYPE_S, 1700.f, 17.947f},
+	{CTR_TC_TYPE_B, 300.f, 0.431f},	   {CTR_TC_TYPE_B, 500.f, 1.242f},
+	{CTR_TC_TYPE_B, 1000.f, 4.834f},   {CTR_TC_TYPE_B, 1500.f, 10.099f},
+	{CTR_TC_TYPE_B, 1800.f, 13.591f},
+};
+
+/* Double precision type K conversion the engine replaced, kept as the benchmark baseline */
+static double legacy_cold_junction(double Tcj, const double T0, const double V0, const double p1,
+				   const double p2, const double p3, const double p4,
+				   const double q1, const double q2)
+{
+#define numerator   ((Tcj - T0) * (p1 + (Tcj - T0) * (p2 + (Tcj - T0) * (p3 + p4 * (Tcj - T0)))))
+#define denominator (1.0 + (Tcj - T0) * (q1 + q2 * (Tcj - T0)))
+	return (V0 + (numerator / denominator));
+#undef numerator
+#undef denominator
+}
+
+static double legacy_temperature_internal(double millivolts, const double T0, const double V0,
+					  const double p1, const double p2, const double p3,
+					  const double p4, const double q1, const double q2,
+					  const double q3)
+{
+#define numerator                                                                                  \
+	((millivolts - V0) *                                                                       \
+	 (p1 + (millivolts - V0) * (p2 + (millivolts - V0) * (p3 + p4 * (millivolts - V0)))))
+#define denominator                                                                                \
+	(1.0 + (millivolts - V0) * (q1 + (millivolts - V0) * (q2 + q3 * (millivolts - V0))))
+	return (T0 + (numerator / denominator));
+#undef numerator
+#undef denominator
+}
+
+static double legacy_cold_junction_voltage(double temperature_cj)
+{
+	// Type K equations
+	// Tcj = temperature in Celsius
+	// Returns equivalent voltage in mV
+	const double T0 = 25.0;
+	const double V0 = 1.0003453;
+	const double p1 = 4.0514854E-02;
+	const double p2 = -3.8789638E-05;
+	const double p3 = -2.8608478E-06;
+	const double p4 = -9.5367041E-10;
+	const double q1 = -1.3948675E-03;
+	const double q2 = -6.7976627E-05;
+
+	return legacy_cold_junction(temperature_cj, T0, V0, p1, p2, p3, p4, q1, q2);
+}
+
+static double legacy_temperature(double millivolts)
+{
+	// Type K equations
+	// millivolts = voltage in mV
+	// Returns computed temperature in Celsius
+	double T0, V0, p1, p2, p3, p4, q1, q2, q3;
+
+	if ((-6.404 < millivolts) && (millivolts <= -3.554)) {
+		T0 = -1.2147164E+02;
+		V0 = -4.1790858E+00;
+		p1 = 3.6069513E+01;
+		p2 = 3.0722076E+01;
+		p3 = 7.7913860E+00;
+		p4 = 5.2593991E-01;
+		q1 = 9.3939547E-01;
+		q2 = 2.7791285E-01;
+		q3 = 2.5163349E-02;
+	} else if ((-3.554 < millivolts) && (millivolts <= 4.096)) {
+		T0 = -8.7935962E+00;
+		V0 = -3.4489914E-01;
+		p1 = 2.5678719E+01;
+		p2 = -4.9887904E-01;
+		p3 = -4.4705222E-01;
+		p4 = -4.4869203E-02;
+		q1 = 2.3893439E-04;
+		q2 = -2.0397750E-02;
+		q3 = -1.8424107E-03;
+	} else if ((4.096 < millivolts) && (millivolts <= 16.397)) {
+		T0 = 3.1018976E+02;
+		V0 = 1.2631386E+01;
+		p1 = 2.4061949E+01;
+		p2 = 4.0158622E+00;
+		p3 = 2.6853917E-01;
+		p4 = -9.7188544E-03;
+		q1 = 1.6995872E-01;
+		q2 = 1.1413069E-02;
+		q3 = -3.9275155E-04;
+	} else if ((16.397 < millivolts) && (millivolts <= 33.275)) {
+		T0 = 6.0572562E+02;
+		V0 = 2.5148718E+01;
+		p1 = 2.3539401E+01;
+		p2 = 4.6547228E-02;
+		p3 = 1.3444400E-02;
+		p4 = 5.9236853E-04;
+		q1 = 8.3445513E-04;
+		q2 = 4.6121445E-04;
+		q3 = 2.5488122E-05;
+	} else if ((33.275 < millivolts) && (millivolts <= 69.553)) {
+		T0 = 1.0184705E+03;
+		V0 = 4.1993851E+01;
+		p1 = 2.5783239E+01;
+		p2 = -1.8363403E+00;
+		p3 = 5.6176662E-02;
+		p4 = 1.8532400E-04;
+		q1 = -7.4803355E-02;
+		q2 = 2.3841860E-03;
+		q3 = 0.0000000E+00;
+	} else {
+		return 0; // TODO
+	}
+
+	return legacy_temperature_internal(millivolts, T0, V0, p1, p2, p3, p4, q1, q2, q3);
+}
+
+static double legacy_get_temperature(double millivolts, double temperature_cj)
+{
+	double voltage_cj = legacy_cold_junction_voltage(temperature_cj);
+	return legacy_temperature(millivolts + voltage_cj);
+}
+
+
+/* Local Seebeck coefficient (mV/°C) used to turn the table rounding into a temperature bound */
+static float seebeck(enum ctr_tc_type type, float t)
+{
+	float lo;
+	float hi;
+
+	/* One-sided at the ends of the range */
+	if (ctr_tc_conv_mv(type, t - 1.f, &lo)) {
+		zassert_ok(ctr_tc_conv_mv(type, t, &lo), "ctr_tc_conv_mv failed");
+		zassert_ok(ctr_tc_conv_mv(type, t + 1.f, &hi), "ctr_tc_conv_mv failed");
+		return hi - lo;
+	}
+
+	if (ctr_tc_conv_mv(type, t + 1.f, &hi)) {
+		zassert_ok(ctr_tc_conv_mv(type, t, &hi), "ctr_tc_conv_mv failed");
+		return hi - lo;
+	}
+
+	return (hi - lo) / 2.f;
+}
+
+ZTEST(subsus_ctr_tc_conv, test_forward)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(m_reference); i++) {
+		const struct reference *r = &m_reference[i];
+		float mv;
+
+		zassert_ok(ctr_tc_conv_mv(r->type, r->t, &mv), "ctr_tc_conv_mv failed");
+		zassert_within(mv, r->mv, 0.0006f, "type %d at %.0f C: %.6f mV", r->type,
+			       (double)r->t, (double)mv);
+	}
+}
+
+ZTEST(subsus_ctr_tc_conv, test_inverse)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(m_reference); i++) {
+		const struct reference *r = &m_reference[i];
+		float t;
+
+		zassert_ok(ctr_tc_conv_temperature(r->type, r->mv, &t),
+			   "ctr_tc_conv_temperature failed");
+
+		float tolerance = 0.0006f / seebeck(r->type, r->t) + 0.01f;
+
+		zassert_within(t, r->t, tolerance, "type %d at %.0f C: %.4f C", r->type,
+			       (double)r->t, (double)t);
+	}
+}
+
+ZTEST(subsus_ctr_tc_conv, test_round_trip)
+{
+	static const struct {
+		enum ctr_tc_type type;
+		float t_min;
+		float t_max;
+	} ranges[] = {
+		{CTR_TC_TYPE_J, -209.f, 1199.f}, {CTR_TC_TYPE_K, -199.f, 1371.f},
+		{CTR_TC_TYPE_T, -199.f, 399.f},	 {CTR_TC_TYPE_E, -199.f, 999.f},
+		{CTR_TC_TYPE_N, -199.f, 1299.f}, {CTR_TC_TYPE_R, -49.f, 1767.f},
+		{CTR_TC_TYPE_S, -49.f, 1767.f},	 {CTR_TC_TYPE_B, 251.f, 1819.f},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(ranges); i++) {
+		for (float t = ranges[i].t_min; t <= ranges[i].t_max; t += 0.5f) {
+			float mv;
+			float result;
+
+			zassert_ok(ctr_tc_conv_mv(ranges[i].type, t, &mv), "ctr_tc_conv_mv failed");
+			zassert_ok(ctr_tc_conv_temperature(ranges[i].type, mv, &result),
+				   "ctr_tc_conv_temperature failed");
+			zassert_within(result, t, 0.005f, "type %d at %.1f C: %.4f C",
+				       ranges[i].type, (double)t, (double)result);
+		}
+	}
+}
+
+ZTEST(subsus_ctr_tc_conv, test_endpoints)
+{
+	static const struct {
+		enum ctr_tc_type type;
+		float t_min;
+		float t_max;
+	} ranges[] = {
+		{CTR_TC_TYPE_J, -210.f, 1200.f}, {CTR_TC_TYPE_K, -200.f, 1372.f},
+		{CTR_TC_TYPE_T, -200.f, 400.f},	 {CTR_TC_TYPE_E, -200.f, 1000.f},
+		{CTR_TC_TYPE_N, -200.f, 1300.f}, {CTR_TC_TYPE_R, -50.f, 1768.f},
+		{CTR_TC_TYPE_S, -50.f, 1768.f},	 {CTR_TC_TYPE_B, 250.f, 1820.f},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(ranges); i++) {
+		float limits[] = {ranges[i].t_min, ranges[i].t_max};
+
+		for (size_t j = 0; j < ARRAY_SIZE(limits); j++) {
+			float mv;
+			float result;
+
+			zassert_ok(ctr_tc_conv_mv(ranges[i].type, limits[j], &mv),
+				   "ctr_tc_conv_mv failed");
+			zassert_ok(ctr_tc_conv_temperature(ranges[i].type, mv, &result),
+				   "type %d at %.0f C: endpoint rejected", ranges[i].type,
+				   (double)limits[j]);
+			zassert_within(result, limits[j], 0.005f, "type %d at %.0f C: %.4f C",
+				       ranges[i].type, (double)limits[j], (double)result);
+
+			/* Beyond the rounding of the table values */
+			float outside = j ? mv + 0.001f : mv - 0.001f;
+
+			zassert_equal(ctr_tc_conv_temperature(ranges[i].type, outside, &result),
+				      -ERANGE, "type %d at %.0f C: outside accepted",
+				      ranges[i].type, (double)limits[j]);
+		}
+	}
+}
+
+ZTEST(subsus_ctr_tc_conv, test_cold_junction)
+{
+	float t;
+
+	/* Hot junction at 100 °C with the terminals at 25 °C */
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_K, 4.096f - 1.000f, 25.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, 100.f, 0.05f, "type K %.4f C", (double)t);
+
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_J, 5.269f - 1.277f, 25.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, 100.f, 0.05f, "type J %.4f C", (double)t);
+
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_T, -4.648f - 0.992f, 25.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, -150.f, 0.05f, "type T %.4f C", (double)t);
+
+	/* Sub-zero terminals */
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_K, 0.f, -20.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, -20.f, 0.01f, "type K %.4f C", (double)t);
+
+	/* Type B output is slightly negative around room temperature */
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_B, 1.242f + 0.002f, 25.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, 500.f, 0.2f, "type B %.4f C", (double)t);
+
+	/* Type B terminals below the reference function range contribute a few microvolts */
+	zassert_ok(ctr_tc_conv(CTR_TC_TYPE_B, 1.242f, -20.f, &t), "ctr_tc_conv failed");
+	zassert_within(t, 500.f, 2.f, "type B %.4f C", (double)t);
+}
+
+ZTEST(subsus_ctr_tc_conv, test_range)
+{
+	float value;
+
+	zassert_equal(ctr_tc_conv_temperature(CTR_TC_TYPE_K, 60.f, &value), -ERANGE,
+		      "voltage over range accepted");
+	zassert_equal(ctr_tc_conv_temperature(CTR_TC_TYPE_K, -6.5f, &value), -ERANGE,
+		      "voltage under range accepted");
+	zassert_equal(ctr_tc_conv_temperature(CTR_TC_TYPE_B, 0.1f, &value), -ERANGE,
+		      "type B voltage under range accepted");
+	zassert_equal(ctr_tc_conv_temperature(CTR_TC_TYPE_K, NAN, &value), -ERANGE,
+		      "NAN voltage accepted");
+	zassert_equal(ctr_tc_conv_mv(CTR_TC_TYPE_T, 401.f, &value), -ERANGE,
+		      "temperature over range accepted");
+	zassert_equal(ctr_tc_conv_mv(CTR_TC_TYPE_S, -51.f, &value), -ERANGE,
+		      "temperature under range accepted");
+	zassert_equal(ctr_tc_conv(CTR_TC_TYPE_K, 0.f, NAN, &value), -ERANGE,
+		      "NAN cold junction accepted");
+	zassert_equal(ctr_tc_conv(CTR_TC_TYPE_B + 1, 0.f, 25.f, &value), -EINVAL,
+		      "unknown type accepted");
+}
+
+ZTEST(subsus_ctr_tc_conv, test_benchmark)
+{
+	static float mv[1000];
+
+	/* Type K from -190 to 1360 °C with the terminals at 25 °C */
+	for (size_t i = 0; i < ARRAY_SIZE(mv); i++) {
+		float hot;
+		float cold;
+
+		zassert_ok(ctr_tc_conv_mv(CTR_TC_TYPE_K, -190.f + 1.55f * i, &hot),
+			   "ctr_tc_conv_mv failed");
+		zassert_ok(ctr_tc_conv_mv(CTR_TC_TYPE_K, 25.f, &cold), "ctr_tc_conv_mv failed");
+
+		mv[i] = hot - cold;
+	}
+
+	volatile float sink;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	for (int r = 0; r < BENCH_ROUNDS; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(mv); i++) {
+			sink = legacy_get_temperature(mv[i], 25.f);
+		}
+	}
+	uint32_t double_cyc = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (int r = 0; r < BENCH_ROUNDS; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(mv); i++) {
+			float t;
+
+			ctr_tc_conv(CTR_TC_TYPE_K, mv[i], 25.f, &t);
+			sink = t;
+		}
+	}
+	uint32_t float_cyc = k_cycle_get_32() - start;
+
+	(void)sink;
+
+	/* Both agree within the accuracy of the rational approximation */
+	for (size_t i = 0; i < ARRAY_SIZE(mv); i++) {
+		float t;
+
+		zassert_ok(ctr_tc_conv(CTR_TC_TYPE_K, mv[i], 25.f, &t), "ctr_tc_conv failed");
+		zassert_within(t, (float)legacy_get_temperature(mv[i], 25.f), 0.05f,
+			       "mismatch at %.3f mV", (double)mv[i]);
+	}
+
+	printf("conversions: %zu double: %u float: %u cycles (%d rounds)\n", ARRAY_SIZE(mv),
+	       double_cyc, float_cyc, BENCH_ROUNDS);
+}
+
+ZTEST_SUITE(subsus_ctr_tc_conv, NULL, NULL, NULL, NULL, NULL);